@@ -29,9 +29,14 @@
 #include <libevmasm/ConstantOptimiser.h>
 #include <libevmasm/GasMeter.h>
 
-#include <fstream>
+#include <libsolutil/OptimiserProfile.h>
+
 #include <json/json.h>
 
+#include <atomic>
+#include <fstream>
+#include <thread>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::evmasm;
@@ -72,7 +77,7 @@ string locationFromSources(StringMap const& _sourceCodes, SourceLocation const&
 	if (!_location.hasText() || _sourceCodes.empty())
 		return "";
 
-	auto it = _sourceCodes.find(_location.source->name());
+	auto it = _sourceCodes.find(_location.sourceName());
 	if (it == _sourceCodes.end())
 		return "";
 
@@ -144,8 +149,8 @@ public:
 		if (!m_location.isValid())
 			return;
 		m_out << m_prefix << "    /*";
-		if (m_location.source)
-			m_out << " \"" + m_location.source->name() + "\"";
+		if (m_location.hasSource())
+			m_out << " \"" + m_location.sourceName() + "\"";
 		if (m_location.hasText())
 			m_out << ":" << to_string(m_location.start) + ":" + to_string(m_location.end);
 		m_out << "  " << locationFromSources(m_sourceCodes, m_location);
@@ -226,9 +231,9 @@ Json::Value Assembly::assemblyJSON(map<string, unsigned> const& _sourceIndices)
 	for (AssemblyItem const& i: m_items)
 	{
 		unsigned sourceIndex = unsigned(-1);
-		if (i.location().source)
+		if (i.location().hasSource())
 		{
-			auto iter = _sourceIndices.find(i.location().source->name());
+			auto iter = _sourceIndices.find(i.location().sourceName());
 			if (iter != _sourceIndices.end())
 				sourceIndex = iter->second;
 		}
@@ -364,19 +369,12 @@ map<u256, u256> Assembly::optimiseInternal(
 )
 {
 	// Run optimisation for sub-assemblies.
+	vector<map<u256, u256>> subTagReplacements = optimiseSubs(_settings);
 	for (size_t subId = 0; subId < m_subs.size(); ++subId)
-	{
-		OptimiserSettings settings = _settings;
-		// Disable creation mode for sub-assemblies.
-		settings.isCreation = false;
-		map<u256, u256> subTagReplacements = m_subs[subId]->optimiseInternal(
-			settings,
-			JumpdestRemover::referencedTags(m_items, subId)
-		);
 		// Apply the replacements (can be empty).
-		BlockDeduplicator::applyTagReplacement(m_items, subTagReplacements, subId);
-	}
+		BlockDeduplicator::applyTagReplacement(m_items, subTagReplacements[subId], subId);
 
+	auto measure = [&]() { return OptimiserProfile::CodeSize{m_items.size(), bytesRequired(1)}; };
 	map<u256, u256> tagReplacements;
 	// Iterate until no new optimisation possibilities are found.
 	for (unsigned count = 1; count > 0;)
@@ -385,6 +383,7 @@ map<u256, u256> Assembly::optimiseInternal(
 
 		if (_settings.runJumpdestRemover)
 		{
+			OptimiserProfile::Recorder recorder("evmasm", "JumpdestRemover", measure);
 			JumpdestRemover jumpdestOpt{m_items};
 			if (jumpdestOpt.optimise(_tagsReferencedFromOutside))
 				count++;
@@ -392,6 +391,7 @@ map<u256, u256> Assembly::optimiseInternal(
 
 		if (_settings.runPeephole)
 		{
+			OptimiserProfile::Recorder recorder("evmasm", "PeepholeOptimiser", measure);
 			PeepholeOptimiser peepOpt{m_items};
 			while (peepOpt.optimise())
 			{
@@ -403,6 +403,7 @@ map<u256, u256> Assembly::optimiseInternal(
 		// This only modifies PushTags, we have to run again to actually remove code.
 		if (_settings.runDeduplicate)
 		{
+			OptimiserProfile::Recorder recorder("evmasm", "BlockDeduplicator", measure);
 			BlockDeduplicator dedup{m_items};
 			if (dedup.deduplicate())
 			{
@@ -431,6 +432,7 @@ map<u256, u256> Assembly::optimiseInternal(
 			// Control flow graph optimization has been here before but is disabled because it
 			// assumes we only jump to tags that are pushed. This is not the case anymore with
 			// function types that can be stored in storage.
+			OptimiserProfile::Recorder recorder("evmasm", "CommonSubexpressionEliminator", measure);
 			AssemblyItems optimisedItems;
 
 			bool usesMSize = (find(m_items.begin(), m_items.end(), AssemblyItem{Instruction::MSIZE}) != m_items.end());
@@ -477,16 +479,111 @@ map<u256, u256> Assembly::optimiseInternal(
 	}
 
 	if (_settings.runConstantOptimiser)
+	{
+		OptimiserProfile::Recorder recorder("evmasm", "ConstantOptimiser", measure);
 		ConstantOptimisationMethod::optimiseConstants(
 			_settings.isCreation,
 			_settings.isCreation ? 1 : _settings.expectedExecutionsPerDeployment,
 			_settings.evmVersion,
 			*this
 		);
+	}
 
 	return tagReplacements;
 }
 
+vector<map<u256, u256>> Assembly::optimiseSubs(OptimiserSettings const& _settings)
+{
+	OptimiserSettings settings = _settings;
+	// Disable creation mode for sub-assemblies.
+	settings.isCreation = false;
+	// Only the subs of the outermost assembly are optimised concurrently, so that the
+	// number of threads is bounded by the parallelism.
+	settings.parallelism = 1;
+
+	vector<set<size_t>> tagsReferencedFromOutside;
+	for (size_t subId = 0; subId < m_subs.size(); ++subId)
+		tagsReferencedFromOutside.push_back(JumpdestRemover::referencedTags(m_items, subId));
+
+	// Sub-assemblies are optimised in place and can be shared, e.g. if a contract embeds both
+	// the creation and the runtime code of another contract. Subs that (indirectly) share an
+	// assembly are optimised one after the other by the same job, in the order of their ids,
+	// so that the result is the same as if all subs were optimised sequentially.
+	vector<vector<size_t>> jobs;
+	vector<set<Assembly const*>> jobAssemblies;
+	for (size_t subId = 0; subId < m_subs.size(); ++subId)
+	{
+		vector<size_t> job{subId};
+		set<Assembly const*> assemblies;
+		m_subs[subId]->collectAssemblies(assemblies);
+		for (size_t i = 0; i < jobs.size();)
+			if (any_of(
+				jobAssemblies[i].begin(),
+				jobAssemblies[i].end(),
+				[&](Assembly const* _assembly) { return assemblies.count(_assembly); }
+			))
+			{
+				job += jobs[i];
+				assemblies += jobAssemblies[i];
+				jobs.erase(jobs.begin() + ptrdiff_t(i));
+				jobAssemblies.erase(jobAssemblies.begin() + ptrdiff_t(i));
+			}
+			else
+				++i;
+		sort(job.begin(), job.end());
+		jobs.emplace_back(move(job));
+		jobAssemblies.emplace_back(move(assemblies));
+	}
+
+	vector<map<u256, u256>> subTagReplacements(m_subs.size());
+	vector<exception_ptr> failures(m_subs.size());
+	atomic<size_t> nextJob{0};
+	OptimiserProfile* profile = OptimiserProfile::current();
+	auto worker = [&]()
+	{
+		OptimiserProfile::Scope profileScope(profile);
+		for (size_t job = nextJob++; job < jobs.size(); job = nextJob++)
+			for (size_t subId: jobs[job])
+				try
+				{
+					subTagReplacements[subId] = m_subs[subId]->optimiseInternal(
+						settings,
+						move(tagsReferencedFromOutside[subId])
+					);
+				}
+				catch (...)
+				{
+					failures[subId] = current_exception();
+					break;
+				}
+	};
+
+	if (_settings.parallelism <= 1 || jobs.size() <= 1)
+		worker();
+	else
+	{
+		vector<thread> threads;
+		for (size_t i = 0; i < min<size_t>(_settings.parallelism, jobs.size()); ++i)
+			threads.emplace_back(worker);
+		for (thread& t: threads)
+			t.join();
+	}
+
+	// Report the failure of the first sub, just like sequential optimisation would.
+	for (exception_ptr const& failure: failures)
+		if (failure)
+			rethrow_exception(failure);
+
+	return subTagReplacements;
+}
+
+void Assembly::collectAssemblies(set<Assembly const*>& _assemblies) const
+{
+	if (_assemblies.insert(this).second)
+		for (auto const& sub: m_subs)
+			sub->collectAssemblies(_assemblies);
+}
+
 LinkerObject const& Assembly::assemble() const
 {
 	// Return the already assembled object, if present.
@@ -108,6 +108,9 @@ public:
 		/// This specifies an estimate on how often each opcode in this assembly will be executed,
 		/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 		size_t expectedExecutionsPerDeployment = 200;
+		/// Maximum number of threads used to optimise the independent sub-assemblies of the
+		/// outermost assembly concurrently. Nested sub-assemblies are optimised sequentially.
+		unsigned parallelism = 1;
 	};
 
 	/// Modify and return the current assembly such that creation and execution gas usage
@@ -141,6 +144,11 @@ protected:
 	/// returns the replaced tags. Also takes an argument containing the tags of this assembly
 	/// that are referenced in a super-assembly.
 	std::map<u256, u256> optimiseInternal(OptimiserSettings const& _settings, std::set<size_t> _tagsReferencedFromOutside);
+	/// Optimises all sub-assemblies, concurrently if allowed by @a _settings.
+	/// @returns the replaced tags of each sub-assembly, indexed by sub id.
+	std::vector<std::map<u256, u256>> optimiseSubs(OptimiserSettings const& _settings);
+	/// Adds this assembly and all of its (indirect) sub-assemblies to @a _assemblies.
+	void collectAssemblies(std::set<Assembly const*>& _assemblies) const;
 
 	unsigned bytesRequired(unsigned subTagSize) const;
 
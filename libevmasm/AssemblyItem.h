@@ -27,6 +27,7 @@
 #include <libsolutil/Common.h>
 #include <libsolutil/Assertions.h>
 #include <iostream>
+#include <limits>
 #include <sstream>
 
 namespace solidity::evmasm
@@ -70,7 +71,7 @@ public:
 		if (m_type == Operation)
 			m_instruction = Instruction(uint8_t(_data));
 		else
-			m_data = std::make_shared<u256>(std::move(_data));
+			storeData(_data);
 	}
 	AssemblyItem(AssemblyItem const&) = default;
 	AssemblyItem(AssemblyItem&&) = default;
@@ -89,8 +90,8 @@ public:
 	void setPushTagSubIdAndTag(size_t _subId, size_t _tag);
 
 	AssemblyItemType type() const { return m_type; }
-	u256 const& data() const { assertThrow(m_type != Operation, util::Exception, ""); return *m_data; }
-	void setData(u256 const& _data) { assertThrow(m_type != Operation, util::Exception, ""); m_data = std::make_shared<u256>(_data); }
+	u256 data() const { assertThrow(m_type != Operation, util::Exception, ""); return m_largeData ? *m_largeData : u256(m_smallData); }
+	void setData(u256 const& _data) { assertThrow(m_type != Operation, util::Exception, ""); storeData(_data); }
 
 	/// @returns the instruction of this item (only valid if type() == Operation)
 	Instruction instruction() const { assertThrow(m_type == Operation, util::Exception, ""); return m_instruction; }
@@ -102,8 +103,10 @@ public:
 			return false;
 		if (type() == Operation)
 			return instruction() == _other.instruction();
+		else if (m_largeData && _other.m_largeData)
+			return *m_largeData == *_other.m_largeData;
 		else
-			return data() == _other.data();
+			return !m_largeData && !_other.m_largeData && m_smallData == _other.m_smallData;
 	}
 	bool operator!=(AssemblyItem const& _other) const { return !operator==(_other); }
 	/// Less-than operator compatible with operator==.
@@ -113,8 +116,13 @@ public:
 			return type() < _other.type();
 		else if (type() == Operation)
 			return instruction() < _other.instruction();
+		else if (m_largeData && _other.m_largeData)
+			return *m_largeData < *_other.m_largeData;
+		else if (m_largeData || _other.m_largeData)
+			// Large data does not fit into 64 bits, so it is larger than any small data.
+			return !m_largeData;
 		else
-			return data() < _other.data();
+			return m_smallData < _other.m_smallData;
 	}
 
 	/// Shortcut that avoids constructing an AssemblyItem just to perform the comparison.
@@ -154,11 +162,26 @@ public:
 	size_t m_modifierDepth = 0;
 
 private:
+	void storeData(u256 const& _data)
+	{
+		if (_data <= std::numeric_limits<uint64_t>::max())
+		{
+			m_smallData = uint64_t(_data);
+			m_largeData.reset();
+		}
+		else
+			m_largeData = std::make_shared<u256 const>(_data);
+	}
+
 	AssemblyItemType m_type;
 	Instruction m_instruction; ///< Only valid if m_type == Operation
-	std::shared_ptr<u256> m_data; ///< Only valid if m_type != Operation
-	langutil::SourceLocation m_location;
 	JumpType m_jumpType = JumpType::Ordinary;
+	/// The data if it fits into 64 bits, stored inline so that most items do not need
+	/// any allocation. Only valid if m_type != Operation and m_largeData is not set.
+	uint64_t m_smallData = 0;
+	/// The data if it does not fit into 64 bits. It is immutable, so copies of the item share it.
+	std::shared_ptr<u256 const> m_largeData;
+	langutil::SourceLocation m_location;
 	/// Pushed value for operations with data to be determined during assembly stage,
 	/// e.g. PushSubSize, PushTag, PushSub, etc.
 	mutable std::shared_ptr<u256> m_pushedValue;
@@ -26,18 +26,63 @@
 #include <libevmasm/AssemblyItem.h>
 #include <libevmasm/SemanticInformation.h>
 
+#include <libsolutil/CommonData.h>
+
 #include <functional>
-#include <set>
+#include <unordered_map>
 
 using namespace std;
 using namespace solidity;
 using namespace solidity::evmasm;
 
+namespace
+{
+
+size_t combineHash(size_t _seed, size_t _value)
+{
+	return _seed ^ (_value + 0x9e3779b97f4a7c15ULL + (_seed << 6) + (_seed >> 2));
+}
+
+/// @returns a hash of @a _item that does not depend on the tag if the item pushes a tag.
+size_t itemHash(AssemblyItem const& _item)
+{
+	size_t hash = size_t(_item.type());
+	if (_item.type() == Operation)
+		return combineHash(hash, size_t(_item.instruction()));
+	else if (_item.type() == PushTag)
+		return hash;
+	else
+		return combineHash(hash, size_t(_item.data() & 0xffffffffffffffffULL));
+}
+
+/// @returns, for each tag in @a _items, a hash of the items of the block starting there,
+/// ignoring tags and stopping at opcodes that stop the control flow. Equal blocks have
+/// equal hashes even if they push different tags.
+vector<size_t> blockFingerprints(AssemblyItems const& _items)
+{
+	size_t const emptyBlock = 0;
+	vector<size_t> fingerprints(_items.size(), emptyBlock);
+	size_t suffix = emptyBlock;
+	for (size_t i = _items.size(); i-- > 0;)
+	{
+		AssemblyItem const& item = _items[i];
+		if (item.type() == Tag)
+			fingerprints[i] = suffix;
+		else if (SemanticInformation::altersControlFlow(item) && item != AssemblyItem{Instruction::JUMPI})
+			suffix = combineHash(itemHash(item), emptyBlock);
+		else
+			suffix = combineHash(itemHash(item), suffix);
+	}
+	return fingerprints;
+}
+
+}
+
 
 bool BlockDeduplicator::deduplicate()
 {
-	// Compares indices based on the suffix that starts there, ignoring tags and stopping at
-	// opcodes that stop the control flow.
+	// Compares blocks based on the suffix that starts at their tag, ignoring tags and stopping
+	// at opcodes that stop the control flow.
 
 	// Virtual tag that signifies "the current block" and which is used to optimise loops.
 	// We abort if this virtual tag actually exists.
@@ -48,50 +93,74 @@ bool BlockDeduplicator::deduplicate()
 	)
 		return false;
 
-	function<bool(size_t, size_t)> comparator = [&](size_t _i, size_t _j)
+	auto equalBlocks = [&](size_t _i, size_t _j)
 	{
-		if (_i == _j)
-			return false;
-
 		// To compare recursive loops, we have to already unify PushTag opcodes of the
 		// block's own tag.
-		AssemblyItem pushFirstTag{pushSelf};
-		AssemblyItem pushSecondTag{pushSelf};
-
-		if (_i < m_items.size() && m_items.at(_i).type() == Tag)
-			pushFirstTag = m_items.at(_i).pushTag();
-		if (_j < m_items.size() && m_items.at(_j).type() == Tag)
-			pushSecondTag = m_items.at(_j).pushTag();
+		AssemblyItem pushFirstTag = m_items.at(_i).pushTag();
+		AssemblyItem pushSecondTag = m_items.at(_j).pushTag();
 
 		BlockIterator first{m_items.begin() + _i, m_items.end(), &pushFirstTag, &pushSelf};
 		BlockIterator second{m_items.begin() + _j, m_items.end(), &pushSecondTag, &pushSelf};
 		BlockIterator end{m_items.end(), m_items.end()};
 
-		if (first != end && (*first).type() == Tag)
-			++first;
-		if (second != end && (*second).type() == Tag)
-			++second;
+		// Skip the tags themselves.
+		++first;
+		++second;
 
-		return std::lexicographical_compare(first, end, second, end);
+		return std::equal(first, end, second, end);
 	};
 
+	// Fingerprints of the blocks by the position of their tag. Tag references are not part of
+	// the fingerprints, so they remain valid while tags are replaced.
+	vector<size_t> fingerprints = blockFingerprints(m_items);
+
 	size_t iterations = 0;
 	for (; ; ++iterations)
 	{
-		//@todo this should probably be optimized.
-		set<size_t, function<bool(size_t, size_t)>> blocksSeen(comparator);
+		// Positions of the pushes of each tag, used to apply replacements as soon as they are found.
+		unordered_map<size_t, vector<size_t>> pushTagPositions;
+		for (size_t i = 0; i < m_items.size(); ++i)
+			if (m_items[i].type() == PushTag)
+			{
+				auto [subId, tag] = m_items[i].splitForeignPushTag();
+				if (subId == size_t(-1))
+					pushTagPositions[tag].push_back(i);
+			}
+
+		bool changed = false;
+		unordered_map<size_t, vector<size_t>> blocksSeen;
 		for (size_t i = 0; i < m_items.size(); ++i)
 		{
-			if (m_items.at(i).type() != Tag)
+			if (m_items[i].type() != Tag)
+				continue;
+			vector<size_t>& candidates = blocksSeen[fingerprints[i]];
+			auto it = find_if(candidates.begin(), candidates.end(), [&](size_t _j) { return equalBlocks(_j, i); });
+			if (it == candidates.end())
+			{
+				candidates.push_back(i);
+				continue;
+			}
+
+			u256 tag = m_items[i].data();
+			u256 replacement = m_items[*it].data();
+			m_replacedTags[tag] = replacement;
+			// Replacements of earlier iterations are applied to the representative as well.
+			for (auto next = m_replacedTags.find(replacement); next != m_replacedTags.end(); next = m_replacedTags.find(replacement))
+				replacement = next->second;
+
+			auto pushes = pushTagPositions.find(size_t(tag));
+			if (pushes == pushTagPositions.end())
 				continue;
-			auto it = blocksSeen.find(i);
-			if (it == blocksSeen.end())
-				blocksSeen.insert(i);
-			else
-				m_replacedTags[m_items.at(i).data()] = m_items.at(*it).data();
+			vector<size_t> positions = move(pushes->second);
+			pushTagPositions.erase(pushes);
+			for (size_t position: positions)
+				m_items[position].setPushTagSubIdAndTag(size_t(-1), size_t(replacement));
+			pushTagPositions[size_t(replacement)] += move(positions);
+			changed = true;
 		}
 
-		if (!applyTagReplacement(m_items, m_replacedTags))
+		if (!changed)
 			break;
 	}
 	return iterations > 0;
@@ -47,18 +47,19 @@ unsigned ConstantOptimisationMethod::optimiseConstants(
 	for (auto it: pushes)
 	{
 		AssemblyItem const& item = it.first;
-		if (item.data() < 0x100)
+		u256 const value = item.data();
+		if (value < 0x100)
 			continue;
 		Params params;
 		params.multiplicity = it.second;
 		params.isCreation = _isCreation;
 		params.runs = _runs;
 		params.evmVersion = _evmVersion;
-		LiteralMethod lit(params, item.data());
+		LiteralMethod lit(params, value);
 		bigint literalGas = lit.gasNeeded();
-		CodeCopyMethod copy(params, item.data());
+		CodeCopyMethod copy(params, value);
 		bigint copyGas = copy.gasNeeded();
-		ComputeMethod compute(params, item.data());
+		ComputeMethod compute(params, value);
 		bigint computeGas = compute.gasNeeded();
 		AssemblyItems replacement;
 		if (copyGas < literalGas && copyGas < computeGas)
@@ -72,7 +73,7 @@ unsigned ConstantOptimisationMethod::optimiseConstants(
 			optimisations++;
 		}
 		if (!replacement.empty())
-			pendingReplacements[item.data()] = replacement;
+			pendingReplacements[value] = replacement;
 	}
 	if (!pendingReplacements.empty())
 		replaceConstants(_items, pendingReplacements);
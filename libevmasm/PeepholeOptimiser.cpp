@@ -24,6 +24,8 @@
 #include <libevmasm/AssemblyItem.h>
 #include <libevmasm/SemanticInformation.h>
 
+#include <array>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::evmasm;
@@ -106,6 +108,14 @@ struct Identity: SimplePeepholeOptimizerMethod<Identity, 1>
 
 struct PushPop: SimplePeepholeOptimizerMethod<PushPop, 2>
 {
+	static bool appliesTo(AssemblyItem const& _push)
+	{
+		auto t = _push.type();
+		return
+			SemanticInformation::isDupInstruction(_push) ||
+			t == Push || t == PushString || t == PushTag || t == PushSub ||
+			t == PushSubSize || t == PushProgramSize || t == PushData || t == PushLibraryAddress;
+	}
 	static bool applySimple(AssemblyItem const& _push, AssemblyItem const& _pop, std::back_insert_iterator<AssemblyItems>)
 	{
 		auto t = _push.type();
@@ -119,6 +129,13 @@ struct PushPop: SimplePeepholeOptimizerMethod<PushPop, 2>
 
 struct OpPop: SimplePeepholeOptimizerMethod<OpPop, 2>
 {
+	static bool appliesTo(AssemblyItem const& _op)
+	{
+		if (_op.type() != Operation)
+			return false;
+		InstructionInfo info = instructionInfo(_op.instruction());
+		return info.ret == 1 && !info.sideEffects;
+	}
 	static bool applySimple(
 		AssemblyItem const& _op,
 		AssemblyItem const& _pop,
@@ -141,6 +158,7 @@ struct OpPop: SimplePeepholeOptimizerMethod<OpPop, 2>
 
 struct DoubleSwap: SimplePeepholeOptimizerMethod<DoubleSwap, 2>
 {
+	static bool appliesTo(AssemblyItem const& _s1) { return SemanticInformation::isSwapInstruction(_s1); }
 	static size_t applySimple(AssemblyItem const& _s1, AssemblyItem const& _s2, std::back_insert_iterator<AssemblyItems>)
 	{
 		return _s1 == _s2 && SemanticInformation::isSwapInstruction(_s1);
@@ -149,6 +167,7 @@ struct DoubleSwap: SimplePeepholeOptimizerMethod<DoubleSwap, 2>
 
 struct DoublePush: SimplePeepholeOptimizerMethod<DoublePush, 2>
 {
+	static bool appliesTo(AssemblyItem const& _push1) { return _push1.type() == Push; }
 	static bool applySimple(AssemblyItem const& _push1, AssemblyItem const& _push2, std::back_insert_iterator<AssemblyItems> _out)
 	{
 		if (_push1.type() == Push && _push2.type() == Push && _push1.data() == _push2.data())
@@ -164,6 +183,7 @@ struct DoublePush: SimplePeepholeOptimizerMethod<DoublePush, 2>
 
 struct CommutativeSwap: SimplePeepholeOptimizerMethod<CommutativeSwap, 2>
 {
+	static bool appliesTo(AssemblyItem const& _swap) { return _swap == Instruction::SWAP1; }
 	static bool applySimple(AssemblyItem const& _swap, AssemblyItem const& _op, std::back_insert_iterator<AssemblyItems> _out)
 	{
 		// Remove SWAP1 if following instruction is commutative
@@ -182,6 +202,7 @@ struct CommutativeSwap: SimplePeepholeOptimizerMethod<CommutativeSwap, 2>
 
 struct SwapComparison: SimplePeepholeOptimizerMethod<SwapComparison, 2>
 {
+	static bool appliesTo(AssemblyItem const& _swap) { return _swap == Instruction::SWAP1; }
 	static bool applySimple(AssemblyItem const& _swap, AssemblyItem const& _op, std::back_insert_iterator<AssemblyItems> _out)
 	{
 		static map<Instruction, Instruction> const swappableOps{
@@ -207,6 +228,7 @@ struct SwapComparison: SimplePeepholeOptimizerMethod<SwapComparison, 2>
 
 struct IsZeroIsZeroJumpI: SimplePeepholeOptimizerMethod<IsZeroIsZeroJumpI, 4>
 {
+	static bool appliesTo(AssemblyItem const& _iszero1) { return _iszero1 == Instruction::ISZERO; }
 	static size_t applySimple(
 		AssemblyItem const& _iszero1,
 		AssemblyItem const& _iszero2,
@@ -233,6 +255,7 @@ struct IsZeroIsZeroJumpI: SimplePeepholeOptimizerMethod<IsZeroIsZeroJumpI, 4>
 
 struct JumpToNext: SimplePeepholeOptimizerMethod<JumpToNext, 3>
 {
+	static bool appliesTo(AssemblyItem const& _pushTag) { return _pushTag.type() == PushTag; }
 	static size_t applySimple(
 		AssemblyItem const& _pushTag,
 		AssemblyItem const& _jump,
@@ -259,6 +282,7 @@ struct JumpToNext: SimplePeepholeOptimizerMethod<JumpToNext, 3>
 
 struct TagConjunctions: SimplePeepholeOptimizerMethod<TagConjunctions, 3>
 {
+	static bool appliesTo(AssemblyItem const& _pushTag) { return _pushTag.type() == PushTag; }
 	static bool applySimple(
 		AssemblyItem const& _pushTag,
 		AssemblyItem const& _pushConstant,
@@ -283,6 +307,7 @@ struct TagConjunctions: SimplePeepholeOptimizerMethod<TagConjunctions, 3>
 
 struct TruthyAnd: SimplePeepholeOptimizerMethod<TruthyAnd, 3>
 {
+	static bool appliesTo(AssemblyItem const& _push) { return _push.type() == Push; }
 	static bool applySimple(
 		AssemblyItem const& _push,
 		AssemblyItem const& _not,
@@ -299,22 +324,27 @@ struct TruthyAnd: SimplePeepholeOptimizerMethod<TruthyAnd, 3>
 };
 
 /// Removes everything after a JUMP (or similar) until the next JUMPDEST.
+/// Whether it applies only depends on the first two items.
 struct UnreachableCode
 {
+	static bool appliesTo(AssemblyItem const& _item)
+	{
+		return
+			_item == Instruction::JUMP ||
+			_item == Instruction::RETURN ||
+			_item == Instruction::STOP ||
+			_item == Instruction::INVALID ||
+			_item == Instruction::SELFDESTRUCT ||
+			_item == Instruction::REVERT;
+	}
+
 	static bool apply(OptimiserState& _state)
 	{
 		auto it = _state.items.begin() + _state.i;
 		auto end = _state.items.end();
 		if (it == end)
 			return false;
-		if (
-			it[0] != Instruction::JUMP &&
-			it[0] != Instruction::RETURN &&
-			it[0] != Instruction::STOP &&
-			it[0] != Instruction::INVALID &&
-			it[0] != Instruction::SELFDESTRUCT &&
-			it[0] != Instruction::REVERT
-		)
+		if (!appliesTo(it[0]))
 			return false;
 
 		size_t i = 1;
@@ -331,17 +361,54 @@ struct UnreachableCode
 	}
 };
 
-void applyMethods(OptimiserState&)
+/// Largest number of items any method inspects to decide whether it applies.
+size_t constexpr c_maxWindowSize = 4;
+
+/// Number of different kinds of items: one per opcode for operations, one per type otherwise.
+size_t constexpr c_itemKinds = 0x100 + PushDeployTimeAddress + 1;
+
+size_t itemKind(AssemblyItem const& _item)
 {
-	assertThrow(false, OptimizerException, "Peephole optimizer failed to apply identity.");
+	if (_item.type() == Operation)
+		return size_t(_item.instruction());
+	else
+		return 0x100 + size_t(_item.type());
 }
 
-template <typename Method, typename... OtherMethods>
-void applyMethods(OptimiserState& _state, Method, OtherMethods... _other)
+/// Dispatch table of the methods by the kind of the first item they can apply to.
+/// Methods are tried in the order given.
+template <typename... Methods>
+class MethodTable
 {
-	if (!Method::apply(_state))
-		applyMethods(_state, _other...);
-}
+public:
+	MethodTable()
+	{
+		static_assert(sizeof...(Methods) <= 32, "Too many peephole optimiser methods.");
+		for (size_t kind = 0; kind < c_itemKinds; ++kind)
+		{
+			AssemblyItem item = kind < 0x100 ?
+				AssemblyItem(Operation, kind) :
+				AssemblyItem(AssemblyItemType(kind - 0x100));
+			uint32_t bit = 1;
+			((m_candidates[kind] |= (Methods::appliesTo(item) ? bit : 0), bit <<= 1), ...);
+		}
+	}
+
+	/// Applies the first method that matches at the current position.
+	/// @returns false if no method applied.
+	bool apply(OptimiserState& _state) const
+	{
+		uint32_t candidates = m_candidates[itemKind(_state.items[_state.i])];
+		for (size_t index = 0; candidates; ++index, candidates >>= 1)
+			if ((candidates & 1) && m_methods[index](_state))
+				return true;
+		return false;
+	}
+
+private:
+	std::array<uint32_t, c_itemKinds> m_candidates{};
+	std::array<bool(*)(OptimiserState&), sizeof...(Methods)> m_methods{{&Methods::apply...}};
+};
 
 size_t numberOfPops(AssemblyItems const& _items)
 {
@@ -352,14 +419,40 @@ size_t numberOfPops(AssemblyItems const& _items)
 
 bool PeepholeOptimiser::optimise()
 {
+	static MethodTable<
+		PushPop, OpPop, DoublePush, DoubleSwap, CommutativeSwap, SwapComparison,
+		IsZeroIsZeroJumpI, JumpToNext, UnreachableCode,
+		TagConjunctions, TruthyAnd
+	> const methods;
+
+	// All methods failed at the items that were not modified by the previous run, so
+	// methods only need to be tried where their window includes a modified item.
+	bool const allModified = m_modified.size() != m_items.size();
+	vector<bool> modified;
+	bool afterRewrite = false;
+	size_t nextModified = 0;
+
+	m_optimisedItems.clear();
 	OptimiserState state {m_items, 0, std::back_inserter(m_optimisedItems)};
 	while (state.i < m_items.size())
-		applyMethods(
-			state,
-			PushPop(), OpPop(), DoublePush(), DoubleSwap(), CommutativeSwap(), SwapComparison(),
-			IsZeroIsZeroJumpI(), JumpToNext(), UnreachableCode(),
-			TagConjunctions(), TruthyAnd(), Identity()
-		);
+	{
+		if (!allModified)
+			while (nextModified < m_items.size() && (nextModified < state.i || !m_modified[nextModified]))
+				nextModified++;
+		size_t const outputSize = m_optimisedItems.size();
+		if ((allModified || nextModified < state.i + c_maxWindowSize) && methods.apply(state))
+		{
+			modified.resize(modified.size() + m_optimisedItems.size() - outputSize, true);
+			afterRewrite = true;
+		}
+		else
+		{
+			Identity::apply(state);
+			// An item directly following a rewrite has a new predecessor.
+			modified.push_back(afterRewrite);
+			afterRewrite = false;
+		}
+	}
 	if (m_optimisedItems.size() < m_items.size() || (
 		m_optimisedItems.size() == m_items.size() && (
 			evmasm::bytesRequired(m_optimisedItems, 3) < evmasm::bytesRequired(m_items, 3) ||
@@ -368,6 +461,7 @@ bool PeepholeOptimiser::optimise()
 	))
 	{
 		m_items = std::move(m_optimisedItems);
+		m_modified = std::move(modified);
 		return true;
 	}
 	else
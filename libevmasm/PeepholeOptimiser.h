@@ -43,11 +43,17 @@ public:
 	explicit PeepholeOptimiser(AssemblyItems& _items): m_items(_items) {}
 	virtual ~PeepholeOptimiser() = default;
 
+	/// Runs all optimisation methods once over the items.
+	/// Repeated calls only match again around the changes of the previous call, so the
+	/// items must not be modified in between by anything else.
+	/// @returns true iff the items were changed.
 	bool optimise();
 
 private:
 	AssemblyItems& m_items;
 	AssemblyItems m_optimisedItems;
+	/// For each item, whether it was changed or moved next to a new item by the last run.
+	std::vector<bool> m_modified;
 };
 
 }
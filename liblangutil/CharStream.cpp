@@ -93,10 +93,10 @@ string CharStream::lineAtPosition(int _position) const
 		lineStart = 0;
 	else
 		lineStart++;
-	string line = m_source.substr(
+	string line(m_source.substr(
 		lineStart,
 		min(m_source.find('\n', lineStart), m_source.size()) - lineStart
-	);
+	));
 	if (!line.empty() && line.back() == '\r')
 		line.pop_back();
 	return line;
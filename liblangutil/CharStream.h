@@ -52,8 +52,11 @@
 
 #pragma once
 
+#include <liblangutil/SourceBuffer.h>
+
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <tuple>
 
 namespace solidity::langutil
@@ -68,13 +71,21 @@ class CharStream
 {
 public:
 	CharStream() = default;
-	explicit CharStream(std::string const& _source, std::string const& name):
-		m_source(_source), m_name(name) {}
+	explicit CharStream(std::string _source, std::string const& name):
+		CharStream(SourceBuffer(std::move(_source)), name) {}
+	/// Creates a stream reading from @a _source without copying it.
+	explicit CharStream(SourceBuffer _source, std::string const& name):
+		m_buffer(std::move(_source)), m_source(m_buffer.view()), m_name(name) {}
 
 	int position() const { return m_position; }
 	bool isPastEndOfInput(size_t _charsForward = 0) const { return (m_position + _charsForward) >= m_source.size(); }
 
-	char get(size_t _charsForward = 0) const { return m_source[m_position + _charsForward]; }
+	/// @returns the character @a _charsForward characters ahead or zero beyond the end of input.
+	char get(size_t _charsForward = 0) const
+	{
+		size_t position = m_position + _charsForward;
+		return position < m_source.size() ? m_source[position] : 0;
+	}
 	char advanceAndGet(size_t _chars = 1);
 	/// Sets scanner position to @ _amount characters backwards in source text.
 	/// @returns The character of the current location after update is returned.
@@ -86,7 +97,8 @@ public:
 
 	void reset() { m_position = 0; }
 
-	std::string const& source() const noexcept { return m_source; }
+	std::string_view source() const noexcept { return m_source; }
+	SourceBuffer const& buffer() const noexcept { return m_buffer; }
 	std::string const& name() const noexcept { return m_name; }
 
 	///@{
@@ -98,7 +110,9 @@ public:
 	///@}
 
 private:
-	std::string m_source;
+	SourceBuffer m_buffer;
+	/// View of the contents of m_buffer.
+	std::string_view m_source;
 	std::string m_name;
 	size_t m_position{0};
 };
@@ -133,6 +133,7 @@ private:
 void Scanner::reset(CharStream _source)
 {
 	m_source = make_shared<CharStream>(std::move(_source));
+	m_sourceIndex = SourceRegistry::add(m_source);
 	reset();
 }
 
@@ -140,6 +141,7 @@ void Scanner::reset(shared_ptr<CharStream> _source)
 {
 	solAssert(_source.get() != nullptr, "You MUST provide a CharStream when resetting.");
 	m_source = std::move(_source);
+	m_sourceIndex = SourceRegistry::add(m_source);
 	reset();
 }
 
@@ -432,7 +434,7 @@ Token Scanner::scanSlash()
 		{
 			// doxygen style /// comment
 			m_skippedComments[NextNext].location.start = firstSlashPosition;
-			m_skippedComments[NextNext].location.source = m_source;
+			m_skippedComments[NextNext].location.sourceIndex = m_sourceIndex;
 			m_skippedComments[NextNext].token = Token::CommentLiteral;
 			m_skippedComments[NextNext].location.end = scanSingleLineDocComment();
 			return Token::Whitespace;
@@ -458,7 +460,7 @@ Token Scanner::scanSlash()
 			// we actually have a multiline documentation comment
 			Token comment;
 			m_skippedComments[NextNext].location.start = firstSlashPosition;
-			m_skippedComments[NextNext].location.source = m_source;
+			m_skippedComments[NextNext].location.sourceIndex = m_sourceIndex;
 			comment = scanMultiLineDocComment();
 			m_skippedComments[NextNext].location.end = sourcePos();
 			m_skippedComments[NextNext].token = comment;
@@ -684,7 +686,7 @@ void Scanner::scanToken()
 	}
 	while (token == Token::Whitespace);
 	m_tokens[NextNext].location.end = sourcePos();
-	m_tokens[NextNext].location.source = m_source;
+	m_tokens[NextNext].location.sourceIndex = m_sourceIndex;
 	m_tokens[NextNext].token = token;
 	m_tokens[NextNext].extendedTokenInfo = make_tuple(m, n);
 }
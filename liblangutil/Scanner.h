@@ -95,7 +95,7 @@ public:
 	explicit Scanner(std::shared_ptr<CharStream> _source) { reset(std::move(_source)); }
 	explicit Scanner(CharStream _source = CharStream()) { reset(std::move(_source)); }
 
-	std::string const& source() const noexcept { return m_source->source(); }
+	std::string_view source() const noexcept { return m_source->source(); }
 
 	std::shared_ptr<CharStream> charStream() noexcept { return m_source; }
 	std::shared_ptr<CharStream const> charStream() const noexcept { return m_source; }
@@ -256,6 +256,8 @@ private:
 	TokenDesc m_tokens[3] = {}; // desc for the current, next and nextnext token
 
 	std::shared_ptr<CharStream> m_source;
+	/// Index of m_source in the SourceRegistry, used for the locations of the tokens.
+	uint32_t m_sourceIndex = 0;
 
 	/// one character look-ahead, equals 0 at end of input
 	char m_char;
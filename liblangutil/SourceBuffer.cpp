@@ -0,0 +1,97 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Immutable, shared contents of a source.
+ */
+
+#include <liblangutil/SourceBuffer.h>
+
+#include <libsolutil/CommonIO.h>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::langutil;
+
+namespace
+{
+
+#if !defined(_WIN32)
+/// Read-only memory mapping of a file, unmapped on destruction.
+class MappedFile
+{
+public:
+	MappedFile(void* _address, size_t _size): m_address(_address), m_size(_size) {}
+	~MappedFile() { munmap(m_address, m_size); }
+	MappedFile(MappedFile const&) = delete;
+	MappedFile& operator=(MappedFile const&) = delete;
+
+	char const* data() const { return static_cast<char const*>(m_address); }
+
+private:
+	void* m_address;
+	size_t m_size;
+};
+
+/// @returns a buffer mapping the file @a _path or an empty buffer if the file cannot be mapped.
+SourceBuffer mapFile(string const& _path)
+{
+	int fd = open(_path.c_str(), O_RDONLY);
+	if (fd < 0)
+		return {};
+	struct stat status;
+	void* address = MAP_FAILED;
+	size_t size = 0;
+	if (fstat(fd, &status) == 0 && S_ISREG(status.st_mode) && status.st_size > 0)
+	{
+		size = size_t(status.st_size);
+		address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	}
+	// The mapping stays valid after the file is closed.
+	close(fd);
+	if (address == MAP_FAILED)
+		return {};
+	auto mapping = make_shared<MappedFile const>(address, size);
+	return SourceBuffer(string_view(mapping->data(), size), mapping);
+}
+#endif
+
+}
+
+SourceBuffer::SourceBuffer(string _contents)
+{
+	auto owner = make_shared<string const>(move(_contents));
+	m_contents = *owner;
+	m_owner = move(owner);
+}
+
+SourceBuffer SourceBuffer::fromFile(string const& _path)
+{
+#if !defined(_WIN32)
+	SourceBuffer mapped = mapFile(_path);
+	if (!mapped.empty())
+		return mapped;
+#endif
+	// Empty files, special files and platforms without mmap.
+	return SourceBuffer(util::readFileAsString(_path));
+}
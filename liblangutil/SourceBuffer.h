@@ -0,0 +1,68 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Immutable, shared contents of a source.
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace solidity::langutil
+{
+
+/**
+ * Immutable contents of a source that can be shared without copying them, e.g. between
+ * the scanner, the compiler stack and the metadata.
+ *
+ * A buffer is a view of the contents together with a reference to their owner, which keeps
+ * them alive. The owner can be a string, a memory mapped file or memory provided by a caller.
+ * Copying a buffer only copies the reference.
+ */
+class SourceBuffer
+{
+public:
+	SourceBuffer() = default;
+	/// Takes ownership of @a _contents without copying them.
+	explicit SourceBuffer(std::string _contents);
+	/// Refers to @a _contents, which remain valid and unchanged as long as @a _owner exists.
+	SourceBuffer(std::string_view _contents, std::shared_ptr<void const> _owner):
+		m_contents(_contents), m_owner(std::move(_owner)) {}
+
+	/// @returns a buffer with the contents of the file @a _path or an empty buffer if it cannot be read.
+	/// The file is memory mapped if the platform supports it, so it must not be modified
+	/// as long as the buffer or any of its copies exist.
+	static SourceBuffer fromFile(std::string const& _path);
+
+	std::string_view view() const noexcept { return m_contents; }
+	char const* data() const noexcept { return m_contents.data(); }
+	size_t size() const noexcept { return m_contents.size(); }
+	bool empty() const noexcept { return m_contents.empty(); }
+	/// @returns a copy of the contents.
+	std::string str() const { return std::string(m_contents); }
+
+private:
+	std::string_view m_contents;
+	std::shared_ptr<void const> m_owner;
+};
+
+using SourceBufferMap = std::map<std::string, SourceBuffer>;
+
+}
@@ -42,10 +42,8 @@ SourceLocation const parseSourceLocation(std::string const& _input, std::string
 	int start = stoi(pos[Start]);
 	int end = start + stoi(pos[Length]);
 
-	// ASSUMPTION: only the name of source is used from here on, the m_source of the CharStream-Object can be empty
-	std::shared_ptr<langutil::CharStream> source = std::make_shared<langutil::CharStream>("", _sourceName);
-
-	return SourceLocation{start, end, source};
+	// ASSUMPTION: only the name of source is used from here on, its contents are not available
+	return SourceLocation{start, end, SourceRegistry::addName(_sourceName)};
 }
 
 }
@@ -26,7 +26,9 @@
 #include <libsolutil/Exceptions.h>
 
 #include <liblangutil/CharStream.h>
+#include <liblangutil/SourceRegistry.h>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -37,55 +39,72 @@ struct SourceLocationError: virtual util::Exception {};
 /**
  * Representation of an interval of source positions.
  * The interval includes start and excludes end.
+ * The source is referred to by its index in the SourceRegistry.
  */
 struct SourceLocation
 {
+	SourceLocation() = default;
+	SourceLocation(int _start, int _end, uint32_t _sourceIndex = 0):
+		start(_start), end(_end), sourceIndex(_sourceIndex) {}
+	SourceLocation(int _start, int _end, std::shared_ptr<CharStream> const& _source):
+		start(_start), end(_end), sourceIndex(_source ? SourceRegistry::add(_source) : 0) {}
+
 	bool operator==(SourceLocation const& _other) const
 	{
-		return source.get() == _other.source.get() && start == _other.start && end == _other.end;
+		return sourceIndex == _other.sourceIndex && start == _other.start && end == _other.end;
 	}
 	bool operator!=(SourceLocation const& _other) const { return !operator==(_other); }
 
 	inline bool operator<(SourceLocation const& _other) const
 	{
-		if (!source|| !_other.source)
-			return std::make_tuple(int(!!source), start, end) < std::make_tuple(int(!!_other.source), _other.start, _other.end);
+		if (!hasSource() || !_other.hasSource())
+			return std::make_tuple(int(hasSource()), start, end) < std::make_tuple(int(_other.hasSource()), _other.start, _other.end);
+		else if (sourceIndex == _other.sourceIndex)
+			return std::make_tuple(start, end) < std::make_tuple(_other.start, _other.end);
 		else
-			return std::make_tuple(source->name(), start, end) < std::make_tuple(_other.source->name(), _other.start, _other.end);
+			return std::make_tuple(sourceName(), start, end) < std::make_tuple(_other.sourceName(), _other.start, _other.end);
 	}
 
 	inline bool contains(SourceLocation const& _other) const
 	{
-		if (!hasText() || !_other.hasText() || source.get() != _other.source.get())
+		if (!hasText() || !_other.hasText() || sourceIndex != _other.sourceIndex)
 			return false;
 		return start <= _other.start && _other.end <= end;
 	}
 
 	inline bool intersects(SourceLocation const& _other) const
 	{
-		if (!hasText() || !_other.hasText() || source.get() != _other.source.get())
+		if (!hasText() || !_other.hasText() || sourceIndex != _other.sourceIndex)
 			return false;
 		return _other.start < end && start < _other.end;
 	}
 
-	bool isValid() const { return source || start != -1 || end != -1; }
+	bool isValid() const { return hasSource() || start != -1 || end != -1; }
+
+	bool hasSource() const { return sourceIndex != 0; }
+	/// @returns the name of the source. Requires hasSource().
+	std::string const& sourceName() const { return SourceRegistry::name(sourceIndex); }
+	/// @returns the character stream of the source or nullptr if there is no source
+	/// or its contents are not available (anymore).
+	std::shared_ptr<CharStream> source() const { return SourceRegistry::charStream(sourceIndex); }
 
 	bool hasText() const
 	{
 		return
-			source &&
+			hasSource() &&
 			0 <= start &&
 			start <= end &&
-			end <= int(source->source().length());
+			size_t(end) <= SourceRegistry::length(sourceIndex);
 	}
 
 	std::string text() const
 	{
-		assertThrow(source, SourceLocationError, "Requested text from null source.");
+		std::shared_ptr<CharStream> charStream = source();
+		assertThrow(charStream, SourceLocationError, "Requested text from null source.");
 		assertThrow(0 <= start, SourceLocationError, "Invalid source location.");
 		assertThrow(start <= end, SourceLocationError, "Invalid source location.");
-		assertThrow(end <= int(source->source().length()), SourceLocationError, "Invalid source location.");
-		return source->source().substr(start, end - start);
+		assertThrow(end <= int(charStream->source().length()), SourceLocationError, "Invalid source location.");
+		return std::string(charStream->source().substr(start, end - start));
 	}
 
 	/// @returns the smallest SourceLocation that contains both @param _a and @param _b.
@@ -95,8 +114,8 @@ struct SourceLocation
 	/// @param _b, then start resp. end of the result will be -1 as well).
 	static SourceLocation smallestCovering(SourceLocation _a, SourceLocation const& _b)
 	{
-		if (!_a.source)
-			_a.source = _b.source;
+		if (!_a.hasSource())
+			_a.sourceIndex = _b.sourceIndex;
 
 		if (_a.start < 0)
 			_a.start = _b.start;
@@ -110,7 +129,7 @@ struct SourceLocation
 
 	int start = -1;
 	int end = -1;
-	std::shared_ptr<CharStream> source;
+	uint32_t sourceIndex = 0;
 };
 
 SourceLocation const parseSourceLocation(std::string const& _input, std::string const& _sourceName, size_t _maxIndex = -1);
@@ -121,8 +140,8 @@ inline std::ostream& operator<<(std::ostream& _out, SourceLocation const& _locat
 	if (!_location.isValid())
 		return _out << "NO_LOCATION_SPECIFIED";
 
-	if (_location.source)
-		_out << _location.source->name();
+	if (_location.hasSource())
+		_out << _location.sourceName();
 
 	_out << "[" << _location.start << "," << _location.end << "]";
 
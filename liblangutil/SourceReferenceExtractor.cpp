@@ -43,13 +43,12 @@ SourceReferenceExtractor::Message SourceReferenceExtractor::extract(util::Except
 
 SourceReference SourceReferenceExtractor::extract(SourceLocation const* _location, std::string message)
 {
-	if (!_location || !_location->source.get()) // Nothing we can extract here
+	if (!_location || !_location->hasSource()) // Nothing we can extract here
 		return SourceReference::MessageOnly(std::move(message));
 
-	if (!_location->hasText()) // No source text, so we can only extract the source name
-		return SourceReference::MessageOnly(std::move(message), _location->source->name());
-
-	shared_ptr<CharStream> const& source = _location->source;
+	shared_ptr<CharStream> const source = _location->source();
+	if (!source || !_location->hasText()) // No source text, so we can only extract the source name
+		return SourceReference::MessageOnly(std::move(message), _location->sourceName());
 
 	LineColumn const interest = source->translatePositionToLineColumn(_location->start);
 	LineColumn start = interest;
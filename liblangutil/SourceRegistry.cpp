@@ -0,0 +1,216 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Registry of the sources referred to by source locations.
+ */
+
+#include <liblangutil/SourceRegistry.h>
+
+#include <liblangutil/CharStream.h>
+
+#include <libsolutil/Assertions.h>
+#include <libsolutil/Exceptions.h>
+#include <libsolutil/Keccak256.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::langutil;
+
+namespace
+{
+
+struct Entry
+{
+	/// The name, the length and the hash of the contents do not change once the entry is published.
+	string name;
+	size_t length = 0;
+	util::h256 contentHash;
+	/// Character streams with this name and content that existed when they were registered.
+	/// Guarded by the lock of the registry.
+	vector<weak_ptr<CharStream>> charStreams;
+};
+
+/**
+ * Entries are stored in blocks of doubling size that never move, so that the immutable parts
+ * of published entries can be read without locking.
+ */
+struct Registry
+{
+	static size_t constexpr c_firstBlockBits = 6;
+	static size_t constexpr c_blockCount = 32 - c_firstBlockBits + 1;
+
+	mutex lock;
+	array<atomic<Entry*>, c_blockCount> blocks{};
+	/// Number of published entries, including the null entry at index zero.
+	atomic<uint32_t> size{0};
+	/// Entries by name and hash of the contents. Sources registered by name only have a zero hash.
+	map<pair<string, util::h256>, uint32_t> indexByContent;
+	/// Cache of the entries of live character streams, which avoids hashing their contents again.
+	unordered_map<CharStream const*, uint32_t> indexByCharStream;
+	/// Size of indexByCharStream after which the references to expired streams are removed.
+	size_t sweepThreshold = 64;
+
+	Registry() { append(Entry{{}, 0, util::h256(), {}}); }
+	~Registry()
+	{
+		for (size_t block = 0; block < c_blockCount; ++block)
+			delete[] blocks[block].load();
+	}
+
+	static pair<size_t, size_t> position(uint32_t _index)
+	{
+		uint64_t const shifted = uint64_t(_index) + (uint64_t(1) << c_firstBlockBits);
+		size_t bits = 0;
+		while ((shifted >> (bits + 1)) != 0)
+			++bits;
+		return {bits - c_firstBlockBits, size_t(shifted - (uint64_t(1) << bits))};
+	}
+
+	/// Requires the lock to be held.
+	uint32_t append(Entry _entry)
+	{
+		uint32_t const index = size.load(memory_order_relaxed);
+		assertThrow(index < numeric_limits<uint32_t>::max(), util::Exception, "Too many sources.");
+		auto [block, offset] = position(index);
+		if (!blocks[block].load(memory_order_relaxed))
+			blocks[block].store(new Entry[size_t(1) << (block + c_firstBlockBits)], memory_order_relaxed);
+		blocks[block].load(memory_order_relaxed)[offset] = move(_entry);
+		size.store(index + 1, memory_order_release);
+		return index;
+	}
+
+	Entry& entry(uint32_t _index)
+	{
+		assertThrow(
+			0 < _index && _index < size.load(memory_order_acquire),
+			util::Exception,
+			"Invalid source index."
+		);
+		auto [block, offset] = position(_index);
+		return blocks[block].load(memory_order_relaxed)[offset];
+	}
+
+	/// Drops the references to character streams that no longer exist. Requires the lock to be held.
+	void sweep()
+	{
+		for (auto it = indexByCharStream.begin(); it != indexByCharStream.end();)
+		{
+			vector<weak_ptr<CharStream>>& streams = entry(it->second).charStreams;
+			streams.erase(
+				remove_if(streams.begin(), streams.end(), [](auto const& _stream) { return _stream.expired(); }),
+				streams.end()
+			);
+			if (streams.empty())
+				it = indexByCharStream.erase(it);
+			else
+				++it;
+		}
+		sweepThreshold = max<size_t>(64, 2 * indexByCharStream.size());
+	}
+};
+
+Registry& registry()
+{
+	static Registry s_registry;
+	return s_registry;
+}
+
+bool contains(vector<weak_ptr<CharStream>> const& _streams, shared_ptr<CharStream> const& _stream)
+{
+	return any_of(_streams.begin(), _streams.end(), [&](auto const& _other) { return _other.lock() == _stream; });
+}
+
+}
+
+uint32_t SourceRegistry::add(shared_ptr<CharStream> const& _source)
+{
+	assertThrow(_source, util::Exception, "");
+	Registry& r = registry();
+	{
+		lock_guard<mutex> guard(r.lock);
+		auto it = r.indexByCharStream.find(_source.get());
+		// The address could belong to a character stream that no longer exists.
+		if (it != r.indexByCharStream.end() && contains(r.entry(it->second).charStreams, _source))
+			return it->second;
+	}
+
+	string_view const contents = _source->source();
+	util::h256 const contentHash = util::keccak256(bytesConstRef(
+		reinterpret_cast<uint8_t const*>(contents.data()),
+		contents.size()
+	));
+
+	lock_guard<mutex> guard(r.lock);
+	auto [it, inserted] = r.indexByContent.emplace(make_pair(_source->name(), contentHash), 0);
+	if (inserted)
+		it->second = r.append(Entry{_source->name(), contents.size(), contentHash, {}});
+	uint32_t const index = it->second;
+	vector<weak_ptr<CharStream>>& streams = r.entry(index).charStreams;
+	if (!contains(streams, _source))
+	{
+		streams.erase(
+			remove_if(streams.begin(), streams.end(), [](auto const& _stream) { return _stream.expired(); }),
+			streams.end()
+		);
+		streams.emplace_back(_source);
+	}
+	r.indexByCharStream[_source.get()] = index;
+	if (r.indexByCharStream.size() > r.sweepThreshold)
+		r.sweep();
+	return index;
+}
+
+uint32_t SourceRegistry::addName(string const& _name)
+{
+	Registry& r = registry();
+	lock_guard<mutex> guard(r.lock);
+	auto [it, inserted] = r.indexByContent.emplace(make_pair(_name, util::h256()), 0);
+	if (inserted)
+		it->second = r.append(Entry{_name, 0, util::h256(), {}});
+	return it->second;
+}
+
+shared_ptr<CharStream> SourceRegistry::charStream(uint32_t _index)
+{
+	if (_index == 0)
+		return nullptr;
+	Registry& r = registry();
+	lock_guard<mutex> guard(r.lock);
+	for (weak_ptr<CharStream> const& stream: r.entry(_index).charStreams)
+		if (shared_ptr<CharStream> charStream = stream.lock())
+			return charStream;
+	return nullptr;
+}
+
+string const& SourceRegistry::name(uint32_t _index)
+{
+	return registry().entry(_index).name;
+}
+
+size_t SourceRegistry::length(uint32_t _index)
+{
+	return registry().entry(_index).length;
+}
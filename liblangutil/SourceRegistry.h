@@ -0,0 +1,68 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Registry of the sources referred to by source locations.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace solidity::langutil
+{
+
+class CharStream;
+
+/**
+ * Process-wide registry of the sources that source locations refer to.
+ *
+ * Source locations store the index of their source in this registry instead of a pointer
+ * to the source, so that they are small and cheap to copy. Index zero refers to no source.
+ *
+ * The registry only stores the name, the length and the hash of the contents of a source
+ * and weak references to its character streams. The character streams remain owned by
+ * the scanners of the compilation, so their contents are only available while those exist.
+ * Character streams with the same name and contents share an index, so that compiling
+ * the same code again, e.g. in server mode or for the same code generator snippet,
+ * does not add entries. References to character streams that no longer exist are
+ * dropped, but the names are kept for the lifetime of the process.
+ *
+ * Names and lengths can be looked up without locking.
+ */
+class SourceRegistry
+{
+public:
+	/// @returns the index of @a _source, registers it if no source with the same name and
+	/// contents is registered yet. @a _source must not be null.
+	static uint32_t add(std::shared_ptr<CharStream> const& _source);
+	/// @returns the index of a source that is only known by its name, e.g. because it was
+	/// imported from JSON. Returns the same index for the same name.
+	static uint32_t addName(std::string const& _name);
+
+	/// @returns a character stream with the given index, or nullptr if @a _index is zero,
+	/// the source was registered by name only or all its character streams no longer exist.
+	static std::shared_ptr<CharStream> charStream(uint32_t _index);
+	/// @returns the name of the source with the given index, which must not be zero.
+	static std::string const& name(uint32_t _index);
+	/// @returns the length of the source with the given index, which must not be zero.
+	/// Sources registered by name only have length zero.
+	static size_t length(uint32_t _index);
+};
+
+}
@@ -69,7 +69,7 @@ void SyntaxChecker::endVisit(SourceUnit const& _sourceUnit)
 				string(";\"");
 
 		// when reporting the warning, print the source name only
-		m_errorReporter.warning({-1, -1, _sourceUnit.location().source}, errorString);
+		m_errorReporter.warning({-1, -1, _sourceUnit.location().sourceIndex}, errorString);
 	}
 	m_sourceUnit = nullptr;
 }
@@ -130,8 +130,8 @@ void ASTJsonConverter::setJsonNode(
 
 size_t ASTJsonConverter::sourceIndexFromLocation(SourceLocation const& _location) const
 {
-	if (_location.source && m_sourceIndices.count(_location.source->name()))
-		return m_sourceIndices.at(_location.source->name());
+	if (_location.hasSource() && m_sourceIndices.count(_location.sourceName()))
+		return m_sourceIndices.at(_location.sourceName());
 	else
 		return size_t(-1);
 }
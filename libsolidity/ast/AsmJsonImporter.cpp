@@ -55,7 +55,7 @@ T AsmJsonImporter::createAsmNode(Json::Value const& _node)
 	T r;
 	r.location = createSourceLocation(_node);
 	astAssert(
-		r.location.source && 0 <= r.location.start && r.location.start <= r.location.end,
+		r.location.hasSource() && 0 <= r.location.start && r.location.start <= r.location.end,
 		"Invalid source location in Asm AST"
 	);
 	return r;
@@ -129,17 +129,17 @@ yul::Expression AsmJsonImporter::createExpression(Json::Value const& _node)
 		astAssert(false, "Invalid nodeType as expression");
 }
 
-vector<yul::Expression> AsmJsonImporter::createExpressionVector(Json::Value const& _array)
+yul::ASTVector<yul::Expression> AsmJsonImporter::createExpressionVector(Json::Value const& _array)
 {
-	vector<yul::Expression> ret;
+	yul::ASTVector<yul::Expression> ret;
 	for (auto& var: _array)
 		ret.emplace_back(createExpression(var));
 	return ret;
 }
 
-vector<yul::Statement> AsmJsonImporter::createStatementVector(Json::Value const& _array)
+yul::ASTVector<yul::Statement> AsmJsonImporter::createStatementVector(Json::Value const& _array)
 {
-	vector<yul::Statement> ret;
+	yul::ASTVector<yul::Statement> ret;
 	for (auto& var: _array)
 		ret.emplace_back(createStatement(var));
 	return ret;
@@ -213,7 +213,7 @@ yul::Assignment AsmJsonImporter::createAssignment(Json::Value const& _node)
 		for (auto const& var: member(_node, "variableNames"))
 			assignment.variableNames.emplace_back(createIdentifier(var));
 
-	assignment.value = make_unique<yul::Expression>(createExpression(member(_node, "value")));
+	assignment.value = yul::makeASTNode<yul::Expression>(createExpression(member(_node, "value")));
 	return assignment;
 }
 
@@ -241,7 +241,7 @@ yul::VariableDeclaration AsmJsonImporter::createVariableDeclaration(Json::Value
 	auto varDec = createAsmNode<yul::VariableDeclaration>(_node);
 	for (auto const& var: member(_node, "variables"))
 		varDec.variables.emplace_back(createTypedName(var));
-	varDec.value = make_unique<yul::Expression>(createExpression(member(_node, "value")));
+	varDec.value = yul::makeASTNode<yul::Expression>(createExpression(member(_node, "value")));
 	return varDec;
 }
 
@@ -265,7 +265,7 @@ yul::FunctionDefinition AsmJsonImporter::createFunctionDefinition(Json::Value co
 yul::If AsmJsonImporter::createIf(Json::Value const& _node)
 {
 	auto ifStatement = createAsmNode<yul::If>(_node);
-	ifStatement.condition = make_unique<yul::Expression>(createExpression(member(_node, "condition")));
+	ifStatement.condition = yul::makeASTNode<yul::Expression>(createExpression(member(_node, "condition")));
 	ifStatement.body = createBlock(member(_node, "body"));
 	return ifStatement;
 }
@@ -277,7 +277,7 @@ yul::Case AsmJsonImporter::createCase(Json::Value const& _node)
 	if (value.isString())
 		astAssert(value.asString() == "default", "Expected default case");
 	else
-		caseStatement.value = make_unique<yul::Literal>(createLiteral(value));
+		caseStatement.value = yul::makeASTNode<yul::Literal>(createLiteral(value));
 	caseStatement.body = createBlock(member(_node, "body"));
 	return caseStatement;
 }
@@ -285,7 +285,7 @@ yul::Case AsmJsonImporter::createCase(Json::Value const& _node)
 yul::Switch AsmJsonImporter::createSwitch(Json::Value const& _node)
 {
 	auto switchStatement = createAsmNode<yul::Switch>(_node);
-	switchStatement.expression = make_unique<yul::Expression>(createExpression(member(_node, "expression")));
+	switchStatement.expression = yul::makeASTNode<yul::Expression>(createExpression(member(_node, "expression")));
 	for (auto const& var: member(_node, "cases"))
 		switchStatement.cases.emplace_back(createCase(var));
 	return switchStatement;
@@ -295,7 +295,7 @@ yul::ForLoop AsmJsonImporter::createForLoop(Json::Value const& _node)
 {
 	auto forLoop = createAsmNode<yul::ForLoop>(_node);
 	forLoop.pre = createBlock(member(_node, "pre"));
-	forLoop.condition = make_unique<yul::Expression>(createExpression(member(_node, "condition")));
+	forLoop.condition = yul::makeASTNode<yul::Expression>(createExpression(member(_node, "condition")));
 	forLoop.post = createBlock(member(_node, "post"));
 	forLoop.body = createBlock(member(_node, "body"));
 	return forLoop;
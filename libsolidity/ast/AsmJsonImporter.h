@@ -48,8 +48,8 @@ private:
 
 	yul::Statement createStatement(Json::Value const& _node);
 	yul::Expression createExpression(Json::Value const& _node);
-	std::vector<yul::Statement> createStatementVector(Json::Value const& _array);
-	std::vector<yul::Expression> createExpressionVector(Json::Value const& _array);
+	yul::ASTVector<yul::Statement> createStatementVector(Json::Value const& _array);
+	yul::ASTVector<yul::Expression> createExpressionVector(Json::Value const& _array);
 
 	yul::TypedName createTypedName(Json::Value const& _node);
 	yul::Literal createLiteral(Json::Value const& _node);
@@ -20,6 +20,8 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/split.hpp>
 
+#include <utility>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::frontend;
@@ -173,7 +175,45 @@ inline void clearCaches(Container& container)
 		clearCache(e);
 }
 
+namespace
+{
+/// The provider selected via TypeProvider::setInstance.
+TypeProvider* currentTypeProvider = nullptr;
+}
+
+TypeProvider::~TypeProvider()
+{
+	lock_guard<recursive_mutex> lock(Type::cacheMutex());
+	if (currentTypeProvider == this)
+		currentTypeProvider = nullptr;
+	clear();
+}
+
+TypeProvider* TypeProvider::setInstance(TypeProvider* _provider)
+{
+	lock_guard<recursive_mutex> lock(Type::cacheMutex());
+	return exchange(currentTypeProvider, _provider);
+}
+
+TypeProvider& TypeProvider::instance()
+{
+	solAssert(currentTypeProvider, "No TypeProvider selected.");
+	return *currentTypeProvider;
+}
+
 void TypeProvider::reset()
+{
+	lock_guard<recursive_mutex> lock(Type::cacheMutex());
+	instance().clear();
+}
+
+size_t TypeProvider::typeCount()
+{
+	lock_guard<recursive_mutex> lock(Type::cacheMutex());
+	return instance().m_types.size() + instance().m_locationCopies.size();
+}
+
+void TypeProvider::clear()
 {
 	clearCache(m_boolean);
 	clearCache(m_inaccessibleDynamic);
@@ -185,22 +225,71 @@ void TypeProvider::reset()
 	clearCache(m_emptyTuple);
 	clearCache(m_payableAddress);
 	clearCache(m_address);
-	clearCaches(instance().m_intM);
-	clearCaches(instance().m_uintM);
-	clearCaches(instance().m_bytesM);
-	clearCaches(instance().m_magics);
-
-	instance().m_generalTypes.clear();
-	instance().m_stringLiteralTypes.clear();
-	instance().m_ufixedMxN.clear();
-	instance().m_fixedMxN.clear();
+	clearCaches(m_intM);
+	clearCaches(m_uintM);
+	clearCaches(m_bytesM);
+	clearCaches(m_magics);
+
+	m_ufixedMxN.clear();
+	m_fixedMxN.clear();
+	m_stringLiteralTypes.clear();
+	m_tupleTypes.clear();
+	m_locationCopies.clear();
+	m_declarationFunctionTypes.clear();
+	m_plainFunctionTypes.clear();
+	m_customFunctionTypes.clear();
+	m_rationalNumberTypes.clear();
+	m_arrayTypes.clear();
+	m_arraySliceTypes.clear();
+	m_contractTypes.clear();
+	m_enumTypes.clear();
+	m_moduleTypes.clear();
+	m_typeTypes.clear();
+	m_structTypes.clear();
+	m_modifierTypes.clear();
+	m_metaTypes.clear();
+	m_mappingTypes.clear();
+
+	for (auto type = m_types.rbegin(); type != m_types.rend(); ++type)
+		(*type)->~Type();
+	m_types.clear();
+	m_arenaBlocks.clear();
+	m_arenaBlockUsage = c_arenaBlockSize;
 }
 
 template <typename T, typename... Args>
-inline T const* TypeProvider::createAndGet(Args&& ... _args)
+T const* TypeProvider::create(Args&& ... _args)
+{
+	static_assert(alignof(T) <= alignof(max_align_t), "Types cannot be over-aligned.");
+	static_assert(sizeof(T) <= c_arenaBlockSize, "Type does not fit into an arena block.");
+	size_t const size = (sizeof(T) + alignof(max_align_t) - 1) / alignof(max_align_t) * alignof(max_align_t);
+	if (m_arenaBlockUsage + size > c_arenaBlockSize)
+	{
+		m_arenaBlocks.emplace_back(new char[c_arenaBlockSize]);
+		m_arenaBlockUsage = 0;
+	}
+	// Reserve the memory before calling the constructor, which might request other types.
+	char* memory = m_arenaBlocks.back().get() + m_arenaBlockUsage;
+	m_arenaBlockUsage += size;
+	T* type = new (memory) T(std::forward<Args>(_args)...);
+	m_types.push_back(type);
+	return type;
+}
+
+template <typename T, typename Key, typename... Args>
+T const* TypeProvider::createAndGet(
+	map<Key, T const*> TypeProvider::* _types,
+	typename map<Key, T const*>::key_type _key,
+	Args&& ... _args
+)
 {
-	instance().m_generalTypes.emplace_back(make_unique<T>(std::forward<Args>(_args)...));
-	return static_cast<T const*>(instance().m_generalTypes.back().get());
+	lock_guard<recursive_mutex> lock(Type::cacheMutex());
+	TypeProvider& provider = instance();
+	auto it = (provider.*_types).find(_key);
+	if (it != (provider.*_types).end())
+		return it->second;
+	T const* type = provider.create<T>(std::forward<Args>(_args)...);
+	return (provider.*_types).emplace(move(_key), type).first->second;
 }
 
 Type const* TypeProvider::fromElementaryTypeName(ElementaryTypeNameToken const& _type, std::optional<StateMutability> _stateMutability)
@@ -305,6 +394,7 @@ TypePointer TypeProvider::fromElementaryTypeName(string const& _name)
 
 ArrayType const* TypeProvider::bytesStorage()
 {
+	lock_guard<recursive_mutex> lock(Type::cacheMutex());
 	if (!m_bytesStorage)
 		m_bytesStorage = make_unique<ArrayType>(DataLocation::Storage, false);
 	return m_bytesStorage.get();
@@ -312,6 +402,7 @@ ArrayType const* TypeProvider::bytesStorage()
 
 ArrayType const* TypeProvider::bytesMemory()
 {
+	lock_guard<recursive_mutex> lock(Type::cacheMutex());
 	if (!m_bytesMemory)
 		m_bytesMemory = make_unique<ArrayType>(DataLocation::Memory, false);
 	return m_bytesMemory.get();
@@ -319,6 +410,7 @@ ArrayType const* TypeProvider::bytesMemory()
 
 ArrayType const* TypeProvider::bytesCalldata()
 {
+	lock_guard<recursive_mutex> lock(Type::cacheMutex());
 	if (!m_bytesCalldata)
 		m_bytesCalldata = make_unique<ArrayType>(DataLocation::CallData, false);
 	return m_bytesCalldata.get();
@@ -326,6 +418,7 @@ ArrayType const* TypeProvider::bytesCalldata()
 
 ArrayType const* TypeProvider::stringStorage()
 {
+	lock_guard<recursive_mutex> lock(Type::cacheMutex());
 	if (!m_stringStorage)
 		m_stringStorage = make_unique<ArrayType>(DataLocation::Storage, true);
 	return m_stringStorage.get();
@@ -333,6 +426,7 @@ ArrayType const* TypeProvider::stringStorage()
 
 ArrayType const* TypeProvider::stringMemory()
 {
+	lock_guard<recursive_mutex> lock(Type::cacheMutex());
 	if (!m_stringMemory)
 		m_stringMemory = make_unique<ArrayType>(DataLocation::Memory, true);
 	return m_stringMemory.get();
@@ -376,25 +470,18 @@ RationalNumberType const* TypeProvider::rationalNumber(Literal const& _literal)
 
 StringLiteralType const* TypeProvider::stringLiteral(string const& literal)
 {
-	auto i = instance().m_stringLiteralTypes.find(literal);
-	if (i != instance().m_stringLiteralTypes.end())
-		return i->second.get();
-	else
-		return instance().m_stringLiteralTypes.emplace(literal, make_unique<StringLiteralType>(literal)).first->second.get();
+	return createAndGet(&TypeProvider::m_stringLiteralTypes, literal, literal);
 }
 
 FixedPointType const* TypeProvider::fixedPoint(unsigned m, unsigned n, FixedPointType::Modifier _modifier)
 {
-	auto& map = _modifier == FixedPointType::Modifier::Unsigned ? instance().m_ufixedMxN : instance().m_fixedMxN;
-
-	auto i = map.find(make_pair(m, n));
-	if (i != map.end())
-		return i->second.get();
-
-	return map.emplace(
+	return createAndGet(
+		_modifier == FixedPointType::Modifier::Unsigned ? &TypeProvider::m_ufixedMxN : &TypeProvider::m_fixedMxN,
 		make_pair(m, n),
-		make_unique<FixedPointType>(m, n, _modifier)
-	).first->second.get();
+		m,
+		n,
+		_modifier
+	);
 }
 
 TupleType const* TypeProvider::tuple(vector<Type const*> members)
@@ -402,7 +489,7 @@ TupleType const* TypeProvider::tuple(vector<Type const*> members)
 	if (members.empty())
 		return &m_emptyTuple;
 
-	return createAndGet<TupleType>(move(members));
+	return createAndGet(&TypeProvider::m_tupleTypes, members, members);
 }
 
 ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, DataLocation _location, bool _isPointer)
@@ -410,28 +497,39 @@ ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, Data
 	if (_type->location() == _location && _type->isPointer() == _isPointer)
 		return _type;
 
-	instance().m_generalTypes.emplace_back(_type->copyForLocation(_location, _isPointer));
-	return static_cast<ReferenceType const*>(instance().m_generalTypes.back().get());
+	lock_guard<recursive_mutex> lock(Type::cacheMutex());
+	unique_ptr<ReferenceType>& copy = instance().m_locationCopies[make_tuple(_type, _location, _isPointer)];
+	if (!copy)
+		copy = _type->copyForLocation(_location, _isPointer);
+	return copy.get();
 }
 
 FunctionType const* TypeProvider::function(FunctionDefinition const& _function, FunctionType::Kind _kind)
 {
-	return createAndGet<FunctionType>(_function, _kind);
+	return createAndGet(&TypeProvider::m_declarationFunctionTypes, make_pair(&_function, _kind), _function, _kind);
 }
 
 FunctionType const* TypeProvider::function(VariableDeclaration const& _varDecl)
 {
-	return createAndGet<FunctionType>(_varDecl);
+	return createAndGet(
+		&TypeProvider::m_declarationFunctionTypes,
+		make_pair(&_varDecl, FunctionType::Kind::External),
+		_varDecl
+	);
 }
 
 FunctionType const* TypeProvider::function(EventDefinition const& _def)
 {
-	return createAndGet<FunctionType>(_def);
+	return createAndGet(&TypeProvider::m_declarationFunctionTypes, make_pair(&_def, FunctionType::Kind::Event), _def);
 }
 
 FunctionType const* TypeProvider::function(FunctionTypeName const& _typeName)
 {
-	return createAndGet<FunctionType>(_typeName);
+	return createAndGet(
+		&TypeProvider::m_declarationFunctionTypes,
+		make_pair(&_typeName, FunctionType::Kind::Declaration),
+		_typeName
+	);
 }
 
 FunctionType const* TypeProvider::function(
@@ -442,7 +540,9 @@ FunctionType const* TypeProvider::function(
 	StateMutability _stateMutability
 )
 {
-	return createAndGet<FunctionType>(
+	return createAndGet(
+		&TypeProvider::m_plainFunctionTypes,
+		make_tuple(_parameterTypes, _returnParameterTypes, _kind, _arbitraryParameters, _stateMutability),
 		_parameterTypes, _returnParameterTypes,
 		_kind, _arbitraryParameters, _stateMutability
 	);
@@ -463,7 +563,22 @@ FunctionType const* TypeProvider::function(
 	bool _saltSet
 )
 {
-	return createAndGet<FunctionType>(
+	return createAndGet(
+		&TypeProvider::m_customFunctionTypes,
+		make_tuple(
+			_parameterTypes,
+			_returnParameterTypes,
+			_parameterNames,
+			_returnParameterNames,
+			_kind,
+			_arbitraryParameters,
+			_stateMutability,
+			_declaration,
+			_gasSet,
+			_valueSet,
+			_bound,
+			_saltSet
+		),
 		_parameterTypes,
 		_returnParameterTypes,
 		_parameterNames,
@@ -481,7 +596,12 @@ FunctionType const* TypeProvider::function(
 
 RationalNumberType const* TypeProvider::rationalNumber(rational const& _value, Type const* _compatibleBytesType)
 {
-	return createAndGet<RationalNumberType>(_value, _compatibleBytesType);
+	return createAndGet(
+		&TypeProvider::m_rationalNumberTypes,
+		make_pair(_value, _compatibleBytesType),
+		_value,
+		_compatibleBytesType
+	);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
@@ -500,52 +620,63 @@ ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
 		if (_location == DataLocation::Memory)
 			return bytesMemory();
 	}
-	return createAndGet<ArrayType>(_location, _isString);
+	return createAndGet(
+		&TypeProvider::m_arrayTypes,
+		make_tuple(_location, _isString, nullptr, nullopt),
+		_location,
+		_isString
+	);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType)
 {
-	return createAndGet<ArrayType>(_location, _baseType);
+	return createAndGet(&TypeProvider::m_arrayTypes, make_tuple(_location, false, _baseType, nullopt), _location, _baseType);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType, u256 const& _length)
 {
-	return createAndGet<ArrayType>(_location, _baseType, _length);
+	return createAndGet(
+		&TypeProvider::m_arrayTypes,
+		make_tuple(_location, false, _baseType, _length),
+		_location,
+		_baseType,
+		_length
+	);
 }
 
 ArraySliceType const* TypeProvider::arraySlice(ArrayType const& _arrayType)
 {
-	return createAndGet<ArraySliceType>(_arrayType);
+	return createAndGet(&TypeProvider::m_arraySliceTypes, &_arrayType, _arrayType);
 }
 
 ContractType const* TypeProvider::contract(ContractDefinition const& _contractDef, bool _isSuper)
 {
-	return createAndGet<ContractType>(_contractDef, _isSuper);
+	return createAndGet(&TypeProvider::m_contractTypes, make_pair(&_contractDef, _isSuper), _contractDef, _isSuper);
 }
 
 EnumType const* TypeProvider::enumType(EnumDefinition const& _enumDef)
 {
-	return createAndGet<EnumType>(_enumDef);
+	return createAndGet(&TypeProvider::m_enumTypes, &_enumDef, _enumDef);
 }
 
 ModuleType const* TypeProvider::module(SourceUnit const& _source)
 {
-	return createAndGet<ModuleType>(_source);
+	return createAndGet(&TypeProvider::m_moduleTypes, &_source, _source);
 }
 
 TypeType const* TypeProvider::typeType(Type const* _actualType)
 {
-	return createAndGet<TypeType>(_actualType);
+	return createAndGet(&TypeProvider::m_typeTypes, _actualType, _actualType);
 }
 
 StructType const* TypeProvider::structType(StructDefinition const& _struct, DataLocation _location)
 {
-	return createAndGet<StructType>(_struct, _location);
+	return createAndGet(&TypeProvider::m_structTypes, make_pair(&_struct, _location), _struct, _location);
 }
 
 ModifierType const* TypeProvider::modifier(ModifierDefinition const& _def)
 {
-	return createAndGet<ModifierType>(_def);
+	return createAndGet(&TypeProvider::m_modifierTypes, &_def, _def);
 }
 
 MagicType const* TypeProvider::magic(MagicType::Kind _kind)
@@ -557,10 +688,10 @@ MagicType const* TypeProvider::magic(MagicType::Kind _kind)
 MagicType const* TypeProvider::meta(Type const* _type)
 {
 	solAssert(_type && _type->category() == Type::Category::Contract, "Only contracts supported for now.");
-	return createAndGet<MagicType>(_type);
+	return createAndGet(&TypeProvider::m_metaTypes, _type, _type);
 }
 
 MappingType const* TypeProvider::mapping(Type const* _keyType, Type const* _valueType)
 {
-	return createAndGet<MappingType>(_keyType, _valueType);
+	return createAndGet(&TypeProvider::m_mappingTypes, make_pair(_keyType, _valueType), _keyType, _valueType);
 }
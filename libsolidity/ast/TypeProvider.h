@@ -23,7 +23,9 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -34,6 +36,12 @@ namespace solidity::frontend
  * This is the Solidity Compiler's type provider. Use it to request for types. The caller does
  * <b>not</b> own the types.
  *
+ * Types are interned: Requesting a type with the same parameters twice returns the same object.
+ * All types except the elementary ones are allocated in an arena that is owned by a TypeProvider
+ * instance and freed as a whole. The static factory functions use the instance selected via
+ * setInstance, which is usually owned by the CompilerStack. Using them while no instance
+ * is selected is an error, so that types never outlive the AST nodes they refer to.
+ *
  * It is not recommended to explicitly instantiate types unless you really know what and why
  * you are doing it.
  */
@@ -41,16 +49,23 @@ class TypeProvider
 {
 public:
 	TypeProvider() = default;
-	TypeProvider(TypeProvider&&) = default;
 	TypeProvider(TypeProvider const&) = delete;
-	TypeProvider& operator=(TypeProvider&&) = default;
 	TypeProvider& operator=(TypeProvider const&) = delete;
-	~TypeProvider() = default;
+	/// Frees all types of this provider. Clears the caches of the elementary types,
+	/// since they might refer to types of this provider.
+	~TypeProvider();
+
+	/// Selects the provider used by all factory functions, or none if @a _provider is null.
+	/// @returns the previously selected provider.
+	static TypeProvider* setInstance(TypeProvider* _provider);
 
 	/// Resets state of this TypeProvider to initial state, wiping all mutable types.
 	/// This invalidates all dangling pointers to types provided by this TypeProvider.
 	static void reset();
 
+	/// @returns the number of types allocated by the current provider since it was last reset.
+	static size_t typeCount();
+
 	/// @name Factory functions
 	/// Factory functions that convert an AST @ref TypeName to a Type.
 	static Type const* fromElementaryTypeName(ElementaryTypeNameToken const& _type, std::optional<StateMutability> _stateMutability = {});
@@ -190,15 +205,24 @@ public:
 	static MappingType const* mapping(Type const* _keyType, Type const* _valueType);
 
 private:
-	/// Global TypeProvider instance.
-	static TypeProvider& instance()
-	{
-		static TypeProvider _provider;
-		return _provider;
-	}
+	/// The currently selected TypeProvider instance.
+	static TypeProvider& instance();
 
+	/// Allocates a type in the arena of this provider.
 	template <typename T, typename... Args>
-	static inline T const* createAndGet(Args&& ... _args);
+	T const* create(Args&& ... _args);
+
+	/// @returns the type stored under @a _key in the given map of the current provider
+	/// and creates it from @a _args if it is not present yet.
+	template <typename T, typename Key, typename... Args>
+	static T const* createAndGet(
+		std::map<Key, T const*> TypeProvider::* _types,
+		typename std::map<Key, T const*>::key_type _key,
+		Args&& ... _args
+	);
+
+	/// Destroys all types of this provider and clears the caches of the elementary types.
+	void clear();
 
 	static BoolType const m_boolean;
 	static InaccessibleDynamicType const m_inaccessibleDynamic;
@@ -218,10 +242,48 @@ private:
 	static std::array<std::unique_ptr<FixedBytesType>, 32> const m_bytesM;
 	static std::array<std::unique_ptr<MagicType>, 4> const m_magics;        ///< MagicType's except MetaType
 
-	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_ufixedMxN{};
-	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_fixedMxN{};
-	std::map<std::string, std::unique_ptr<StringLiteralType>> m_stringLiteralTypes{};
-	std::vector<std::unique_ptr<Type>> m_generalTypes{};
+	/// Size of the memory blocks types are allocated from.
+	static size_t constexpr c_arenaBlockSize = 64 * 1024;
+	/// Memory blocks the types are allocated from. They are only freed all at once.
+	std::vector<std::unique_ptr<char[]>> m_arenaBlocks;
+	/// Number of bytes already used in the last memory block.
+	size_t m_arenaBlockUsage = c_arenaBlockSize;
+	/// All types allocated in the arena, in order of allocation.
+	std::vector<Type*> m_types;
+
+	/// Types owned by this provider, by the parameters they were requested with.
+	std::map<std::pair<unsigned, unsigned>, FixedPointType const*> m_ufixedMxN;
+	std::map<std::pair<unsigned, unsigned>, FixedPointType const*> m_fixedMxN;
+	std::map<std::string, StringLiteralType const*> m_stringLiteralTypes;
+	std::map<std::vector<Type const*>, TupleType const*> m_tupleTypes;
+	/// Copies of reference types with a different data location. These are created by the types
+	/// themselves and thus not allocated in the arena.
+	std::map<std::tuple<ReferenceType const*, DataLocation, bool>, std::unique_ptr<ReferenceType>> m_locationCopies;
+	/// Function types of declarations and function type names, by AST node and kind.
+	std::map<std::pair<ASTNode const*, FunctionType::Kind>, FunctionType const*> m_declarationFunctionTypes;
+	std::map<
+		std::tuple<strings, strings, FunctionType::Kind, bool, StateMutability>,
+		FunctionType const*
+	> m_plainFunctionTypes;
+	std::map<
+		std::tuple<
+			TypePointers, TypePointers, strings, strings, FunctionType::Kind, bool,
+			StateMutability, Declaration const*, bool, bool, bool, bool
+		>,
+		FunctionType const*
+	> m_customFunctionTypes;
+	std::map<std::pair<rational, Type const*>, RationalNumberType const*> m_rationalNumberTypes;
+	/// Byte arrays and strings are stored with a null base type.
+	std::map<std::tuple<DataLocation, bool, Type const*, std::optional<u256>>, ArrayType const*> m_arrayTypes;
+	std::map<ArrayType const*, ArraySliceType const*> m_arraySliceTypes;
+	std::map<std::pair<ContractDefinition const*, bool>, ContractType const*> m_contractTypes;
+	std::map<EnumDefinition const*, EnumType const*> m_enumTypes;
+	std::map<SourceUnit const*, ModuleType const*> m_moduleTypes;
+	std::map<Type const*, TypeType const*> m_typeTypes;
+	std::map<std::pair<StructDefinition const*, DataLocation>, StructType const*> m_structTypes;
+	std::map<ModifierDefinition const*, ModifierType const*> m_modifierTypes;
+	std::map<Type const*, MagicType const*> m_metaTypes;
+	std::map<std::pair<Type const*, Type const*>, MappingType const*> m_mappingTypes;
 };
 
 }
@@ -148,6 +148,12 @@ util::Result<TypePointers> transformParametersToExternal(TypePointers const& _pa
 
 }
 
+recursive_mutex& Type::cacheMutex()
+{
+	static recursive_mutex mutex;
+	return mutex;
+}
+
 void Type::clearCache() const
 {
 	m_members.clear();
@@ -206,6 +212,7 @@ void MemberList::combine(MemberList const & _other)
 
 pair<u256, unsigned> const* MemberList::memberStorageOffset(string const& _name) const
 {
+	lock_guard<recursive_mutex> lock(Type::cacheMutex());
 	if (!m_storageOffsets)
 	{
 		TypePointers memberTypes;
@@ -309,6 +316,7 @@ TypePointer Type::commonType(Type const* _a, Type const* _b)
 
 MemberList const& Type::members(ContractDefinition const* _currentScope) const
 {
+	lock_guard<recursive_mutex> lock(Type::cacheMutex());
 	if (!m_members[_currentScope])
 	{
 		MemberList::MemberMap members = nativeMembers(_currentScope);
@@ -1625,6 +1633,8 @@ string ArrayType::richIdentifier() const
 
 bool ArrayType::operator==(Type const& _other) const
 {
+	if (&_other == this)
+		return true;
 	if (_other.category() != category())
 		return false;
 	ArrayType const& other = dynamic_cast<ArrayType const&>(_other);
@@ -1635,7 +1645,7 @@ bool ArrayType::operator==(Type const& _other) const
 		other.isDynamicallySized() != isDynamicallySized()
 	)
 		return false;
-	if (*other.baseType() != *baseType())
+	if (other.baseType() != baseType() && *other.baseType() != *baseType())
 		return false;
 	return isDynamicallySized() || length() == other.length();
 }
@@ -1824,6 +1834,7 @@ TypePointer ArrayType::decodingType() const
 
 TypeResult ArrayType::interfaceType(bool _inLibrary) const
 {
+	lock_guard<recursive_mutex> lock(Type::cacheMutex());
 	if (_inLibrary && m_interfaceType_library.has_value())
 		return *m_interfaceType_library;
 
@@ -1978,6 +1989,7 @@ MemberList::MemberMap ContractType::nativeMembers(ContractDefinition const* _con
 
 FunctionType const* ContractType::newExpressionType() const
 {
+	lock_guard<recursive_mutex> lock(Type::cacheMutex());
 	if (!m_constructorType)
 		m_constructorType = FunctionType::newExpressionType(m_contract);
 	return m_constructorType;
@@ -2155,6 +2167,7 @@ MemberList::MemberMap StructType::nativeMembers(ContractDefinition const*) const
 
 TypeResult StructType::interfaceType(bool _inLibrary) const
 {
+	lock_guard<recursive_mutex> lock(Type::cacheMutex());
 	if (_inLibrary && m_interfaceType_library.has_value())
 		return *m_interfaceType_library;
 
@@ -2777,6 +2790,8 @@ string FunctionType::richIdentifier() const
 
 bool FunctionType::operator==(Type const& _other) const
 {
+	if (&_other == this)
+		return true;
 	if (_other.category() != category())
 		return false;
 	FunctionType const& other = dynamic_cast<FunctionType const&>(_other);
@@ -3164,7 +3179,7 @@ bool FunctionType::hasEqualParameterTypes(FunctionType const& _other) const
 		m_parameterTypes.cbegin(),
 		m_parameterTypes.cend(),
 		_other.m_parameterTypes.cbegin(),
-		[](Type const* _a, Type const* _b) -> bool { return *_a == *_b; }
+		[](Type const* _a, Type const* _b) -> bool { return _a == _b || *_a == *_b; }
 	);
 }
 
@@ -3176,7 +3191,7 @@ bool FunctionType::hasEqualReturnTypes(FunctionType const& _other) const
 		m_returnParameterTypes.cbegin(),
 		m_returnParameterTypes.cend(),
 		_other.m_returnParameterTypes.cbegin(),
-		[](Type const* _a, Type const* _b) -> bool { return *_a == *_b; }
+		[](Type const* _a, Type const* _b) -> bool { return _a == _b || *_a == *_b; }
 	);
 }
 
@@ -3398,10 +3413,14 @@ string MappingType::richIdentifier() const
 
 bool MappingType::operator==(Type const& _other) const
 {
+	if (&_other == this)
+		return true;
 	if (_other.category() != category())
 		return false;
 	MappingType const& other = dynamic_cast<MappingType const&>(_other);
-	return *other.m_keyType == *m_keyType && *other.m_valueType == *m_valueType;
+	return
+		(other.m_keyType == m_keyType || *other.m_keyType == *m_keyType) &&
+		(other.m_valueType == m_valueType || *other.m_valueType == *m_valueType);
 }
 
 string MappingType::toString(bool _short) const
@@ -35,6 +35,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
@@ -168,6 +169,10 @@ public:
 	/// @returns a pointer to _a or _b if the other is implicitly convertible to it or nullptr otherwise
 	static TypePointer commonType(Type const* _a, Type const* _b);
 
+	/// @returns the mutex that guards the lazily computed data of all types and the TypeProvider.
+	/// It has to be held while such data is accessed, since contracts may be compiled concurrently.
+	static std::recursive_mutex& cacheMutex();
+
 	virtual Category category() const = 0;
 	/// @returns a valid solidity identifier such that two types should compare equal if and
 	/// only if they have the same identifier.
@@ -267,6 +272,7 @@ public:
 	/// - Each named stack item is typed and contributes the stack slots given by the stack items of its type.
 	std::vector<std::tuple<std::string, TypePointer>> const& stackItems() const
 	{
+		std::lock_guard<std::recursive_mutex> lock(cacheMutex());
 		if (!m_stackItems)
 			m_stackItems = makeStackItems();
 		return *m_stackItems;
@@ -274,6 +280,7 @@ public:
 	/// Total number of stack slots occupied by this type. This is the sum of ``sizeOnStack`` of all ``stackItems()``.
 	unsigned sizeOnStack() const
 	{
+		std::lock_guard<std::recursive_mutex> lock(cacheMutex());
 		if (!m_stackSize)
 		{
 			size_t sizeOnStack = 0;
@@ -931,6 +938,7 @@ public:
 
 	bool recursive() const
 	{
+		std::lock_guard<std::recursive_mutex> lock(cacheMutex());
 		if (m_recursive.has_value())
 			return m_recursive.value();
 
@@ -35,8 +35,15 @@ namespace solidity::frontend {
 class Compiler
 {
 public:
-	Compiler(langutil::EVMVersion _evmVersion, RevertStrings _revertStrings, OptimiserSettings _optimiserSettings):
+	/// @param _parallelism maximum number of threads used to optimise independent sub-assemblies.
+	Compiler(
+		langutil::EVMVersion _evmVersion,
+		RevertStrings _revertStrings,
+		OptimiserSettings _optimiserSettings,
+		unsigned _parallelism = 1
+	):
 		m_optimiserSettings(std::move(_optimiserSettings)),
+		m_parallelism(_parallelism),
 		m_runtimeContext(_evmVersion, _revertStrings),
 		m_context(_evmVersion, _revertStrings, &m_runtimeContext)
 	{ }
@@ -79,6 +86,7 @@ public:
 
 private:
 	OptimiserSettings const m_optimiserSettings;
+	unsigned const m_parallelism;
 	CompilerContext m_runtimeContext;
 	size_t m_runtimeSub = size_t(-1); ///< Identifier of the runtime sub-assembly, if present.
 	CompilerContext m_context;
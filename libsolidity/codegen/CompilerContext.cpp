@@ -408,6 +408,8 @@ void CompilerContext::appendInlineAssembly(
 	ErrorReporter errorReporter(errors);
 	auto scanner = make_shared<langutil::Scanner>(langutil::CharStream(_assembly, "--CODEGEN--"));
 	yul::EVMDialect const& dialect = yul::EVMDialect::strictAssemblyForEVM(m_evmVersion);
+	auto arena = make_shared<yul::ASTArena>();
+	yul::ASTArena::Scope arenaScope(*arena);
 	shared_ptr<yul::Block> parserResult = yul::Parser(errorReporter, dialect).parse(scanner, false);
 #ifdef SOL_OUTPUT_ASM
 	cout << yul::AsmPrinter(&dialect)(*parserResult) << endl;
@@ -446,6 +448,7 @@ void CompilerContext::appendInlineAssembly(
 	{
 		yul::Object obj;
 		obj.code = parserResult;
+		obj.arena = arena;
 		obj.analysisInfo = make_shared<yul::AsmAnalysisInfo>(analysisInfo);
 
 		optimizeYul(obj, dialect, _optimiserSettings, externallyUsedIdentifiers);
@@ -491,7 +494,12 @@ void CompilerContext::optimizeYul(yul::Object& _object, yul::EVMDialect const& _
 		&meter,
 		_object,
 		_optimiserSettings.optimizeStackAllocation,
-		_externalIdentifiers
+		_externalIdentifiers,
+		_optimiserSettings.yulFunctionParallel,
+		1,
+		_optimiserSettings.yulOptimiserSteps,
+		_optimiserSettings.yulOptimiserMaxRounds,
+		chrono::milliseconds(_optimiserSettings.yulOptimiserTimeBudget)
 	);
 
 #ifdef SOL_OUTPUT_ASM
@@ -541,7 +549,7 @@ void CompilerContext::updateSourceLocation()
 evmasm::Assembly::OptimiserSettings CompilerContext::translateOptimiserSettings(OptimiserSettings const& _settings)
 {
 	// Constructing it this way so that we notice changes in the fields.
-	evmasm::Assembly::OptimiserSettings asmSettings{false, false, false, false, false, false, m_evmVersion, 0};
+	evmasm::Assembly::OptimiserSettings asmSettings{false, false, false, false, false, false, m_evmVersion, 0, 1};
 	asmSettings.isCreation = true;
 	asmSettings.runJumpdestRemover = _settings.runJumpdestRemover;
 	asmSettings.runPeephole = _settings.runPeephole;
@@ -256,8 +256,13 @@ public:
 	/// Appends arbitrary data to the end of the bytecode.
 	void appendAuxiliaryData(bytes const& _data) { m_asm->appendAuxiliaryDataToEnd(_data); }
 
-	/// Run optimisation step.
-	void optimise(OptimiserSettings const& _settings) { m_asm->optimise(translateOptimiserSettings(_settings)); }
+	/// Run optimisation step, optimising independent sub-assemblies with up to @a _parallelism threads.
+	void optimise(OptimiserSettings const& _settings, unsigned _parallelism = 1)
+	{
+		evmasm::Assembly::OptimiserSettings settings = translateOptimiserSettings(_settings);
+		settings.parallelism = _parallelism;
+		m_asm->optimise(settings);
+	}
 
 	/// @returns the runtime context if in creation mode and runtime context is set, nullptr otherwise.
 	CompilerContext* runtimeContext() const { return m_runtimeContext; }
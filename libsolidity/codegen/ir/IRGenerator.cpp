@@ -53,6 +53,7 @@ pair<string, string> IRGenerator::run(ContractDefinition const& _contract)
 	string const ir = yul::reindent(generate(_contract));
 
 	yul::AssemblyStack asmStack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
+	asmStack.setParallelism(m_parallelism);
 	if (!asmStack.parseAndAnalyze("", ir))
 	{
 		string errorMessage;
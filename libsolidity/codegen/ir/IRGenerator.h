@@ -40,10 +40,12 @@ public:
 	IRGenerator(
 		langutil::EVMVersion _evmVersion,
 		RevertStrings _revertStrings,
-		OptimiserSettings _optimiserSettings
+		OptimiserSettings _optimiserSettings,
+		unsigned _parallelism = 1
 	):
 		m_evmVersion(_evmVersion),
 		m_optimiserSettings(_optimiserSettings),
+		m_parallelism(_parallelism),
 		m_context(_evmVersion, _revertStrings, std::move(_optimiserSettings)),
 		m_utils(_evmVersion, m_context.revertStrings(), m_context.functionCollector())
 	{}
@@ -76,6 +78,8 @@ private:
 
 	langutil::EVMVersion const m_evmVersion;
 	OptimiserSettings const m_optimiserSettings;
+	/// Number of threads used by the Yul optimiser in function-parallel mode.
+	unsigned const m_parallelism;
 
 	IRGenerationContext m_context;
 	YulUtilFunctions m_utils;
@@ -22,6 +22,10 @@
 
 #include <boost/algorithm/string/replace.hpp>
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::util;
@@ -33,10 +37,25 @@ BMC::BMC(
 	ErrorReporter& _errorReporter,
 	map<h256, string> const& _smtlib2Responses,
 	ReadCallback::Callback const& _smtCallback,
-	smt::SMTSolverChoice _enabledSolvers
+	smt::SMTSolverChoice _enabledSolvers,
+	unsigned _threads,
+	smt::PortfolioStrategy _portfolioStrategy,
+	smt::SMTQueryCache* _queryCache
 ):
 	SMTEncoder(_context),
-	m_interface(make_unique<smt::SMTPortfolio>(_smtlib2Responses, _smtCallback, _enabledSolvers)),
+	m_interface(make_unique<smt::SMTPortfolio>(
+		_smtlib2Responses,
+		_smtCallback,
+		_enabledSolvers,
+		_portfolioStrategy,
+		_queryCache
+	)),
+	m_smtlib2Responses(_smtlib2Responses),
+	m_smtCallback(_smtCallback),
+	m_enabledSolvers(_enabledSolvers),
+	m_portfolioStrategy(_portfolioStrategy),
+	m_queryCache(_queryCache),
+	m_threads(_threads),
 	m_outerErrorReporter(_errorReporter)
 {
 #if defined (HAVE_Z3) || defined (HAVE_CVC4)
@@ -67,7 +86,7 @@ void BMC::analyze(SourceUnit const& _source, set<Expression const*> _safeAsserti
 	// If this check is true, Z3 and CVC4 are not available
 	// and the query answers were not provided, since SMTPortfolio
 	// guarantees that SmtLib2Interface is the first solver.
-	if (!m_interface->unhandledQueries().empty() && m_interface->solvers() == 1)
+	if (!unhandledQueries().empty() && m_interface->solvers() == 1)
 	{
 		if (!m_noSolverWarning)
 		{
@@ -84,6 +103,11 @@ void BMC::analyze(SourceUnit const& _source, set<Expression const*> _safeAsserti
 	m_errorReporter.clear();
 }
 
+vector<string> BMC::unhandledQueries()
+{
+	return m_interface->unhandledQueries() + m_workerUnhandledQueries;
+}
+
 bool BMC::shouldInlineFunctionCall(FunctionCall const& _funCall)
 {
 	FunctionDefinition const* funDef = functionCallToDefinition(_funCall);
@@ -546,8 +570,23 @@ pair<vector<smt::Expression>, vector<string>> BMC::modelExpressions()
 
 void BMC::checkVerificationTargets(smt::Expression const& _constraints)
 {
+	if (m_threads > 1 && m_verificationTargets.size() > 1)
+	{
+		m_concurrentQueries.emplace();
+		for (auto& target: m_verificationTargets)
+			checkVerificationTarget(target, _constraints);
+		m_concurrentQueries->results = solveConcurrently(m_concurrentQueries->queries);
+		m_concurrentQueries->solved = true;
+	}
+
 	for (auto& target: m_verificationTargets)
 		checkVerificationTarget(target, _constraints);
+
+	if (m_concurrentQueries)
+	{
+		solAssert(m_concurrentQueries->nextResult == m_concurrentQueries->results.size(), "");
+		m_concurrentQueries.reset();
+	}
 }
 
 void BMC::checkVerificationTarget(BMCVerificationTarget& _target, smt::Expression const& _constraints)
@@ -706,9 +745,6 @@ void BMC::checkCondition(
 	smt::Expression const* _additionalValue
 )
 {
-	m_interface->push();
-	m_interface->addAssertion(_condition);
-
 	vector<smt::Expression> expressionsToEvaluate;
 	vector<string> expressionNames;
 	tie(expressionsToEvaluate, expressionNames) = _modelExpressions;
@@ -720,7 +756,26 @@ void BMC::checkCondition(
 		}
 	smt::CheckResult result;
 	vector<string> values;
-	tie(result, values) = checkSatisfiableAndGenerateModel(expressionsToEvaluate);
+	if (m_concurrentQueries && !m_concurrentQueries->solved)
+	{
+		m_concurrentQueries->queries.push_back({move(_condition), move(expressionsToEvaluate)});
+		return;
+	}
+	else if (m_concurrentQueries)
+	{
+		QueryResult& queryResult = m_concurrentQueries->results.at(m_concurrentQueries->nextResult++);
+		if (queryResult.solverError)
+			m_errorReporter.warning(*queryResult.solverError);
+		result = queryResult.result;
+		values = move(queryResult.values);
+	}
+	else
+	{
+		m_interface->push();
+		m_interface->addAssertion(_condition);
+		tie(result, values) = checkSatisfiableAndGenerateModel(expressionsToEvaluate);
+		m_interface->pop();
+	}
 
 	string extraComment = SMTEncoder::extraComment();
 	if (m_loopExecutionHappened)
@@ -782,8 +837,6 @@ void BMC::checkCondition(
 		m_errorReporter.warning(_location, "Error trying to invoke SMT solver.");
 		break;
 	}
-
-	m_interface->pop();
 }
 
 void BMC::checkBooleanNotConstant(
@@ -847,22 +900,34 @@ void BMC::checkBooleanNotConstant(
 pair<smt::CheckResult, vector<string>>
 BMC::checkSatisfiableAndGenerateModel(vector<smt::Expression> const& _expressionsToEvaluate)
 {
-	smt::CheckResult result;
-	vector<string> values;
+	QueryResult queryResult = solve(*m_interface, _expressionsToEvaluate);
+	if (queryResult.solverError)
+		m_errorReporter.warning(*queryResult.solverError);
+	return make_pair(queryResult.result, move(queryResult.values));
+}
+
+smt::CheckResult BMC::checkSatisfiable()
+{
+	return checkSatisfiableAndGenerateModel({}).first;
+}
+
+BMC::QueryResult BMC::solve(smt::SolverInterface& _solver, vector<smt::Expression> const& _expressionsToEvaluate)
+{
+	QueryResult queryResult;
 	try
 	{
-		tie(result, values) = m_interface->check(_expressionsToEvaluate);
+		tie(queryResult.result, queryResult.values) = _solver.check(_expressionsToEvaluate);
 	}
 	catch (smt::SolverError const& _e)
 	{
 		string description("Error querying SMT solver");
 		if (_e.comment())
 			description += ": " + *_e.comment();
-		m_errorReporter.warning(description);
-		result = smt::CheckResult::ERROR;
+		queryResult.solverError = description;
+		queryResult.result = smt::CheckResult::ERROR;
 	}
 
-	for (string& value: values)
+	for (string& value: queryResult.values)
 	{
 		try
 		{
@@ -872,11 +937,72 @@ BMC::checkSatisfiableAndGenerateModel(vector<smt::Expression> const& _expression
 		catch (...) { }
 	}
 
-	return make_pair(result, values);
+	return queryResult;
 }
 
-smt::CheckResult BMC::checkSatisfiable()
+vector<BMC::QueryResult> BMC::solveConcurrently(vector<Query> const& _queries)
 {
-	return checkSatisfiableAndGenerateModel({}).first;
-}
+	// The callback is not required to be thread-safe.
+	mutex callbackMutex;
+	ReadCallback::Callback callback;
+	if (m_smtCallback)
+		callback = [&](string const& _kind, string const& _query)
+		{
+			lock_guard<mutex> lock(callbackMutex);
+			return m_smtCallback(_kind, _query);
+		};
+
+	// Every query is solved by a fresh solver, so that the results do not depend
+	// on which queries were solved before by the same thread.
+	// The solvers are created before any thread is started, since creating them
+	// modifies global solver settings.
+	vector<unique_ptr<smt::SMTPortfolio>> solvers;
+	for (size_t i = 0; i < _queries.size(); ++i)
+	{
+		solvers.emplace_back(make_unique<smt::SMTPortfolio>(
+			m_smtlib2Responses,
+			callback,
+			m_enabledSolvers,
+			m_portfolioStrategy,
+			m_queryCache
+		));
+		for (auto const& [name, sort]: m_interface->declarations())
+			solvers.back()->declareVariable(name, sort);
+	}
 
+	vector<QueryResult> results(_queries.size());
+	vector<exception_ptr> failures(_queries.size());
+	atomic<size_t> nextQuery{0};
+	auto worker = [&]()
+	{
+		for (size_t i = nextQuery++; i < _queries.size(); i = nextQuery++)
+			try
+			{
+				smt::SMTPortfolio& solver = *solvers[i];
+				// Mirror sequential checking, so that SMT-LIB2 queries are identical.
+				solver.push();
+				solver.addAssertion(_queries[i].condition);
+				results[i] = solve(solver, _queries[i].expressionsToEvaluate);
+			}
+			catch (...)
+			{
+				failures[i] = current_exception();
+				return;
+			}
+	};
+
+	vector<thread> threads;
+	for (size_t i = 0; i < min<size_t>(m_threads, _queries.size()); ++i)
+		threads.emplace_back(worker);
+	for (thread& t: threads)
+		t.join();
+
+	// Report the first failure in sequential order, just like sequential checking would.
+	for (exception_ptr const& failure: failures)
+		if (failure)
+			rethrow_exception(failure);
+
+	for (auto const& solver: solvers)
+		m_workerUnhandledQueries += solver->unhandledQueries();
+	return results;
+}
@@ -30,11 +30,13 @@
 
 #include <libsolidity/formal/EncodingContext.h>
 #include <libsolidity/formal/SMTEncoder.h>
+#include <libsolidity/formal/SMTPortfolio.h>
 #include <libsolidity/formal/SolverInterface.h>
 
 #include <libsolidity/interface/ReadFile.h>
 #include <liblangutil/ErrorReporter.h>
 
+#include <optional>
 #include <set>
 #include <string>
 #include <vector>
@@ -53,12 +55,19 @@ namespace solidity::frontend
 class BMC: public SMTEncoder
 {
 public:
+	/// @param _threads number of threads used to check the verification targets
+	/// of a function concurrently. Each thread uses its own solvers.
+	/// @param _portfolioStrategy how the answers of multiple solvers are combined.
+	/// @param _queryCache cache of solver answers, may be null.
 	BMC(
 		smt::EncodingContext& _context,
 		langutil::ErrorReporter& _errorReporter,
 		std::map<h256, std::string> const& _smtlib2Responses,
 		ReadCallback::Callback const& _smtCallback,
-		smt::SMTSolverChoice _enabledSolvers
+		smt::SMTSolverChoice _enabledSolvers,
+		unsigned _threads = 1,
+		smt::PortfolioStrategy _portfolioStrategy = smt::PortfolioStrategy::Sequential,
+		smt::SMTQueryCache* _queryCache = nullptr
 	);
 
 	void analyze(SourceUnit const& _sources, std::set<Expression const*> _safeAssertions);
@@ -66,7 +75,7 @@ public:
 	/// This is used if the SMT solver is not directly linked into this binary.
 	/// @returns a list of inputs to the SMT solver that were not part of the argument to
 	/// the constructor.
-	std::vector<std::string> unhandledQueries() { return m_interface->unhandledQueries(); }
+	std::vector<std::string> unhandledQueries();
 
 	/// @returns true if _funCall should be inlined, otherwise false.
 	static bool shouldInlineFunctionCall(FunctionCall const& _funCall);
@@ -124,6 +133,9 @@ private:
 		std::pair<std::vector<smt::Expression>, std::vector<std::string>> modelExpressions;
 	};
 
+	/// Checks all targets in m_verificationTargets. If multiple threads are enabled, the targets
+	/// are visited twice: First to collect their queries, which are then solved concurrently,
+	/// and afterwards to report the results in the same order as sequential checking would.
 	void checkVerificationTargets(smt::Expression const& _constraints);
 	void checkVerificationTarget(BMCVerificationTarget& _target, smt::Expression const& _constraints = smt::Expression(true));
 	void checkConstantCondition(BMCVerificationTarget& _target);
@@ -165,9 +177,49 @@ private:
 	checkSatisfiableAndGenerateModel(std::vector<smt::Expression> const& _expressionsToEvaluate);
 
 	smt::CheckResult checkSatisfiable();
+
+	/// A satisfiability query of a verification target.
+	struct Query
+	{
+		smt::Expression condition;
+		std::vector<smt::Expression> expressionsToEvaluate;
+	};
+	struct QueryResult
+	{
+		smt::CheckResult result = smt::CheckResult::ERROR;
+		std::vector<std::string> values;
+		/// Description of the solver error, if any.
+		std::optional<std::string> solverError;
+	};
+	/// Checks the assertions of @a _solver and evaluates @a _expressionsToEvaluate in the model.
+	/// Does not report errors, so that it can be used from worker threads.
+	static QueryResult solve(smt::SolverInterface& _solver, std::vector<smt::Expression> const& _expressionsToEvaluate);
+	/// Solves @a _queries using m_threads threads, each with its own solvers.
+	std::vector<QueryResult> solveConcurrently(std::vector<Query> const& _queries);
 	//@}
 
-	std::unique_ptr<smt::SolverInterface> m_interface;
+	std::unique_ptr<smt::SMTPortfolio> m_interface;
+
+	/// Parameters of m_interface, used to create the solvers of worker threads.
+	std::map<h256, std::string> m_smtlib2Responses;
+	ReadCallback::Callback m_smtCallback;
+	smt::SMTSolverChoice m_enabledSolvers;
+	smt::PortfolioStrategy m_portfolioStrategy;
+	smt::SMTQueryCache* m_queryCache;
+	unsigned m_threads = 1;
+
+	/// Queries of verification targets that are solved concurrently and their results.
+	struct ConcurrentQueries
+	{
+		std::vector<Query> queries;
+		std::vector<QueryResult> results;
+		bool solved = false;
+		size_t nextResult = 0;
+	};
+	/// Set while verification targets are checked concurrently.
+	std::optional<ConcurrentQueries> m_concurrentQueries;
+	/// Queries of the solvers of worker threads that could not be answered.
+	std::vector<std::string> m_workerUnhandledQueries;
 
 	/// Flags used for better warning messages.
 	bool m_loopExecutionHappened = false;
@@ -39,18 +39,26 @@ CHC::CHC(
 	ErrorReporter& _errorReporter,
 	map<util::h256, string> const& _smtlib2Responses,
 	ReadCallback::Callback const& _smtCallback,
-	[[maybe_unused]] smt::SMTSolverChoice _enabledSolvers
+	[[maybe_unused]] smt::SMTSolverChoice _enabledSolvers,
+	smt::SMTQueryCache* _queryCache
 ):
 	SMTEncoder(_context),
+	m_queryCache(_queryCache),
 	m_outerErrorReporter(_errorReporter),
 	m_enabledSolvers(_enabledSolvers)
 {
 #ifdef HAVE_Z3
 	if (_enabledSolvers.z3)
+	{
 		m_interface = make_unique<smt::Z3CHCInterface>();
+		m_solverName = "chc-z3";
+	}
 #endif
 	if (!m_interface)
+	{
 		m_interface = make_unique<smt::CHCSmtLib2Interface>(_smtlib2Responses, _smtCallback);
+		m_solverName = "chc-smtlib2";
+	}
 }
 
 void CHC::analyze(SourceUnit const& _source)
@@ -986,7 +994,18 @@ pair<smt::CheckResult, vector<string>> CHC::query(smt::Expression const& _query,
 {
 	smt::CheckResult result;
 	vector<string> values;
-	tie(result, values) = m_interface->query(_query);
+	optional<string> cacheKey;
+	if (m_queryCache)
+		cacheKey = m_interface->dumpQuery(_query);
+	if (auto cachedResult = cacheKey ? m_queryCache->lookup(m_solverName, *cacheKey) : nullopt)
+		tie(result, values) = *cachedResult;
+	else
+	{
+		auto start = chrono::steady_clock::now();
+		tie(result, values) = m_interface->query(_query);
+		if (cacheKey)
+			m_queryCache->store(m_solverName, *cacheKey, {result, values}, chrono::steady_clock::now() - start);
+	}
 	switch (result)
 	{
 	case smt::CheckResult::SATISFIABLE:
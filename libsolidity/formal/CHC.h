@@ -33,6 +33,7 @@
 #include <libsolidity/formal/SMTEncoder.h>
 
 #include <libsolidity/formal/CHCSolverInterface.h>
+#include <libsolidity/formal/SMTQueryCache.h>
 
 #include <libsolidity/interface/ReadFile.h>
 
@@ -49,7 +50,8 @@ public:
 		langutil::ErrorReporter& _errorReporter,
 		std::map<util::h256, std::string> const& _smtlib2Responses,
 		ReadCallback::Callback const& _smtCallback,
-		smt::SMTSolverChoice _enabledSolvers
+		smt::SMTSolverChoice _enabledSolvers,
+		smt::SMTQueryCache* _queryCache = nullptr
 	);
 
 	void analyze(SourceUnit const& _sources);
@@ -271,6 +273,11 @@ private:
 
 	/// CHC solver.
 	std::unique_ptr<smt::CHCSolverInterface> m_interface;
+	/// Name of the CHC solver, used as part of the keys of cache entries.
+	std::string m_solverName;
+
+	/// Cache of solver answers, may be null.
+	smt::SMTQueryCache* m_queryCache = nullptr;
 
 	/// ErrorReporter that comes from CompilerStack.
 	langutil::ErrorReporter& m_outerErrorReporter;
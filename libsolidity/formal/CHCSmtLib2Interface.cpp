@@ -85,16 +85,7 @@ void CHCSmtLib2Interface::addRule(smt::Expression const& _expr, std::string cons
 
 pair<CheckResult, vector<string>> CHCSmtLib2Interface::query(smt::Expression const& _block)
 {
-	string accumulated{};
-	swap(m_accumulatedOutput, accumulated);
-	for (auto const& var: m_smtlib2->variables())
-		declareVariable(var.first, var.second);
-	m_accumulatedOutput += accumulated;
-
-	string response = querySolver(
-		m_accumulatedOutput +
-		"\n(query " + _block.name + " :print-certificate true)"
-	);
+	string response = querySolver(dumpQuery(_block));
 
 	CheckResult result;
 	// TODO proper parsing
@@ -111,6 +102,17 @@ pair<CheckResult, vector<string>> CHCSmtLib2Interface::query(smt::Expression con
 	return make_pair(result, vector<string>{});
 }
 
+string CHCSmtLib2Interface::dumpQuery(smt::Expression const& _block)
+{
+	string accumulated{};
+	swap(m_accumulatedOutput, accumulated);
+	for (auto const& var: m_smtlib2->variables())
+		declareVariable(var.first, var.second);
+	m_accumulatedOutput += accumulated;
+
+	return m_accumulatedOutput + "\n(query " + _block.name + " :print-certificate true)";
+}
+
 void CHCSmtLib2Interface::declareVariable(string const& _name, SortPointer const& _sort)
 {
 	solAssert(_sort, "");
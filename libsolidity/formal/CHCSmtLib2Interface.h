@@ -44,6 +44,8 @@ public:
 
 	std::pair<CheckResult, std::vector<std::string>> query(Expression const& _expr) override;
 
+	std::string dumpQuery(Expression const& _expr) override;
+
 	void declareVariable(std::string const& _name, SortPointer const& _sort) override;
 
 	std::vector<std::string> unhandledQueries() const { return m_unhandledQueries; }
@@ -45,6 +45,10 @@ public:
 	virtual std::pair<CheckResult, std::vector<std::string>> query(
 		Expression const& _expr
 	) = 0;
+
+	/// @returns a textual representation of the rules and of the query @a _expr,
+	/// which identifies the query to the solver.
+	virtual std::string dumpQuery(Expression const& _expr) = 0;
 };
 
 }
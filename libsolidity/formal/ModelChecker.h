@@ -44,11 +44,17 @@ class ModelChecker
 public:
 	/// @param _enabledSolvers represents a runtime choice of which SMT solvers
 	/// should be used, even if all are available. The default choice is to use all.
+	/// @param _threads the number of threads the BMC engine may use to check verification targets.
+	/// @param _portfolioStrategy how the BMC engine combines the answers of multiple solvers.
+	/// @param _queryCache cache of solver answers shared by both engines, may be null.
 	ModelChecker(
 		langutil::ErrorReporter& _errorReporter,
 		std::map<solidity::util::h256, std::string> const& _smtlib2Responses,
 		ReadCallback::Callback const& _smtCallback = ReadCallback::Callback(),
-		smt::SMTSolverChoice _enabledSolvers = smt::SMTSolverChoice::All()
+		smt::SMTSolverChoice _enabledSolvers = smt::SMTSolverChoice::All(),
+		unsigned _threads = 1,
+		smt::PortfolioStrategy _portfolioStrategy = smt::PortfolioStrategy::Sequential,
+		smt::SMTQueryCache* _queryCache = nullptr
 	);
 
 	void analyze(SourceUnit const& _sources);
@@ -107,10 +107,7 @@ void SMTLib2Interface::addAssertion(smt::Expression const& _expr)
 
 pair<CheckResult, vector<string>> SMTLib2Interface::check(vector<smt::Expression> const& _expressionsToEvaluate)
 {
-	string response = querySolver(
-		boost::algorithm::join(m_accumulatedOutput, "\n") +
-		checkSatAndGetValuesCommand(_expressionsToEvaluate)
-	);
+	string response = querySolver(dumpQuery(_expressionsToEvaluate));
 
 	CheckResult result;
 	// TODO proper parsing
@@ -129,6 +126,11 @@ pair<CheckResult, vector<string>> SMTLib2Interface::check(vector<smt::Expression
 	return make_pair(result, values);
 }
 
+string SMTLib2Interface::dumpQuery(vector<smt::Expression> const& _expressionsToEvaluate)
+{
+	return boost::algorithm::join(m_accumulatedOutput, "\n") + checkSatAndGetValuesCommand(_expressionsToEvaluate);
+}
+
 string SMTLib2Interface::toSExpr(smt::Expression const& _expr)
 {
 	if (_expr.arguments.empty())
@@ -54,6 +54,9 @@ public:
 
 	std::vector<std::string> unhandledQueries() override { return m_unhandledQueries; }
 
+	/// @returns the SMT-LIB2 query that check() would send to the solver.
+	std::string dumpQuery(std::vector<smt::Expression> const& _expressionsToEvaluate);
+
 	// Used by CHCSmtLib2Interface
 	std::string toSExpr(smt::Expression const& _expr);
 	std::string toSmtLibSort(Sort const& _sort);
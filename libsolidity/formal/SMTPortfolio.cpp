@@ -25,6 +25,12 @@
 #endif
 #include <libsolidity/formal/SMTLib2Interface.h>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::util;
@@ -34,17 +40,27 @@ using namespace solidity::frontend::smt;
 SMTPortfolio::SMTPortfolio(
 	map<h256, string> const& _smtlib2Responses,
 	ReadCallback::Callback const& _smtCallback,
-	[[maybe_unused]] SMTSolverChoice _enabledSolvers
-)
+	[[maybe_unused]] SMTSolverChoice _enabledSolvers,
+	PortfolioStrategy _strategy,
+	SMTQueryCache* _queryCache
+):
+	m_strategy(_strategy),
+	m_queryCache(_queryCache)
 {
 	m_solvers.emplace_back(make_unique<smt::SMTLib2Interface>(_smtlib2Responses, _smtCallback));
 #ifdef HAVE_Z3
 	if (_enabledSolvers.z3)
+	{
 		m_solvers.emplace_back(make_unique<smt::Z3Interface>());
+		m_solverNames += ",z3";
+	}
 #endif
 #ifdef HAVE_CVC4
 	if (_enabledSolvers.cvc4)
+	{
 		m_solvers.emplace_back(make_unique<smt::CVC4Interface>());
+		m_solverNames += ",cvc4";
+	}
 #endif
 }
 
@@ -52,6 +68,7 @@ void SMTPortfolio::reset()
 {
 	for (auto const& s: m_solvers)
 		s->reset();
+	m_declarations.clear();
 }
 
 void SMTPortfolio::push()
@@ -71,6 +88,7 @@ void SMTPortfolio::declareVariable(string const& _name, SortPointer const& _sort
 	solAssert(_sort, "");
 	for (auto const& s: m_solvers)
 		s->declareVariable(_name, _sort);
+	m_declarations.emplace_back(_name, _sort);
 }
 
 void SMTPortfolio::addAssertion(smt::Expression const& _expr)
@@ -79,6 +97,25 @@ void SMTPortfolio::addAssertion(smt::Expression const& _expr)
 		s->addAssertion(_expr);
 }
 
+pair<CheckResult, vector<string>> SMTPortfolio::check(vector<smt::Expression> const& _expressionsToEvaluate)
+{
+	if (!m_queryCache)
+		return checkUncached(_expressionsToEvaluate);
+
+	// This code assumes that the constructor guarantees that
+	// SmtLib2Interface is in position 0.
+	auto smtlib2 = dynamic_cast<smt::SMTLib2Interface*>(m_solvers.front().get());
+	solAssert(smtlib2, "");
+	string query = smtlib2->dumpQuery(_expressionsToEvaluate);
+	if (auto cachedResult = m_queryCache->lookup(m_solverNames, query))
+		return *cachedResult;
+
+	auto start = chrono::steady_clock::now();
+	auto result = checkUncached(_expressionsToEvaluate);
+	m_queryCache->store(m_solverNames, query, result, chrono::steady_clock::now() - start);
+	return result;
+}
+
 /*
  * Broadcasts the SMT query to all solvers and returns a single result.
  * This comment explains how this result is decided.
@@ -108,33 +145,130 @@ void SMTPortfolio::addAssertion(smt::Expression const& _expr)
  *   when it is told that this is a hard query to solve.
  *
  *   If all solvers return ERROR, the result is ERROR.
+ *
+ * If the strategy is Race, the solvers run concurrently and the first solver that
+ * answers the query decides the result. The other solvers are interrupted and
+ * conflicts are not detected.
+ * If the strategy is StrictRace, the solvers run concurrently, but the result is
+ * decided from the results of all solvers as described above.
 */
-pair<CheckResult, vector<string>> SMTPortfolio::check(vector<smt::Expression> const& _expressionsToEvaluate)
+pair<CheckResult, vector<string>> SMTPortfolio::checkUncached(vector<smt::Expression> const& _expressionsToEvaluate)
 {
 	CheckResult lastResult = CheckResult::ERROR;
 	vector<string> finalValues;
+	if (m_strategy == PortfolioStrategy::Sequential || m_solvers.size() == 1)
+	{
+		for (auto const& s: m_solvers)
+			if (!combineResult(s->check(_expressionsToEvaluate), lastResult, finalValues))
+				break;
+		return make_pair(lastResult, finalValues);
+	}
+
+	bool const firstAnswerWins = m_strategy == PortfolioStrategy::Race;
+	auto [results, completionOrder] = checkConcurrently(_expressionsToEvaluate, firstAnswerWins);
+	if (firstAnswerWins)
+	{
+		// Results that arrived after the first answer are due to the interruption.
+		for (size_t i: completionOrder)
+		{
+			combineResult(move(results[i]), lastResult, finalValues);
+			if (solverAnswered(lastResult))
+				break;
+		}
+	}
+	else
+		for (auto& result: results)
+			if (!combineResult(move(result), lastResult, finalValues))
+				break;
+	return make_pair(lastResult, finalValues);
+}
+
+void SMTPortfolio::interrupt()
+{
 	for (auto const& s: m_solvers)
+		s->interrupt();
+}
+
+bool SMTPortfolio::combineResult(
+	pair<CheckResult, vector<string>> _result,
+	CheckResult& _portfolioResult,
+	vector<string>& _portfolioValues
+)
+{
+	auto&& [result, values] = _result;
+	if (solverAnswered(result))
 	{
-		CheckResult result;
-		vector<string> values;
-		tie(result, values) = s->check(_expressionsToEvaluate);
-		if (solverAnswered(result))
+		if (!solverAnswered(_portfolioResult))
+		{
+			_portfolioResult = result;
+			_portfolioValues = std::move(values);
+		}
+		else if (_portfolioResult != result)
 		{
-			if (!solverAnswered(lastResult))
+			_portfolioResult = CheckResult::CONFLICTING;
+			return false;
+		}
+	}
+	else if (result == CheckResult::UNKNOWN && _portfolioResult == CheckResult::ERROR)
+		_portfolioResult = result;
+	return true;
+}
+
+pair<vector<pair<CheckResult, vector<string>>>, vector<size_t>>
+SMTPortfolio::checkConcurrently(vector<smt::Expression> const& _expressionsToEvaluate, bool _firstAnswerWins)
+{
+	vector<pair<CheckResult, vector<string>>> results(m_solvers.size());
+	vector<exception_ptr> failures(m_solvers.size());
+	vector<size_t> completionOrder;
+	bool answered = false;
+	mutex resultsMutex;
+	condition_variable solverDone;
+
+	vector<thread> threads;
+	for (size_t i = 0; i < m_solvers.size(); ++i)
+		threads.emplace_back([&, i]()
+		{
+			pair<CheckResult, vector<string>> result{CheckResult::ERROR, {}};
+			exception_ptr failure;
+			try
 			{
-				lastResult = result;
-				finalValues = std::move(values);
+				result = m_solvers[i]->check(_expressionsToEvaluate);
 			}
-			else if (lastResult != result)
+			catch (...)
 			{
-				lastResult = CheckResult::CONFLICTING;
-				break;
+				failure = current_exception();
 			}
+			lock_guard<mutex> lock(resultsMutex);
+			results[i] = move(result);
+			failures[i] = failure;
+			completionOrder.push_back(i);
+			answered = answered || solverAnswered(results[i].first);
+			solverDone.notify_all();
+		});
+
+	{
+		unique_lock<mutex> lock(resultsMutex);
+		auto finished = [&]() { return completionOrder.size() == m_solvers.size(); };
+		solverDone.wait(lock, [&]() { return finished() || (_firstAnswerWins && answered); });
+		// A solver might not have started its check when it is interrupted for the first time,
+		// so keep interrupting the remaining solvers until they give up.
+		while (!finished())
+		{
+			for (size_t i = 0; i < m_solvers.size(); ++i)
+				if (find(completionOrder.begin(), completionOrder.end(), i) == completionOrder.end())
+					m_solvers[i]->interrupt();
+			solverDone.wait_for(lock, chrono::milliseconds(10), finished);
 		}
-		else if (result == CheckResult::UNKNOWN && lastResult == CheckResult::ERROR)
-			lastResult = result;
 	}
-	return make_pair(lastResult, finalValues);
+	for (thread& t: threads)
+		t.join();
+
+	// Report the first failure in the order of the solvers, just like sequential checking would.
+	for (exception_ptr const& failure: failures)
+		if (failure)
+			rethrow_exception(failure);
+
+	return make_pair(move(results), move(completionOrder));
 }
 
 vector<string> SMTPortfolio::unhandledQueries()
@@ -18,6 +18,7 @@
 #pragma once
 
 
+#include <libsolidity/formal/SMTQueryCache.h>
 #include <libsolidity/formal/SolverInterface.h>
 #include <libsolidity/interface/ReadFile.h>
 #include <libsolutil/FixedHash.h>
@@ -33,7 +34,9 @@ namespace solidity::frontend::smt
  * The SMTPortfolio wraps all available solvers within a single interface,
  * propagating the functionalities to all solvers.
  * It also checks whether different solvers give conflicting answers
- * to SMT queries.
+ * to SMT queries, unless the PortfolioStrategy is Race, in which case
+ * the first answer wins.
+ * If an SMTQueryCache is given, answers are looked up there before querying the solvers.
  */
 class SMTPortfolio: public SolverInterface, public boost::noncopyable
 {
@@ -41,7 +44,9 @@ public:
 	SMTPortfolio(
 		std::map<util::h256, std::string> const& _smtlib2Responses,
 		ReadCallback::Callback const& _smtCallback,
-		SMTSolverChoice _enabledSolvers
+		SMTSolverChoice _enabledSolvers,
+		PortfolioStrategy _strategy = PortfolioStrategy::Sequential,
+		SMTQueryCache* _queryCache = nullptr
 	);
 
 	void reset() override;
@@ -54,15 +59,41 @@ public:
 	void addAssertion(smt::Expression const& _expr) override;
 
 	std::pair<CheckResult, std::vector<std::string>> check(std::vector<smt::Expression> const& _expressionsToEvaluate) override;
+	void interrupt() override;
 
 	std::vector<std::string> unhandledQueries() override;
 	unsigned solvers() override { return m_solvers.size(); }
+
+	/// @returns the variables declared since the last reset, in order of declaration.
+	std::vector<std::pair<std::string, SortPointer>> const& declarations() const { return m_declarations; }
 private:
 	static bool solverAnswered(CheckResult result);
+	/// Queries the solvers without consulting the cache.
+	std::pair<CheckResult, std::vector<std::string>> checkUncached(std::vector<smt::Expression> const& _expressionsToEvaluate);
+	/// Combines @a _result of a single solver into the result of the portfolio so far,
+	/// given by @a _portfolioResult and @a _portfolioValues.
+	/// @returns false if the solvers gave conflicting answers.
+	static bool combineResult(
+		std::pair<CheckResult, std::vector<std::string>> _result,
+		CheckResult& _portfolioResult,
+		std::vector<std::string>& _portfolioValues
+	);
+
+	/// Runs the solvers concurrently, one thread per solver. If @a _firstAnswerWins is true,
+	/// the remaining solvers are interrupted as soon as one solver answered.
+	/// @returns the results of all solvers and the indices of the solvers in order of completion.
+	std::pair<std::vector<std::pair<CheckResult, std::vector<std::string>>>, std::vector<size_t>>
+	checkConcurrently(std::vector<smt::Expression> const& _expressionsToEvaluate, bool _firstAnswerWins);
 
 	std::vector<std::unique_ptr<smt::SolverInterface>> m_solvers;
+	PortfolioStrategy m_strategy;
+	SMTQueryCache* m_queryCache;
+	/// Names of the solvers, used as part of the keys of cache entries.
+	std::string m_solverNames = "smtlib2";
 
 	std::vector<smt::Expression> m_assertions;
+
+	std::vector<std::pair<std::string, SortPointer>> m_declarations;
 };
 
 }
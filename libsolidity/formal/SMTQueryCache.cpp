@@ -0,0 +1,122 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * On-disk cache for the answers of SMT and CHC solvers.
+ */
+
+#include <libsolidity/formal/SMTQueryCache.h>
+
+#include <libsolidity/interface/Version.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+#include <libsolutil/Keccak256.h>
+
+#include <fstream>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::frontend::smt;
+
+namespace fs = boost::filesystem;
+
+optional<pair<CheckResult, vector<string>>> SMTQueryCache::lookup(string const& _solvers, string const& _query)
+{
+	Json::Value entry;
+	jsonParseStrict(readFileAsString(entryPath(_solvers, _query).string()), entry);
+
+	bool valid =
+		entry.isObject() &&
+		entry["result"].isString() &&
+		(entry["result"].asString() == "sat" || entry["result"].asString() == "unsat") &&
+		entry["values"].isArray() &&
+		entry["time"].isUInt64();
+	if (valid)
+		for (Json::Value const& value: entry["values"])
+			valid = valid && value.isString();
+
+	lock_guard<mutex> lock(m_statisticsMutex);
+	if (!valid)
+	{
+		++m_misses;
+		return nullopt;
+	}
+	++m_hits;
+	m_timeSaved += chrono::microseconds(entry["time"].asUInt64());
+
+	vector<string> values;
+	for (Json::Value const& value: entry["values"])
+		values.emplace_back(value.asString());
+	CheckResult result = entry["result"].asString() == "sat" ? CheckResult::SATISFIABLE : CheckResult::UNSATISFIABLE;
+	return make_pair(result, move(values));
+}
+
+void SMTQueryCache::store(
+	string const& _solvers,
+	string const& _query,
+	pair<CheckResult, vector<string>> const& _result,
+	chrono::steady_clock::duration _solvingTime
+)
+{
+	if (_result.first != CheckResult::SATISFIABLE && _result.first != CheckResult::UNSATISFIABLE)
+		return;
+
+	Json::Value entry{Json::objectValue};
+	entry["result"] = _result.first == CheckResult::SATISFIABLE ? "sat" : "unsat";
+	entry["values"] = Json::arrayValue;
+	for (string const& value: _result.second)
+		entry["values"].append(value);
+	entry["time"] = Json::UInt64(chrono::duration_cast<chrono::microseconds>(_solvingTime).count());
+
+	try
+	{
+		fs::create_directories(m_directory);
+		fs::path path = entryPath(_solvers, _query);
+		// Write to a temporary file first, so that concurrent compilers never read partial entries.
+		fs::path temporaryPath = path;
+		temporaryPath += fs::unique_path(".%%%%-%%%%-%%%%.tmp");
+		bool written = false;
+		{
+			ofstream file(temporaryPath.string(), ios::out | ios::binary | ios::trunc);
+			file << jsonCompactPrint(entry);
+			written = bool(file);
+		}
+		if (written)
+			fs::rename(temporaryPath, path);
+		else
+			fs::remove(temporaryPath);
+	}
+	catch (fs::filesystem_error const&)
+	{
+	}
+}
+
+Json::Value SMTQueryCache::statistics() const
+{
+	lock_guard<mutex> lock(m_statisticsMutex);
+	Json::Value statistics{Json::objectValue};
+	statistics["hits"] = Json::UInt64(m_hits);
+	statistics["misses"] = Json::UInt64(m_misses);
+	statistics["timeSaved"] = Json::UInt64(chrono::duration_cast<chrono::milliseconds>(m_timeSaved).count());
+	return statistics;
+}
+
+fs::path SMTQueryCache::entryPath(string const& _solvers, string const& _query) const
+{
+	return m_directory / (keccak256(VersionString + "\n" + _solvers + "\n" + _query).hex() + ".json");
+}
@@ -0,0 +1,85 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * On-disk cache for the answers of SMT and CHC solvers.
+ */
+
+#pragma once
+
+#include <libsolidity/formal/SolverInterface.h>
+
+#include <libsolutil/FixedHash.h>
+
+#include <boost/filesystem.hpp>
+#include <json/json.h>
+
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace solidity::frontend::smt
+{
+
+/**
+ * Content-addressed cache of solver answers that persists across compiler runs.
+ * Each entry is stored as one file in the cache directory.
+ *
+ * An entry is keyed by the compiler version, the solvers that answered the query and the
+ * query in SMT-LIB2 format (or in the native format of the solver, if it is not given
+ * SMT-LIB2 queries). Only SAT and UNSAT answers are stored, since other results may be
+ * caused by interruptions or by the environment.
+ *
+ * The cache may be used from multiple threads. Failures to read or write the cache directory
+ * are not errors, they just cause cache misses.
+ */
+class SMTQueryCache
+{
+public:
+	explicit SMTQueryCache(boost::filesystem::path _directory): m_directory(std::move(_directory)) {}
+
+	/// @returns the cached answer of @a _solvers to @a _query.
+	std::optional<std::pair<CheckResult, std::vector<std::string>>> lookup(
+		std::string const& _solvers,
+		std::string const& _query
+	);
+	/// Stores the answer of @a _solvers to @a _query, which took @a _solvingTime to compute.
+	/// Results other than SAT and UNSAT are ignored.
+	void store(
+		std::string const& _solvers,
+		std::string const& _query,
+		std::pair<CheckResult, std::vector<std::string>> const& _result,
+		std::chrono::steady_clock::duration _solvingTime
+	);
+
+	/// @returns a JSON object containing the number of cache hits and misses of this cache
+	/// and the solving time saved by the hits in milliseconds.
+	Json::Value statistics() const;
+
+private:
+	/// @returns the path of the cache entry for @a _query answered by @a _solvers.
+	boost::filesystem::path entryPath(std::string const& _solvers, std::string const& _query) const;
+
+	boost::filesystem::path m_directory;
+	mutable std::mutex m_statisticsMutex;
+	size_t m_hits = 0;
+	size_t m_misses = 0;
+	std::chrono::steady_clock::duration m_timeSaved{0};
+};
+
+}
@@ -47,6 +47,18 @@ struct SMTSolverChoice
 	bool all() { return cvc4 && z3; }
 };
 
+/// How SMTPortfolio decides a query if multiple solvers are enabled.
+enum class PortfolioStrategy
+{
+	/// Query the solvers one after another and detect conflicting answers.
+	Sequential,
+	/// Query the solvers concurrently and return the first SAT or UNSAT answer.
+	/// The remaining solvers are interrupted.
+	Race,
+	/// Query the solvers concurrently, but wait for all of them and detect conflicting answers.
+	StrictRace
+};
+
 enum class CheckResult
 {
 	SATISFIABLE, UNSATISFIABLE, UNKNOWN, CONFLICTING, ERROR
@@ -365,6 +377,11 @@ public:
 	virtual std::pair<CheckResult, std::vector<std::string>>
 	check(std::vector<Expression> const& _expressionsToEvaluate) = 0;
 
+	/// Asks a call to check() that is running on another thread to give up.
+	/// The interrupted call returns UNKNOWN or ERROR.
+	/// Solvers that cannot be interrupted ignore this.
+	virtual void interrupt() {}
+
 	/// @returns a list of queries that the system was not able to respond to.
 	virtual std::vector<std::string> unhandledQueries() { return {}; }
 
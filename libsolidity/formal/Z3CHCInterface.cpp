@@ -109,3 +109,8 @@ pair<CheckResult, vector<string>> Z3CHCInterface::query(Expression const& _expr)
 
 	return make_pair(result, values);
 }
+
+string Z3CHCInterface::dumpQuery(Expression const& _expr)
+{
+	return m_solver.to_string() + "\n(query " + m_z3Interface->toZ3Expr(_expr).to_string() + ")";
+}
@@ -41,6 +41,8 @@ public:
 
 	std::pair<CheckResult, std::vector<std::string>> query(Expression const& _expr) override;
 
+	std::string dumpQuery(Expression const& _expr) override;
+
 	Z3Interface* z3Interface() const { return m_z3Interface.get(); }
 
 private:
@@ -0,0 +1,190 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * On-disk cache for the output of Standard JSON compilations.
+ */
+
+#include <libsolidity/interface/CompilationCache.h>
+
+#include <libsolidity/interface/Version.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+#include <libsolutil/Keccak256.h>
+
+#include <algorithm>
+#include <fstream>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::frontend;
+
+namespace fs = boost::filesystem;
+
+namespace
+{
+
+h256 responseHash(ReadCallback::Result const& _result)
+{
+	string_view response = _result.response();
+	return keccak256(bytesConstRef(reinterpret_cast<uint8_t const*>(response.data()), response.size()));
+}
+
+}
+
+optional<Json::Value> CompilationCache::lookup(Json::Value const& _input, ReadCallback::Callback const& _readFile)
+{
+	h256 key = entryKey(_input);
+	Json::Value entry;
+	auto memoryEntry = find_if(m_memoryEntries.begin(), m_memoryEntries.end(), [&](auto const& _entry) {
+		return _entry.first == key;
+	});
+	if (memoryEntry != m_memoryEntries.end())
+	{
+		entry = move(memoryEntry->second);
+		m_memoryEntries.erase(memoryEntry);
+	}
+	else if (m_directory)
+		jsonParseStrict(readFileAsString(entryPath(key).string()), entry);
+
+	if (!isValid(entry, _readFile))
+	{
+		++m_misses;
+		return nullopt;
+	}
+	++m_hits;
+	Json::Value output = entry["output"];
+	keepInMemory(key, move(entry));
+	return output;
+}
+
+void CompilationCache::store(Json::Value const& _input, vector<Query> const& _queries, Json::Value const& _output)
+{
+	for (Json::Value const& error: _output["errors"])
+		if (error["severity"].asString() == "error")
+			return;
+
+	Json::Value entry{Json::objectValue};
+	entry["queries"] = Json::arrayValue;
+	for (Query const& query: _queries)
+	{
+		Json::Value queryJson{Json::objectValue};
+		queryJson["kind"] = query.kind;
+		queryJson["path"] = query.path;
+		queryJson["success"] = query.success;
+		queryJson["hash"] = query.responseHash.hex();
+		entry["queries"].append(move(queryJson));
+	}
+	entry["output"] = _output;
+
+	h256 key = entryKey(_input);
+	if (m_directory)
+		writeEntry(key, entry);
+	keepInMemory(key, move(entry));
+}
+
+ReadCallback::Callback CompilationCache::recordingCallback(
+	ReadCallback::Callback _readFile,
+	vector<Query>& _queries
+)
+{
+	if (!_readFile)
+		return _readFile;
+	return [readFile = move(_readFile), &_queries](string const& _kind, string const& _path)
+	{
+		ReadCallback::Result result = readFile(_kind, _path);
+		_queries.push_back({_kind, _path, result.success, responseHash(result)});
+		return result;
+	};
+}
+
+Json::Value CompilationCache::statistics() const
+{
+	Json::Value statistics{Json::objectValue};
+	statistics["hits"] = Json::UInt64(m_hits);
+	statistics["misses"] = Json::UInt64(m_misses);
+	return statistics;
+}
+
+h256 CompilationCache::entryKey(Json::Value const& _input)
+{
+	return keccak256(VersionString + "\n" + jsonCompactPrint(_input));
+}
+
+fs::path CompilationCache::entryPath(h256 const& _key) const
+{
+	solAssert(m_directory, "");
+	return *m_directory / (_key.hex() + ".json");
+}
+
+bool CompilationCache::isValid(Json::Value const& _entry, ReadCallback::Callback const& _readFile)
+{
+	if (!_entry.isObject() || !_entry["queries"].isArray() || !_entry["output"].isObject())
+		return false;
+	for (Json::Value const& query: _entry["queries"])
+	{
+		if (
+			!_readFile ||
+			!query.isObject() ||
+			!query["kind"].isString() ||
+			!query["path"].isString() ||
+			!query["success"].isBool() ||
+			!query["hash"].isString()
+		)
+			return false;
+		ReadCallback::Result result = _readFile(query["kind"].asString(), query["path"].asString());
+		if (
+			result.success != query["success"].asBool() ||
+			responseHash(result).hex() != query["hash"].asString()
+		)
+			return false;
+	}
+	return true;
+}
+
+void CompilationCache::writeEntry(h256 const& _key, Json::Value const& _entry) const
+{
+	try
+	{
+		fs::create_directories(*m_directory);
+		fs::path path = entryPath(_key);
+		// Write to a temporary file first, so that concurrent compilers never read partial entries.
+		fs::path temporaryPath = path;
+		temporaryPath += fs::unique_path(".%%%%-%%%%-%%%%.tmp");
+		bool written = false;
+		{
+			ofstream file(temporaryPath.string(), ios::out | ios::binary | ios::trunc);
+			file << jsonCompactPrint(_entry);
+			written = bool(file);
+		}
+		if (written)
+			fs::rename(temporaryPath, path);
+		else
+			fs::remove(temporaryPath);
+	}
+	catch (fs::filesystem_error const&)
+	{
+	}
+}
+
+void CompilationCache::keepInMemory(h256 const& _key, Json::Value _entry)
+{
+	m_memoryEntries.emplace_back(_key, move(_entry));
+	if (m_memoryEntries.size() > c_maxMemoryEntries)
+		m_memoryEntries.pop_front();
+}
@@ -0,0 +1,107 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * On-disk cache for the output of Standard JSON compilations.
+ */
+
+#pragma once
+
+#include <libsolidity/interface/ReadFile.h>
+
+#include <libsolutil/FixedHash.h>
+
+#include <boost/filesystem.hpp>
+#include <json/json.h>
+
+#include <list>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace solidity::frontend
+{
+
+/**
+ * Content-addressed cache of Standard JSON outputs. The most recently used entries are kept
+ * in memory. If a directory is given, all entries are also stored there as one file per entry.
+ * Entries cover whole compilations, i.e. nothing is reused for the unchanged sources of an input.
+ *
+ * An entry is keyed by the compiler version and the complete Standard JSON input. Since the
+ * input does not contain the files read through the import callback, each entry also records
+ * all callback queries of the compilation together with the hashes of their responses.
+ * An entry is only used if replaying these queries yields the same responses.
+ *
+ * Failures to read or write the cache directory are not errors, they just cause cache misses.
+ */
+class CompilationCache
+{
+public:
+	/// A query to the read callback and the hash of its response.
+	struct Query
+	{
+		std::string kind;
+		std::string path;
+		bool success;
+		util::h256 responseHash;
+	};
+
+	/// Creates a cache that only keeps entries in memory.
+	CompilationCache() = default;
+	/// Creates a cache that stores its entries in @a _directory.
+	explicit CompilationCache(boost::filesystem::path _directory): m_directory(std::move(_directory)) {}
+
+	/// @returns the cached output for @a _input, provided that @a _readFile still gives the
+	/// same responses as during the compilation that produced it.
+	std::optional<Json::Value> lookup(Json::Value const& _input, ReadCallback::Callback const& _readFile);
+	/// Stores @a _output as the output for @a _input. Outputs containing errors are not stored,
+	/// since they might be caused by the environment, e.g. by a missing file.
+	/// @param _queries all queries to the read callback made while compiling @a _input.
+	void store(Json::Value const& _input, std::vector<Query> const& _queries, Json::Value const& _output);
+
+	/// @returns a read callback that forwards to @a _readFile and appends every query to @a _queries.
+	static ReadCallback::Callback recordingCallback(
+		ReadCallback::Callback _readFile,
+		std::vector<Query>& _queries
+	);
+
+	/// @returns a JSON object containing the number of cache hits and misses of this cache.
+	Json::Value statistics() const;
+
+private:
+	/// Maximal number of entries kept in memory.
+	static size_t constexpr c_maxMemoryEntries = 32;
+
+	/// @returns the key of the cache entry for @a _input.
+	static util::h256 entryKey(Json::Value const& _input);
+	/// @returns the path of the cache entry with the given key in the cache directory.
+	boost::filesystem::path entryPath(util::h256 const& _key) const;
+	/// @returns true if @a _entry is well-formed and @a _readFile gives the same responses
+	/// to its queries as recorded.
+	static bool isValid(Json::Value const& _entry, ReadCallback::Callback const& _readFile);
+	/// Writes @a _entry to the cache directory. Failures are ignored.
+	void writeEntry(util::h256 const& _key, Json::Value const& _entry) const;
+	/// Adds @a _entry to the entries kept in memory, evicting the least recently used one if needed.
+	void keepInMemory(util::h256 const& _key, Json::Value _entry);
+
+	std::optional<boost::filesystem::path> m_directory;
+	/// Entries kept in memory, most recently used last.
+	std::list<std::pair<util::h256, Json::Value>> m_memoryEntries;
+	size_t m_hits = 0;
+	size_t m_misses = 0;
+};
+
+}
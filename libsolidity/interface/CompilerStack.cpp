@@ -37,6 +37,7 @@
 #include <libsolidity/analysis/ViewPureChecker.h>
 
 #include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/ASTVisitor.h>
 #include <libsolidity/ast/TypeProvider.h>
 #include <libsolidity/ast/ASTJsonImporter.h>
 #include <libsolidity/codegen/Compiler.h>
@@ -67,6 +68,10 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::langutil;
@@ -82,19 +87,21 @@ CompilerStack::CompilerStack(ReadCallback::Callback const& _readFile):
 	m_enabledSMTSolvers{smt::SMTSolverChoice::All()},
 	m_generateIR{false},
 	m_generateEwasm{false},
+	m_typeProvider{make_unique<TypeProvider>()},
 	m_errorList{},
 	m_errorReporter{m_errorList}
 {
-	// Because TypeProvider is currently a singleton API, we must ensure that
+	// Because the TypeProvider instance is selected process-wide, we must ensure that
 	// no more than one entity is actually using it at a time.
 	solAssert(g_compilerStackCounts == 0, "You shall not have another CompilerStack aside me.");
 	++g_compilerStackCounts;
+	m_previousTypeProvider = TypeProvider::setInstance(m_typeProvider.get());
 }
 
 CompilerStack::~CompilerStack()
 {
 	--g_compilerStackCounts;
-	TypeProvider::reset();
+	TypeProvider::setInstance(m_previousTypeProvider);
 }
 
 std::optional<CompilerStack::Remapping> CompilerStack::parseRemapping(string const& _remapping)
@@ -140,6 +147,28 @@ void CompilerStack::setSMTSolverChoice(smt::SMTSolverChoice _enabledSMTSolvers)
 	m_enabledSMTSolvers = _enabledSMTSolvers;
 }
 
+void CompilerStack::setSMTPortfolioStrategy(smt::PortfolioStrategy _strategy)
+{
+	if (m_stackState >= ParsingPerformed)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must set SMT portfolio strategy before parsing."));
+	m_smtPortfolioStrategy = _strategy;
+}
+
+void CompilerStack::setSMTQueryCache(shared_ptr<smt::SMTQueryCache> _cache)
+{
+	if (m_stackState >= ParsingPerformed)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must set SMT query cache before parsing."));
+	m_smtQueryCache = move(_cache);
+}
+
+void CompilerStack::setParallelism(unsigned _jobs)
+{
+	if (m_stackState >= CompilationSuccessful)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must set parallelism before compiling."));
+	solAssert(_jobs > 0, "At least one job is required.");
+	m_parallelism = _jobs;
+}
+
 void CompilerStack::setLibraries(std::map<std::string, util::h160> const& _libraries)
 {
 	if (m_stackState >= ParsingPerformed)
@@ -203,8 +232,12 @@ void CompilerStack::reset(bool _keepSettings)
 		m_libraries.clear();
 		m_evmVersion = langutil::EVMVersion();
 		m_enabledSMTSolvers = smt::SMTSolverChoice::All();
+		m_smtPortfolioStrategy = smt::PortfolioStrategy::Sequential;
+		m_smtQueryCache.reset();
 		m_generateIR = false;
 		m_generateEwasm = false;
+		m_profileOptimiser = false;
+		m_parallelism = 1;
 		m_revertStrings = RevertStrings::Default;
 		m_optimiserSettings = OptimiserSettings::minimal();
 		m_metadataLiteralSources = false;
@@ -215,16 +248,25 @@ void CompilerStack::reset(bool _keepSettings)
 	m_sourceOrder.clear();
 	m_contracts.clear();
 	m_errorReporter.clear();
+	m_yulStrings.clear();
 	TypeProvider::reset();
 }
 
 void CompilerStack::setSources(StringMap _sources)
+{
+	SourceBufferMap buffers;
+	for (auto& source: _sources)
+		buffers.emplace(source.first, SourceBuffer(std::move(source.second)));
+	setSources(std::move(buffers));
+}
+
+void CompilerStack::setSources(SourceBufferMap _sources)
 {
 	if (m_stackState == SourcesSet)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Cannot change sources once set."));
 	if (m_stackState != Empty)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must set sources before parsing."));
-	for (auto source: _sources)
+	for (auto& source: _sources)
 		m_sources[source.first].scanner = make_shared<Scanner>(CharStream(/*content*/std::move(source.second), /*name*/source.first));
 	m_stackState = SourcesSet;
 }
@@ -233,6 +275,7 @@ bool CompilerStack::parse()
 {
 	if (m_stackState != SourcesSet)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must call parse only after the SourcesSet state."));
+	yul::YulStringRepository::Scope yulStringScope(m_yulStrings);
 	m_errorReporter.clear();
 
 	if (SemVerVersion{string(VersionString)}.isPrerelease())
@@ -254,11 +297,10 @@ bool CompilerStack::parse()
 		else
 		{
 			source.ast->annotation().path = path;
-			for (auto const& newSource: loadMissingSources(*source.ast, path))
+			for (auto& newSource: loadMissingSources(*source.ast, path))
 			{
 				string const& newPath = newSource.first;
-				string const& newContents = newSource.second;
-				m_sources[newPath].scanner = make_shared<Scanner>(CharStream(newContents, newPath));
+				m_sources[newPath].scanner = make_shared<Scanner>(CharStream(std::move(newSource.second), newPath));
 				sourcesToParse.push_back(newPath);
 			}
 		}
@@ -274,6 +316,7 @@ void CompilerStack::importASTs(map<string, Json::Value> const& _sources)
 {
 	if (m_stackState != Empty)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must call importASTs only before the SourcesSet state."));
+	yul::YulStringRepository::Scope yulStringScope(m_yulStrings);
 	m_sourceJsons = _sources;
 	map<string, ASTPointer<SourceUnit>> reconstructedSources = ASTJsonImporter(m_evmVersion).jsonToSourceUnit(m_sourceJsons);
 	for (auto& src: reconstructedSources)
@@ -294,6 +337,7 @@ bool CompilerStack::analyze()
 {
 	if (m_stackState != ParsingPerformed || m_stackState >= AnalysisPerformed)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must call analyze only after parsing was performed."));
+	yul::YulStringRepository::Scope yulStringScope(m_yulStrings);
 	resolveImports();
 
 	bool noErrors = true;
@@ -424,7 +468,15 @@ bool CompilerStack::analyze()
 
 		if (noErrors)
 		{
-			ModelChecker modelChecker(m_errorReporter, m_smtlib2Responses, m_readFile, m_enabledSMTSolvers);
+			ModelChecker modelChecker(
+				m_errorReporter,
+				m_smtlib2Responses,
+				m_readFile,
+				m_enabledSMTSolvers,
+				m_parallelism,
+				m_smtPortfolioStrategy,
+				m_smtQueryCache.get()
+			);
 			for (Source const* source: m_sourceOrder)
 				if (source->ast)
 					modelChecker.analyze(*source->ast);
@@ -480,6 +532,7 @@ bool CompilerStack::isRequestedContract(ContractDefinition const& _contract) con
 
 bool CompilerStack::compile()
 {
+	yul::YulStringRepository::Scope yulStringScope(m_yulStrings);
 	if (m_stackState < AnalysisPerformed)
 		if (!parseAndAnalyze())
 			return false;
@@ -488,18 +541,26 @@ bool CompilerStack::compile()
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Called compile with errors."));
 
 	// Only compile contracts individually which have been requested.
-	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+	vector<ContractDefinition const*> requestedContracts;
 	for (Source const* source: m_sourceOrder)
 		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
 			if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
 				if (isRequestedContract(*contract))
-				{
-					compileContract(*contract, otherCompilers);
-					if (m_generateIR || m_generateEwasm)
-						generateIR(*contract);
-					if (m_generateEwasm)
-						generateEwasm(*contract);
-				}
+					requestedContracts.push_back(contract);
+
+	if (m_parallelism > 1)
+		compileContractsInParallel(requestedContracts);
+
+	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+	for (ContractDefinition const* contract: requestedContracts)
+	{
+		if (m_parallelism <= 1)
+			compileContract(*contract, otherCompilers);
+		if (m_generateIR || m_generateEwasm)
+			generateIR(*contract);
+		if (m_generateEwasm)
+			generateEwasm(*contract);
+	}
 	m_stackState = CompilationSuccessful;
 	this->link();
 	return true;
@@ -634,6 +695,15 @@ string const& CompilerStack::ewasm(string const& _contractName) const
 	return contract(_contractName).ewasm;
 }
 
+Json::Value CompilerStack::optimiserProfile(string const& _contractName) const
+{
+	if (m_stackState != CompilationSuccessful)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Compilation was not successful."));
+
+	Contract const& currentContract = contract(_contractName);
+	return currentContract.optimiserProfile ? currentContract.optimiserProfile->toJson() : Json::Value{};
+}
+
 evmasm::LinkerObject const& CompilerStack::ewasmObject(string const& _contractName) const
 {
 	if (m_stackState != CompilationSuccessful)
@@ -875,8 +945,8 @@ tuple<int, int, int, int> CompilerStack::positionFromSourceLocation(SourceLocati
 	int startColumn;
 	int endLine;
 	int endColumn;
-	tie(startLine, startColumn) = scanner(_sourceLocation.source->name()).translatePositionToLineColumn(_sourceLocation.start);
-	tie(endLine, endColumn) = scanner(_sourceLocation.source->name()).translatePositionToLineColumn(_sourceLocation.end);
+	tie(startLine, startColumn) = scanner(_sourceLocation.sourceName()).translatePositionToLineColumn(_sourceLocation.start);
+	tie(endLine, endColumn) = scanner(_sourceLocation.sourceName()).translatePositionToLineColumn(_sourceLocation.end);
 
 	return make_tuple(++startLine, ++startColumn, ++endLine, ++endColumn);
 }
@@ -885,28 +955,34 @@ tuple<int, int, int, int> CompilerStack::positionFromSourceLocation(SourceLocati
 h256 const& CompilerStack::Source::keccak256() const
 {
 	if (keccak256HashCached == h256{})
-		keccak256HashCached = util::keccak256(scanner->source());
+	{
+		string_view source = scanner->source();
+		keccak256HashCached = util::keccak256(bytesConstRef(reinterpret_cast<uint8_t const*>(source.data()), source.size()));
+	}
 	return keccak256HashCached;
 }
 
 h256 const& CompilerStack::Source::swarmHash() const
 {
 	if (swarmHashCached == h256{})
-		swarmHashCached = util::bzzr1Hash(scanner->source());
+	{
+		string_view source = scanner->source();
+		swarmHashCached = util::bzzr1Hash(bytes(source.begin(), source.end()));
+	}
 	return swarmHashCached;
 }
 
 string const& CompilerStack::Source::ipfsUrl() const
 {
 	if (ipfsUrlCached.empty())
-		ipfsUrlCached = "dweb:/ipfs/" + util::ipfsHashBase58(scanner->source());
+		ipfsUrlCached = "dweb:/ipfs/" + util::ipfsHashBase58(string(scanner->source()));
 	return ipfsUrlCached;
 }
 
-StringMap CompilerStack::loadMissingSources(SourceUnit const& _ast, std::string const& _sourcePath)
+SourceBufferMap CompilerStack::loadMissingSources(SourceUnit const& _ast, std::string const& _sourcePath)
 {
 	solAssert(m_stackState < ParsingPerformed, "");
-	StringMap newSources;
+	SourceBufferMap newSources;
 	try
 	{
 		for (auto const& node: _ast.nodes())
@@ -928,7 +1004,9 @@ StringMap CompilerStack::loadMissingSources(SourceUnit const& _ast, std::string
 					result = m_readFile(ReadCallback::kindString(ReadCallback::Kind::ReadFile), importPath);
 
 				if (result.success)
-					newSources[importPath] = result.responseOrErrorMessage;
+					newSources[importPath] = result.contents ?
+						std::move(*result.contents) :
+						SourceBuffer(std::move(result.responseOrErrorMessage));
 				else
 				{
 					m_errorReporter.parserError(
@@ -1045,10 +1123,170 @@ void CompilerStack::compileContract(
 	for (auto const* dependency: _contract.annotation().contractDependencies)
 		compileContract(*dependency, _otherCompilers);
 
+	_otherCompilers[&_contract] = compileContractCode(_contract, _otherCompilers, m_parallelism);
+	checkContractCodeSize(_contract);
+}
+
+void CompilerStack::compileContractsInParallel(vector<ContractDefinition const*> const& _contracts)
+{
+	solAssert(m_stackState >= AnalysisPerformed, "");
+	if (m_hasError)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Called compile with errors."));
+
+	// Determine the order in which compileContract would compile the contracts.
+	vector<ContractDefinition const*> order;
+	map<ContractDefinition const*, size_t> indices;
+	std::function<void(ContractDefinition const&)> addContract = [&](ContractDefinition const& _contract)
+	{
+		if (indices.count(&_contract) || !_contract.canBeDeployed())
+			return;
+		for (auto const* dependency: _contract.annotation().contractDependencies)
+			addContract(*dependency);
+		indices[&_contract] = order.size();
+		order.push_back(&_contract);
+	};
+	for (ContractDefinition const* contract: _contracts)
+		addContract(*contract);
+
+	// The creation code of every contract embeds the assemblies of all contracts it
+	// (transitively) depends on, including those reachable through contracts that cannot
+	// be deployed themselves.
+	vector<set<size_t>> embedded(order.size());
+	for (size_t i = 0; i < order.size(); ++i)
+	{
+		set<ContractDefinition const*> visited;
+		std::function<void(ContractDefinition const&)> visit = [&](ContractDefinition const& _contract)
+		{
+			for (auto const* dependency: _contract.annotation().contractDependencies)
+				if (visited.insert(dependency).second)
+				{
+					if (indices.count(dependency))
+						embedded[i].insert(indices.at(dependency));
+					visit(*dependency);
+				}
+		};
+		visit(*order[i]);
+	}
+
+	// A contract has to wait for all contracts it embeds. The optimiser modifies embedded
+	// assemblies in place, so contracts that share an embedded assembly are compiled
+	// in their sequential order.
+	vector<vector<size_t>> prerequisites(order.size());
+	for (size_t i = 0; i < order.size(); ++i)
+		for (size_t j = 0; j < i; ++j)
+			if (
+				embedded[i].count(j) ||
+				any_of(embedded[j].begin(), embedded[j].end(), [&](size_t k) { return embedded[i].count(k); })
+			)
+				prerequisites[i].push_back(j);
+
+	// Metadata is lazily computed and caches the hashes of shared sources,
+	// so generate it before the work is distributed.
+	for (ContractDefinition const* contract: order)
+		metadata(m_contracts.at(contract->fullyQualifiedName()));
+	// Annotations and the interface lists of contracts are also created on first access.
+	SimpleASTVisitor initializer{
+		[](ASTNode const& _node)
+		{
+			_node.annotation();
+			if (auto contract = dynamic_cast<ContractDefinition const*>(&_node))
+			{
+				contract->interfaceFunctionList();
+				contract->interfaceEvents();
+			}
+			return true;
+		},
+		[](ASTNode const&) {}
+	};
+	for (Source const* source: m_sourceOrder)
+		source->ast->accept(initializer);
+
+	// The threads are used either for the contracts or, if there is only one,
+	// for its sub-assemblies, so that there are at most m_parallelism of them.
+	unsigned const subParallelism = order.size() > 1 ? 1 : m_parallelism;
+
+	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+	vector<bool> started(order.size(), false);
+	vector<bool> finished(order.size(), false);
+	vector<exception_ptr> failures(order.size());
+	bool failed = false;
+	mutex jobsMutex;
+	condition_variable jobFinished;
+
+	auto worker = [&]()
+	{
+		yul::YulStringRepository::Scope yulStringScope(m_yulStrings);
+		unique_lock<mutex> lock(jobsMutex);
+		while (!failed)
+		{
+			// Always pick the first contract that is ready to be compiled.
+			optional<size_t> next;
+			for (size_t i = 0; i < order.size() && !next; ++i)
+				if (!started[i] && all_of(
+					prerequisites[i].begin(),
+					prerequisites[i].end(),
+					[&](size_t j) { return finished[j]; }
+				))
+					next = i;
+			if (!next)
+			{
+				if (all_of(started.begin(), started.end(), [](bool _started) { return _started; }))
+					return;
+				jobFinished.wait(lock);
+				continue;
+			}
+
+			started[*next] = true;
+			auto availableCompilers = otherCompilers;
+			lock.unlock();
+			shared_ptr<Compiler const> compiler;
+			try
+			{
+				compiler = compileContractCode(*order[*next], availableCompilers, subParallelism);
+			}
+			catch (...)
+			{
+				failures[*next] = current_exception();
+			}
+			lock.lock();
+
+			if (failures[*next])
+				failed = true;
+			else
+				otherCompilers[order[*next]] = move(compiler);
+			finished[*next] = true;
+			jobFinished.notify_all();
+		}
+	};
+
+	vector<thread> threads;
+	for (unsigned i = 0; i < min<size_t>(m_parallelism, order.size()); ++i)
+		threads.emplace_back(worker);
+	for (thread& t: threads)
+		t.join();
+
+	// Report the first failure in sequential order, just like sequential compilation would.
+	for (exception_ptr const& failure: failures)
+		if (failure)
+			rethrow_exception(failure);
+
+	for (ContractDefinition const* contract: order)
+		checkContractCodeSize(*contract);
+}
+
+shared_ptr<Compiler> CompilerStack::compileContractCode(
+	ContractDefinition const& _contract,
+	map<ContractDefinition const*, shared_ptr<Compiler const>> const& _otherCompilers,
+	unsigned _parallelism
+)
+{
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
 
-	shared_ptr<Compiler> compiler = make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings);
+	shared_ptr<Compiler> compiler = make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings, _parallelism);
 	compiledContract.compiler = compiler;
+	if (m_profileOptimiser && !compiledContract.optimiserProfile)
+		compiledContract.optimiserProfile = make_shared<util::OptimiserProfile>();
+	util::OptimiserProfile::Scope profileScope(compiledContract.optimiserProfile.get());
 
 	bytes cborEncodedMetadata = createCBORMetadata(
 		metadata(compiledContract),
@@ -1085,6 +1323,13 @@ void CompilerStack::compileContract(
 		solAssert(false, "Assembly exception for deployed bytecode");
 	}
 
+	return compiler;
+}
+
+void CompilerStack::checkContractCodeSize(ContractDefinition const& _contract)
+{
+	Contract const& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
+
 	// Throw a warning if EIP-170 limits are exceeded:
 	//   If contract creation initialization returns data with length of more than 0x6000 (214 + 213) bytes,
 	//   contract creation fails with an out of gas error.
@@ -1099,8 +1344,6 @@ void CompilerStack::compileContract(
 			"Consider enabling the optimizer (with a low \"runs\" value!), "
 			"turning off revert strings, or using libraries."
 		);
-
-	_otherCompilers[compiledContract.contract] = compiler;
 }
 
 void CompilerStack::generateIR(ContractDefinition const& _contract)
@@ -1119,7 +1362,10 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 	for (auto const* dependency: _contract.annotation().contractDependencies)
 		generateIR(*dependency);
 
-	IRGenerator generator(m_evmVersion, m_revertStrings, m_optimiserSettings);
+	if (m_profileOptimiser && !compiledContract.optimiserProfile)
+		compiledContract.optimiserProfile = make_shared<util::OptimiserProfile>();
+	util::OptimiserProfile::Scope profileScope(compiledContract.optimiserProfile.get());
+	IRGenerator generator(m_evmVersion, m_revertStrings, m_optimiserSettings, m_parallelism);
 	tie(compiledContract.yulIR, compiledContract.yulIROptimized) = generator.run(_contract);
 }
 
@@ -1212,7 +1458,10 @@ string CompilerStack::createMetadata(Contract const& _contract) const
 		solAssert(s.second.scanner, "Scanner not available");
 		meta["sources"][s.first]["keccak256"] = "0x" + toHex(s.second.keccak256().asBytes());
 		if (m_metadataLiteralSources)
-			meta["sources"][s.first]["content"] = s.second.scanner->source();
+		{
+			string_view source = s.second.scanner->source();
+			meta["sources"][s.first]["content"] = Json::Value(source.data(), source.data() + source.size());
+		}
 		else
 		{
 			meta["sources"][s.first]["urls"] = Json::arrayValue;
@@ -1248,6 +1497,14 @@ string CompilerStack::createMetadata(Contract const& _contract) const
 		{
 			details["yulDetails"] = Json::objectValue;
 			details["yulDetails"]["stackAllocation"] = m_optimiserSettings.optimizeStackAllocation;
+			if (m_optimiserSettings.yulFunctionParallel)
+				details["yulDetails"]["functionParallel"] = true;
+			if (!m_optimiserSettings.yulOptimiserSteps.empty())
+				details["yulDetails"]["optimizerSteps"] = m_optimiserSettings.yulOptimiserSteps;
+			if (m_optimiserSettings.yulOptimiserMaxRounds != OptimiserSettings{}.yulOptimiserMaxRounds)
+				details["yulDetails"]["maxRounds"] = Json::LargestUInt(m_optimiserSettings.yulOptimiserMaxRounds);
+			if (m_optimiserSettings.yulOptimiserTimeBudget)
+				details["yulDetails"]["timeBudget"] = Json::LargestUInt(m_optimiserSettings.yulOptimiserTimeBudget);
 		}
 
 		meta["settings"]["optimizer"]["details"] = std::move(details);
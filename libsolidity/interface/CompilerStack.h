@@ -27,16 +27,21 @@
 #include <libsolidity/interface/OptimiserSettings.h>
 #include <libsolidity/interface/Version.h>
 #include <libsolidity/interface/DebugSettings.h>
+#include <libsolidity/formal/SMTQueryCache.h>
 #include <libsolidity/formal/SolverInterface.h>
 
 #include <liblangutil/ErrorReporter.h>
 #include <liblangutil/EVMVersion.h>
+#include <liblangutil/SourceBuffer.h>
 #include <liblangutil/SourceLocation.h>
 
 #include <libevmasm/LinkerObject.h>
 
+#include <libyul/YulString.h>
+
 #include <libsolutil/Common.h>
 #include <libsolutil/FixedHash.h>
+#include <libsolutil/OptimiserProfile.h>
 
 #include <boost/noncopyable.hpp>
 #include <json/json.h>
@@ -73,6 +78,7 @@ class Compiler;
 class GlobalContext;
 class Natspec;
 class DeclarationContainer;
+class TypeProvider;
 
 /**
  * Easy to use and self-contained Solidity compiler with as few header dependencies as possible.
@@ -164,6 +170,20 @@ public:
 	/// Set which SMT solvers should be enabled.
 	void setSMTSolverChoice(smt::SMTSolverChoice _enabledSolvers);
 
+	/// Set how the answers of multiple SMT solvers are combined.
+	/// Racing strategies query the solvers concurrently.
+	void setSMTPortfolioStrategy(smt::PortfolioStrategy _strategy);
+
+	/// Sets a cache for the answers of SMT solvers, which may be shared between compilations.
+	/// A null pointer disables the cache.
+	void setSMTQueryCache(std::shared_ptr<smt::SMTQueryCache> _cache);
+
+	/// Sets the number of threads used to generate code for independent contracts,
+	/// to optimise independent sub-assemblies and to check the verification targets of the SMTChecker.
+	/// A value of one (the default) compiles all contracts sequentially.
+	/// The generated code does not depend on this setting.
+	void setParallelism(unsigned _jobs);
+
 	/// Sets the requested contract names by source.
 	/// If empty, no filtering is performed and every contract
 	/// found in the supplied sources is compiled.
@@ -179,6 +199,9 @@ public:
 	/// Enable experimental generation of Ewasm code. If enabled, IR is also generated.
 	void enableEwasmGeneration(bool _enable = true) { m_generateEwasm = _enable; }
 
+	/// Enable recording the runs of the optimiser steps for each contract.
+	void enableOptimiserProfile(bool _enable = true) { m_profileOptimiser = _enable; }
+
 	/// @arg _metadataLiteralSources When true, store sources as literals in the contract metadata.
 	/// Must be set before parsing.
 	void useMetadataLiteralSources(bool _metadataLiteralSources);
@@ -190,6 +213,8 @@ public:
 
 	/// Sets the sources. Must be set before parsing.
 	void setSources(StringMap _sources);
+	/// Sets the sources without copying their contents. Must be set before parsing.
+	void setSources(langutil::SourceBufferMap _sources);
 
 	/// Adds a response to an SMTLib2 query (identified by the hash of the query input).
 	/// Must be set before parsing.
@@ -256,6 +281,10 @@ public:
 	/// @returns the Ewasm text representation of a contract.
 	std::string const& ewasm(std::string const& _contractName) const;
 
+	/// @returns the runs of the optimiser steps for a contract as a JSON array,
+	/// null if the optimiser profile is not enabled.
+	Json::Value optimiserProfile(std::string const& _contractName) const;
+
 	/// @returns the Ewasm representation of a contract.
 	evmasm::LinkerObject const& ewasmObject(std::string const& _contractName) const;
 
@@ -342,6 +371,8 @@ private:
 		std::string yulIROptimized; ///< Optimized experimental Yul IR code.
 		std::string ewasm; ///< Experimental Ewasm text representation
 		evmasm::LinkerObject ewasmObject; ///< Experimental Ewasm code
+		/// Runs of the optimiser steps, while generating the bytecode and the IR.
+		std::shared_ptr<util::OptimiserProfile> optimiserProfile;
 		mutable std::unique_ptr<std::string const> metadata; ///< The metadata json that will be hashed into the chain.
 		mutable std::unique_ptr<Json::Value const> abi;
 		mutable std::unique_ptr<Json::Value const> storageLayout;
@@ -354,7 +385,7 @@ private:
 	/// Loads the missing sources from @a _ast (named @a _path) using the callback
 	/// @a m_readFile and stores the absolute paths of all imports in the AST annotations.
 	/// @returns the newly loaded sources.
-	StringMap loadMissingSources(SourceUnit const& _ast, std::string const& _path);
+	langutil::SourceBufferMap loadMissingSources(SourceUnit const& _ast, std::string const& _path);
 	std::string applyRemapping(std::string const& _path, std::string const& _context);
 	void resolveImports();
 
@@ -372,6 +403,24 @@ private:
 		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>>& _otherCompilers
 	);
 
+	/// Compiles the given contracts (and their dependencies) using up to m_parallelism threads.
+	/// Produces the same results (including the order of warnings) as calling
+	/// compileContract on each of them in turn.
+	void compileContractsInParallel(std::vector<ContractDefinition const*> const& _contracts);
+
+	/// Generates the code for a single contract whose dependencies have already been compiled
+	/// and stores the resulting objects. Does not report any errors, so it can be called
+	/// from a worker thread.
+	/// @param _parallelism maximum number of threads used to optimise the sub-assemblies.
+	std::shared_ptr<Compiler> compileContractCode(
+		ContractDefinition const& _contract,
+		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>> const& _otherCompilers,
+		unsigned _parallelism
+	);
+
+	/// Warns if the runtime code of the compiled contract exceeds the limit from EIP-170.
+	void checkContractCodeSize(ContractDefinition const& _contract);
+
 	/// Generate Yul IR for a single contract.
 	/// The IR is stored but otherwise unused.
 	void generateIR(ContractDefinition const& _contract);
@@ -433,13 +482,24 @@ private:
 	RevertStrings m_revertStrings = RevertStrings::Default;
 	langutil::EVMVersion m_evmVersion;
 	smt::SMTSolverChoice m_enabledSMTSolvers;
+	smt::PortfolioStrategy m_smtPortfolioStrategy = smt::PortfolioStrategy::Sequential;
+	std::shared_ptr<smt::SMTQueryCache> m_smtQueryCache;
 	std::map<std::string, std::set<std::string>> m_requestedContractNames;
 	bool m_generateIR;
 	bool m_generateEwasm;
+	bool m_profileOptimiser = false;
+	unsigned m_parallelism = 1;
 	std::map<std::string, util::h160> m_libraries;
 	/// list of path prefix remappings, e.g. mylibrary: github.com/ethereum = /usr/local/ethereum
 	/// "context:prefix=target"
 	std::vector<Remapping> m_remappings;
+	/// Owns the YulStrings of inline assembly blocks and of the generated Yul code.
+	/// It is the current repository in all phases of the compilation.
+	yul::YulStringRepository m_yulStrings;
+	/// Owns all types created while analysing and compiling the sources.
+	std::unique_ptr<TypeProvider> m_typeProvider;
+	/// The provider that was selected before this compiler stack was created.
+	TypeProvider* m_previousTypeProvider = nullptr;
 	std::map<std::string const, Source> m_sources;
 	// if imported, store AST-JSONS for each filename
 	std::map<std::string, Json::Value> m_sourceJsons;
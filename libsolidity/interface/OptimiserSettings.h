@@ -22,7 +22,10 @@
 
 #pragma once
 
+#include <libyul/optimiser/Suite.h>
+
 #include <cstddef>
+#include <string>
 
 namespace solidity::frontend
 {
@@ -74,6 +77,10 @@ struct OptimiserSettings
 			runConstantOptimiser == _other.runConstantOptimiser &&
 			optimizeStackAllocation == _other.optimizeStackAllocation &&
 			runYulOptimiser == _other.runYulOptimiser &&
+			yulFunctionParallel == _other.yulFunctionParallel &&
+			yulOptimiserSteps == _other.yulOptimiserSteps &&
+			yulOptimiserMaxRounds == _other.yulOptimiserMaxRounds &&
+			yulOptimiserTimeBudget == _other.yulOptimiserTimeBudget &&
 			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment;
 	}
 
@@ -95,6 +102,17 @@ struct OptimiserSettings
 	bool optimizeStackAllocation = false;
 	/// Yul optimiser with default settings. Will only run on certain parts of the code for now.
 	bool runYulOptimiser = false;
+	/// Run the function-local steps of the Yul optimiser on each function separately,
+	/// which allows running them concurrently. Changes the names generated by the optimiser.
+	bool yulFunctionParallel = false;
+	/// Sequence of Yul optimiser steps given as abbreviations (see yul::OptimiserSuite).
+	/// The default sequence is used if empty.
+	std::string yulOptimiserSteps;
+	/// Maximum number of times the bracketed part of the Yul optimiser step sequence is run.
+	size_t yulOptimiserMaxRounds = yul::OptimiserSuite::DefaultMaxRounds;
+	/// Time in milliseconds after which the Yul optimiser does not start any further step
+	/// of the sequence, unlimited if zero. Makes the output depend on the speed of the machine.
+	size_t yulOptimiserTimeBudget = 0;
 	/// This specifies an estimate on how often each opcode in this assembly will be executed,
 	/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 	size_t expectedExecutionsPerDeployment = 200;
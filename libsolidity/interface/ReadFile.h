@@ -18,10 +18,13 @@
 #pragma once
 
 #include <liblangutil/Exceptions.h>
+#include <liblangutil/SourceBuffer.h>
 
 #include <boost/noncopyable.hpp>
 #include <functional>
+#include <optional>
 #include <string>
+#include <string_view>
 
 namespace solidity::frontend
 {
@@ -34,6 +37,15 @@ public:
 	{
 		bool success;
 		std::string responseOrErrorMessage;
+		/// Contents of a successfully read file that are shared instead of copied into
+		/// responseOrErrorMessage, e.g. because the file is memory mapped. Optional.
+		std::optional<langutil::SourceBuffer> contents = std::nullopt;
+
+		/// @returns the contents if they are set and responseOrErrorMessage otherwise.
+		std::string_view response() const
+		{
+			return contents ? contents->view() : std::string_view(responseOrErrorMessage);
+		}
 	};
 
 	enum class Kind
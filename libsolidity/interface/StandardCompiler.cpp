@@ -25,10 +25,12 @@
 #include <libsolidity/ast/ASTJsonConverter.h>
 #include <libyul/AssemblyStack.h>
 #include <libyul/Exceptions.h>
+#include <libyul/optimiser/Suite.h>
 #include <liblangutil/SourceReferenceFormatter.h>
 #include <libevmasm/Instruction.h>
 #include <libsolutil/JSON.h>
 #include <libsolutil/Keccak256.h>
+#include <libsolutil/OptimiserProfile.h>
 
 #include <boost/algorithm/cxx11/any_of.hpp>
 #include <boost/algorithm/string.hpp>
@@ -79,9 +81,9 @@ Json::Value formatFatalError(string const& _type, string const& _message)
 Json::Value formatSourceLocation(SourceLocation const* location)
 {
 	Json::Value sourceLocation;
-	if (location && location->source && !location->source->name().empty())
+	if (location && location->hasSource() && !location->sourceName().empty())
 	{
-		sourceLocation["file"] = location->source->name();
+		sourceLocation["file"] = location->sourceName();
 		sourceLocation["start"] = location->start;
 		sourceLocation["end"] = location->end;
 	}
@@ -166,7 +168,8 @@ bool isArtifactRequested(Json::Value const& _outputSelection, string const& _art
 		/// @TODO support sub-matching, e.g "evm" matches "evm.assembly"
 		if (artifact == _artifact)
 			return true;
-		else if (artifact == "*")
+		// The optimizer profile depends on the speed of the machine and is never matched by "*".
+		else if (artifact == "*" && _artifact != "optimizerProfile")
 		{
 			// "ir", "irOptimized", "wast" and "ewasm.wast" can only be matched by "*" if activated.
 			if (experimental.count(_artifact) == 0 || _wildcardMatchesExperimental)
@@ -236,7 +239,8 @@ bool isBinaryRequested(Json::Value const& _outputSelection)
 		"evm.deployedBytecode.sourceMap", "evm.deployedBytecode.linkReferences",
 		"evm.bytecode", "evm.bytecode.object", "evm.bytecode.opcodes", "evm.bytecode.sourceMap",
 		"evm.bytecode.linkReferences",
-		"evm.gasEstimates", "evm.legacyAssembly", "evm.assembly"
+		"evm.gasEstimates", "evm.legacyAssembly", "evm.assembly",
+		"optimizerProfile"
 	};
 
 	for (auto const& fileRequests: _outputSelection)
@@ -282,6 +286,21 @@ bool isIRRequested(Json::Value const& _outputSelection)
 	return false;
 }
 
+/// @returns true if the optimizer profile was requested for any contract.
+bool isOptimizerProfileRequested(Json::Value const& _outputSelection)
+{
+	if (!_outputSelection.isObject())
+		return false;
+
+	for (auto const& fileRequests: _outputSelection)
+		for (auto const& requests: fileRequests)
+			for (auto const& request: requests)
+				if (request == "optimizerProfile")
+					return true;
+
+	return false;
+}
+
 Json::Value formatLinkReferences(std::map<size_t, std::string> const& linkReferences)
 {
 	Json::Value ret(Json::objectValue);
@@ -351,7 +370,7 @@ std::optional<Json::Value> checkAuxiliaryInputKeys(Json::Value const& _input)
 
 std::optional<Json::Value> checkSettingsKeys(Json::Value const& _input)
 {
-	static set<string> keys{"parserErrorRecovery", "debug", "evmVersion", "libraries", "metadata", "optimizer", "outputSelection", "remappings"};
+	static set<string> keys{"parserErrorRecovery", "debug", "evmVersion", "libraries", "metadata", "optimizer", "outputSelection", "parallelism", "remappings", "smtPortfolio"};
 	return checkKeys(_input, keys, "settings");
 }
 
@@ -487,10 +506,47 @@ boost::variant<OptimiserSettings, Json::Value> parseOptimizerSettings(Json::Valu
 			if (!settings.runYulOptimiser)
 				return formatFatalError("JSONError", "\"Providing yulDetails requires Yul optimizer to be enabled.");
 
-			if (auto result = checkKeys(details["yulDetails"], {"stackAllocation"}, "settings.optimizer.details.yulDetails"))
+			Json::Value const& yulDetails = details["yulDetails"];
+			if (auto result = checkKeys(
+				yulDetails,
+				{"stackAllocation", "functionParallel", "optimizerSteps", "maxRounds", "timeBudget"},
+				"settings.optimizer.details.yulDetails"
+			))
 				return *result;
-			if (auto error = checkOptimizerDetail(details["yulDetails"], "stackAllocation", settings.optimizeStackAllocation))
+			if (auto error = checkOptimizerDetail(yulDetails, "stackAllocation", settings.optimizeStackAllocation))
+				return *error;
+			if (auto error = checkOptimizerDetail(yulDetails, "functionParallel", settings.yulFunctionParallel))
 				return *error;
+			if (yulDetails.isMember("optimizerSteps"))
+			{
+				if (!yulDetails["optimizerSteps"].isString())
+					return formatFatalError("JSONError", "\"settings.optimizer.details.yulDetails.optimizerSteps\" must be a string.");
+				settings.yulOptimiserSteps = yulDetails["optimizerSteps"].asString();
+				try
+				{
+					yul::OptimiserSuite::validateSequence(settings.yulOptimiserSteps);
+				}
+				catch (yul::OptimizerException const& _exception)
+				{
+					return formatFatalError(
+						"JSONError",
+						"Invalid optimizer step sequence in \"settings.optimizer.details.yulDetails.optimizerSteps\": " +
+						*boost::get_error_info<util::errinfo_comment>(_exception)
+					);
+				}
+			}
+			if (yulDetails.isMember("maxRounds"))
+			{
+				if (!yulDetails["maxRounds"].isUInt())
+					return formatFatalError("JSONError", "\"settings.optimizer.details.yulDetails.maxRounds\" must be an unsigned number.");
+				settings.yulOptimiserMaxRounds = yulDetails["maxRounds"].asUInt();
+			}
+			if (yulDetails.isMember("timeBudget"))
+			{
+				if (!yulDetails["timeBudget"].isUInt())
+					return formatFatalError("JSONError", "\"settings.optimizer.details.yulDetails.timeBudget\" must be an unsigned number.");
+				settings.yulOptimiserTimeBudget = yulDetails["timeBudget"].asUInt();
+			}
 		}
 	}
 	return { std::move(settings) };
@@ -541,7 +597,7 @@ boost::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompile
 					"Mismatch between content and supplied hash for \"" + sourceName + "\""
 				));
 			else
-				ret.sources[sourceName] = content;
+				ret.sources[sourceName] = move(content);
 		}
 		else if (sources[sourceName]["urls"].isArray())
 		{
@@ -558,7 +614,8 @@ boost::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompile
 				ReadCallback::Result result = m_readFile(ReadCallback::kindString(ReadCallback::Kind::ReadFile), url.asString());
 				if (result.success)
 				{
-					if (!hash.empty() && !hashMatchesContent(hash, result.responseOrErrorMessage))
+					string content(result.response());
+					if (!hash.empty() && !hashMatchesContent(hash, content))
 						ret.errors.append(formatError(
 							false,
 							"IOError",
@@ -567,7 +624,7 @@ boost::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompile
 						));
 					else
 					{
-						ret.sources[sourceName] =  result.responseOrErrorMessage;
+						ret.sources[sourceName] = move(content);
 						found = true;
 						break;
 					}
@@ -649,6 +706,29 @@ boost::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompile
 		ret.evmVersion = *version;
 	}
 
+	if (settings.isMember("parallelism"))
+	{
+		if (!settings["parallelism"].isUInt() || settings["parallelism"].asUInt() == 0)
+			return formatFatalError("JSONError", "\"settings.parallelism\" must be a positive integer.");
+		ret.parallelism = settings["parallelism"].asUInt();
+	}
+
+	if (settings.isMember("smtPortfolio"))
+	{
+		static map<string, smt::PortfolioStrategy> const strategies{
+			{"sequential", smt::PortfolioStrategy::Sequential},
+			{"race", smt::PortfolioStrategy::Race},
+			{"strictRace", smt::PortfolioStrategy::StrictRace}
+		};
+		Json::Value const& strategy = settings["smtPortfolio"];
+		if (!strategy.isString() || !strategies.count(strategy.asString()))
+			return formatFatalError(
+				"JSONError",
+				"\"settings.smtPortfolio\" must be \"sequential\", \"race\" or \"strictRace\"."
+			);
+		ret.smtPortfolioStrategy = strategies.at(strategy.asString());
+	}
+
 	if (settings.isMember("debug"))
 	{
 		if (auto result = checkKeys(settings["debug"], {"revertStrings"}, "settings.debug"))
@@ -776,12 +856,17 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 	compilerStack.setLibraries(_inputsAndSettings.libraries);
 	compilerStack.useMetadataLiteralSources(_inputsAndSettings.metadataLiteralSources);
 	compilerStack.setMetadataHash(_inputsAndSettings.metadataHash);
+	compilerStack.setParallelism(_inputsAndSettings.parallelism);
+	compilerStack.setSMTPortfolioStrategy(_inputsAndSettings.smtPortfolioStrategy);
+	compilerStack.setSMTQueryCache(m_smtQueryCache);
 	compilerStack.setRequestedContractNames(requestedContractNames(_inputsAndSettings.outputSelection));
 
 	compilerStack.enableIRGeneration(isIRRequested(_inputsAndSettings.outputSelection));
 
 	compilerStack.enableEwasmGeneration(isEwasmRequested(_inputsAndSettings.outputSelection));
 
+	compilerStack.enableOptimiserProfile(isOptimizerProfileRequested(_inputsAndSettings.outputSelection));
+
 	Json::Value errors = std::move(_inputsAndSettings.errors);
 
 	bool const binariesRequested = isBinaryRequested(_inputsAndSettings.outputSelection);
@@ -956,6 +1041,9 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irOptimized", wildcardMatchesExperimental))
 			contractData["irOptimized"] = compilerStack.yulIROptimized(contractName);
 
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "optimizerProfile", false))
+			contractData["optimizerProfile"] = compilerStack.optimiserProfile(contractName);
+
 		// Ewasm
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "ewasm.wast", wildcardMatchesExperimental))
 			contractData["ewasm"]["wast"] = compilerStack.ewasm(contractName);
@@ -1034,6 +1122,7 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 		AssemblyStack::Language::StrictAssembly,
 		_inputsAndSettings.optimiserSettings
 	);
+	stack.setParallelism(_inputsAndSettings.parallelism);
 	string const& sourceName = _inputsAndSettings.sources.begin()->first;
 	string const& sourceContents = _inputsAndSettings.sources.begin()->second;
 
@@ -1070,9 +1159,16 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 	if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, contractName, "ir", wildcardMatchesExperimental))
 		output["contracts"][sourceName][contractName]["ir"] = stack.print();
 
-	stack.optimize();
-
-	MachineAssemblyObject object = stack.assemble(AssemblyStack::Machine::EVM);
+	util::OptimiserProfile profile;
+	bool const profileRequested = isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, contractName, "optimizerProfile", false);
+	MachineAssemblyObject object;
+	{
+		util::OptimiserProfile::Scope profileScope(profileRequested ? &profile : nullptr);
+		stack.optimize();
+		object = stack.assemble(AssemblyStack::Machine::EVM);
+	}
+	if (profileRequested)
+		output["contracts"][sourceName][contractName]["optimizerProfile"] = profile.toJson();
 
 	if (isArtifactRequested(
 		_inputsAndSettings.outputSelection,
@@ -1094,20 +1190,32 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 
 Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
 {
-	YulStringRepository::reset();
+	// All strings created during this request are freed when it is done.
+	YulStringRepository yulStrings;
+	YulStringRepository::Scope yulStringScope(yulStrings);
 
 	try
 	{
-		auto parsed = parseInput(_input);
-		if (parsed.type() == typeid(Json::Value))
-			return boost::get<Json::Value>(std::move(parsed));
-		InputsAndSettings settings = boost::get<InputsAndSettings>(std::move(parsed));
-		if (settings.language == "Solidity")
-			return compileSolidity(std::move(settings));
-		else if (settings.language == "Yul")
-			return compileYul(std::move(settings));
+		Json::Value output;
+		if (!m_cache)
+			output = compileUncached(_input);
+		else if (optional<Json::Value> cachedOutput = m_cache->lookup(_input, m_readFile))
+			output = move(*cachedOutput);
 		else
-			return formatFatalError("JSONError", "Only \"Solidity\" or \"Yul\" is supported as a language.");
+		{
+			vector<CompilationCache::Query> queries;
+			ReadCallback::Callback readFile = m_readFile;
+			m_readFile = CompilationCache::recordingCallback(readFile, queries);
+			ScopeGuard restoreReadFile([&]() { m_readFile = readFile; });
+			output = compileUncached(_input);
+			m_cache->store(_input, queries, output);
+		}
+
+		if (m_cache)
+			output["cache"] = m_cache->statistics();
+		if (m_smtQueryCache)
+			output["smtQueryCache"] = m_smtQueryCache->statistics();
+		return output;
 	}
 	catch (Json::LogicError const& _exception)
 	{
@@ -1127,6 +1235,20 @@ Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
 	}
 }
 
+Json::Value StandardCompiler::compileUncached(Json::Value const& _input)
+{
+	auto parsed = parseInput(_input);
+	if (parsed.type() == typeid(Json::Value))
+		return boost::get<Json::Value>(std::move(parsed));
+	InputsAndSettings settings = boost::get<InputsAndSettings>(std::move(parsed));
+	if (settings.language == "Solidity")
+		return compileSolidity(std::move(settings));
+	else if (settings.language == "Yul")
+		return compileYul(std::move(settings));
+	else
+		return formatFatalError("JSONError", "Only \"Solidity\" or \"Yul\" is supported as a language.");
+}
+
 string StandardCompiler::compile(string const& _input) noexcept
 {
 	Json::Value input;
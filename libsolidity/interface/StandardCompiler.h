@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <libsolidity/interface/CompilationCache.h>
 #include <libsolidity/interface/CompilerStack.h>
 
 #include <optional>
@@ -45,6 +46,17 @@ public:
 	{
 	}
 
+	/// Enables caching the outputs of compilations in memory. A compilation is skipped
+	/// if the same input was compiled before and none of the files it read changed since then.
+	void enableCache() { m_cache.emplace(); }
+	/// Enables caching the outputs of compilations in memory and in @a _directory.
+	void setCacheDirectory(boost::filesystem::path const& _directory) { m_cache.emplace(_directory); }
+	/// Enables caching the answers of SMT solvers in @a _directory.
+	void setSMTQueryCacheDirectory(boost::filesystem::path const& _directory)
+	{
+		m_smtQueryCache = std::make_shared<smt::SMTQueryCache>(_directory);
+	}
+
 	/// Sets all input parameters according to @a _input which conforms to the standardized input
 	/// format, performs compilation and returns a standardized output.
 	Json::Value compile(Json::Value const& _input) noexcept;
@@ -67,6 +79,8 @@ private:
 		std::map<std::string, util::h160> libraries;
 		bool metadataLiteralSources = false;
 		CompilerStack::MetadataHash metadataHash = CompilerStack::MetadataHash::IPFS;
+		unsigned parallelism = 1;
+		smt::PortfolioStrategy smtPortfolioStrategy = smt::PortfolioStrategy::Sequential;
 		Json::Value outputSelection;
 	};
 
@@ -74,10 +88,15 @@ private:
 	/// it in condensed form or an error as a json object.
 	boost::variant<InputsAndSettings, Json::Value> parseInput(Json::Value const& _input);
 
+	/// Parses the input json and performs compilation, without consulting the cache.
+	Json::Value compileUncached(Json::Value const& _input);
+
 	Json::Value compileSolidity(InputsAndSettings _inputsAndSettings);
 	Json::Value compileYul(InputsAndSettings _inputsAndSettings);
 
 	ReadCallback::Callback m_readFile;
+	std::optional<CompilationCache> m_cache;
+	std::shared_ptr<smt::SMTQueryCache> m_smtQueryCache;
 };
 
 }
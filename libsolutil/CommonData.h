@@ -38,14 +38,14 @@
 /// Operators need to stay in the global namespace.
 
 /// Concatenate the contents of a container onto a vector
-template <class T, class U> std::vector<T>& operator+=(std::vector<T>& _a, U const& _b)
+template <class T, class A, class U> std::vector<T, A>& operator+=(std::vector<T, A>& _a, U const& _b)
 {
 	for (auto const& i: _b)
 		_a.push_back(i);
 	return _a;
 }
 /// Concatenate the contents of a container onto a vector, move variant.
-template <class T, class U> std::vector<T>& operator+=(std::vector<T>& _a, U&& _b)
+template <class T, class A, class U> std::vector<T, A>& operator+=(std::vector<T, A>& _a, U&& _b)
 {
 	std::move(_b.begin(), _b.end(), std::back_inserter(_a));
 	return _a;
@@ -77,18 +77,18 @@ template <class U, class... T> std::set<T...>& operator+=(std::set<T...>& _a, U&
 	return _a;
 }
 /// Concatenate two vectors of elements.
-template <class T>
-inline std::vector<T> operator+(std::vector<T> const& _a, std::vector<T> const& _b)
+template <class T, class A>
+inline std::vector<T, A> operator+(std::vector<T, A> const& _a, std::vector<T, A> const& _b)
 {
-	std::vector<T> ret(_a);
+	std::vector<T, A> ret(_a);
 	ret += _b;
 	return ret;
 }
 /// Concatenate two vectors of elements, moving them.
-template <class T>
-inline std::vector<T> operator+(std::vector<T>&& _a, std::vector<T>&& _b)
+template <class T, class A>
+inline std::vector<T, A> operator+(std::vector<T, A>&& _a, std::vector<T, A>&& _b)
 {
-	std::vector<T> ret(std::move(_a));
+	std::vector<T, A> ret(std::move(_a));
 	if (&_a == &_b)
 		ret += ret;
 	else
@@ -336,15 +336,15 @@ bool contains_if(T const& _t, Predicate const& _p)
 /// on the current element and after that. The actual replacement takes
 /// place at the end, but already visited elements might be invalidated.
 /// If nothing is replaced, no copy is performed.
-template <typename T, typename F>
-void iterateReplacing(std::vector<T>& _vector, F const& _f)
+template <typename T, typename A, typename F>
+void iterateReplacing(std::vector<T, A>& _vector, F const& _f)
 {
 	// Concept: _f must be Callable, must accept param T&, must return optional<vector<T>>
 	bool useModified = false;
-	std::vector<T> modifiedVector;
+	std::vector<T, A> modifiedVector;
 	for (size_t i = 0; i < _vector.size(); ++i)
 	{
-		if (std::optional<std::vector<T>> r = _f(_vector[i]))
+		if (auto r = _f(_vector[i]))
 		{
 			if (!useModified)
 			{
@@ -362,16 +362,16 @@ void iterateReplacing(std::vector<T>& _vector, F const& _f)
 
 namespace detail
 {
-template <typename T, typename F, std::size_t... I>
-void iterateReplacingWindow(std::vector<T>& _vector, F const& _f, std::index_sequence<I...>)
+template <typename T, typename A, typename F, std::size_t... I>
+void iterateReplacingWindow(std::vector<T, A>& _vector, F const& _f, std::index_sequence<I...>)
 {
 	// Concept: _f must be Callable, must accept sizeof...(I) parameters of type T&, must return optional<vector<T>>
 	bool useModified = false;
-	std::vector<T> modifiedVector;
+	std::vector<T, A> modifiedVector;
 	size_t i = 0;
 	for (; i + sizeof...(I) <= _vector.size(); ++i)
 	{
-		if (std::optional<std::vector<T>> r = _f(_vector[i + I]...))
+		if (auto r = _f(_vector[i + I]...))
 		{
 			if (!useModified)
 			{
@@ -405,8 +405,8 @@ void iterateReplacingWindow(std::vector<T>& _vector, F const& _f, std::index_seq
 /// on the current element and after that. The actual replacement takes
 /// place at the end, but already visited elements might be invalidated.
 /// If nothing is replaced, no copy is performed.
-template <std::size_t N, typename T, typename F>
-void iterateReplacingWindow(std::vector<T>& _vector, F const& _f)
+template <std::size_t N, typename T, typename A, typename F>
+void iterateReplacingWindow(std::vector<T, A>& _vector, F const& _f)
 {
 	// Concept: _f must be Callable, must accept N parameters of type T&, must return optional<vector<T>>
 	detail::iterateReplacingWindow(_vector, _f, std::make_index_sequence<N>{});
@@ -446,20 +446,20 @@ inline std::string findAnyOf(std::string const& _haystack, std::vector<std::stri
 
 namespace detail
 {
-template<typename T>
-void variadicEmplaceBack(std::vector<T>&) {}
-template<typename T, typename A, typename... Args>
-void variadicEmplaceBack(std::vector<T>& _vector, A&& _a, Args&&... _args)
+template<typename T, typename Allocator>
+void variadicEmplaceBack(std::vector<T, Allocator>&) {}
+template<typename T, typename Allocator, typename A, typename... Args>
+void variadicEmplaceBack(std::vector<T, Allocator>& _vector, A&& _a, Args&&... _args)
 {
 	_vector.emplace_back(std::forward<A>(_a));
 	variadicEmplaceBack(_vector, std::forward<Args>(_args)...);
 }
 }
 
-template<typename T, typename... Args>
-std::vector<T> make_vector(Args&&... _args)
+template<typename T, typename Allocator = std::allocator<T>, typename... Args>
+std::vector<T, Allocator> make_vector(Args&&... _args)
 {
-	std::vector<T> result;
+	std::vector<T, Allocator> result;
 	result.reserve(sizeof...(_args));
 	detail::variadicEmplaceBack(result, std::forward<Args>(_args)...);
 	return result;
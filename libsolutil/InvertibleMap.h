@@ -18,10 +18,18 @@
 #pragma once
 
 #include <map>
+#include <optional>
 #include <set>
+#include <utility>
+#include <vector>
 
 /**
  * Data structure that keeps track of values and keys of a mapping.
+ *
+ * Instead of copying the map to be able to compare it with a later version, a checkpoint
+ * can be taken. While checkpoints are open, the previous values of all modified keys are
+ * recorded, so that the map can be joined with its state at the checkpoint in time
+ * proportional to the number of modifications since then.
  */
 template <class K, class V>
 struct InvertibleMap
@@ -32,6 +40,7 @@ struct InvertibleMap
 
 	void set(K _key, V _value)
 	{
+		record(_key);
 		if (values.count(_key))
 			references[values[_key]].erase(_key);
 		values[_key] = _value;
@@ -41,7 +50,10 @@ struct InvertibleMap
 	void eraseKey(K _key)
 	{
 		if (values.count(_key))
+		{
+			record(_key);
 			references[values[_key]].erase(_key);
+		}
 		values.erase(_key);
 	}
 
@@ -50,16 +62,62 @@ struct InvertibleMap
 		if (references.count(_value))
 		{
 			for (V v: references[_value])
+			{
+				record(v);
 				values.erase(v);
+			}
 			references.erase(_value);
 		}
 	}
 
 	void clear()
 	{
+		for (auto const& item: values)
+			record(item.first);
 		values.clear();
 		references.clear();
 	}
+
+	/// Opens a checkpoint for the current state of the map.
+	/// Checkpoints have to be joined in the reverse order in which they were opened.
+	/// @returns the checkpoint to be passed to joinWithCheckpoint.
+	size_t checkpoint()
+	{
+		++m_openCheckpoints;
+		return m_journal.size();
+	}
+
+	/// Closes @a _checkpoint and removes all keys that were not present at the checkpoint
+	/// or had a different value then.
+	void joinWithCheckpoint(size_t _checkpoint)
+	{
+		// The value of each key at the checkpoint is the one recorded with its first modification.
+		std::map<K, std::optional<V>> olderValues;
+		for (size_t i = _checkpoint; i < m_journal.size(); ++i)
+			olderValues.emplace(m_journal[i].first, m_journal[i].second);
+		for (auto const& [key, olderValue]: olderValues)
+		{
+			auto it = values.find(key);
+			if (it != values.end() && (!olderValue || *olderValue != it->second))
+				eraseKey(key);
+		}
+		if (--m_openCheckpoints == 0)
+			m_journal.clear();
+	}
+
+private:
+	/// Records the current value of @a _key if there is an open checkpoint.
+	void record(K const& _key)
+	{
+		if (m_openCheckpoints == 0)
+			return;
+		auto it = values.find(_key);
+		m_journal.emplace_back(_key, it == values.end() ? std::nullopt : std::optional<V>(it->second));
+	}
+
+	size_t m_openCheckpoints = 0;
+	/// Modified keys and their values before the modification, in the order of modification.
+	std::vector<std::pair<K, std::optional<V>>> m_journal;
 };
 
 template <class T>
@@ -0,0 +1,104 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Records the time spent in optimiser steps and their effect on the code size.
+ */
+
+#include <libsolutil/OptimiserProfile.h>
+
+#include <exception>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+
+namespace
+{
+thread_local OptimiserProfile* currentProfile = nullptr;
+}
+
+OptimiserProfile::Scope::Scope(OptimiserProfile* _profile):
+	m_previous(currentProfile)
+{
+	currentProfile = _profile;
+}
+
+OptimiserProfile::Scope::~Scope()
+{
+	currentProfile = m_previous;
+}
+
+OptimiserProfile::Recorder::Recorder(
+	char const* _optimiser,
+	string const& _step,
+	function<CodeSize()> _measure
+):
+	m_profile(currentProfile)
+{
+	if (!m_profile)
+		return;
+	m_measure = move(_measure);
+	m_run.optimiser = _optimiser;
+	m_run.step = _step;
+	m_run.before = m_measure();
+	m_uncaughtExceptions = uncaught_exceptions();
+	m_start = chrono::steady_clock::now();
+}
+
+OptimiserProfile::Recorder::~Recorder()
+{
+	if (!m_profile || uncaught_exceptions() > m_uncaughtExceptions)
+		return;
+	m_run.time = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - m_start);
+	m_run.after = m_measure();
+	m_profile->record(move(m_run));
+}
+
+OptimiserProfile* OptimiserProfile::current()
+{
+	return currentProfile;
+}
+
+void OptimiserProfile::record(StepRun _run)
+{
+	lock_guard<mutex> lock(m_mutex);
+	m_stepRuns.emplace_back(move(_run));
+}
+
+vector<OptimiserProfile::StepRun> OptimiserProfile::stepRuns() const
+{
+	lock_guard<mutex> lock(m_mutex);
+	return m_stepRuns;
+}
+
+Json::Value OptimiserProfile::toJson() const
+{
+	Json::Value ret{Json::arrayValue};
+	for (StepRun const& run: stepRuns())
+	{
+		Json::Value entry{Json::objectValue};
+		entry["optimizer"] = run.optimiser;
+		entry["step"] = run.step;
+		entry["time"] = Json::Int64(run.time.count());
+		entry["nodesBefore"] = Json::UInt64(run.before.nodes);
+		entry["nodesAfter"] = Json::UInt64(run.after.nodes);
+		entry["sizeBefore"] = Json::UInt64(run.before.size);
+		entry["sizeAfter"] = Json::UInt64(run.after.size);
+		ret.append(move(entry));
+	}
+	return ret;
+}
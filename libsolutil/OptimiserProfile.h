@@ -0,0 +1,107 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Records the time spent in optimiser steps and their effect on the code size.
+ */
+
+#pragma once
+
+#include <json/json.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace solidity::util
+{
+
+/**
+ * Profile of the optimiser steps run during a compilation, in the order in which they finished.
+ *
+ * Each thread has a current profile that optimisers record their step runs to. There is none
+ * by default, so that nothing is measured. A profile can be made current using a Scope.
+ * Step runs can be recorded concurrently from multiple threads.
+ */
+class OptimiserProfile: boost::noncopyable
+{
+public:
+	/// Size of the code, in the units of the respective optimiser.
+	struct CodeSize
+	{
+		/// Number of AST nodes or assembly items.
+		size_t nodes = 0;
+		/// Code size metric of the Yul optimiser or number of bytes of the assembly.
+		size_t size = 0;
+	};
+
+	struct StepRun
+	{
+		/// "yul" or "evmasm".
+		std::string optimiser;
+		std::string step;
+		std::chrono::microseconds time{};
+		CodeSize before;
+		CodeSize after;
+	};
+
+	/// Makes a profile the current profile of the calling thread for the lifetime of the object.
+	class Scope: boost::noncopyable
+	{
+	public:
+		explicit Scope(OptimiserProfile* _profile);
+		~Scope();
+
+	private:
+		OptimiserProfile* m_previous = nullptr;
+	};
+
+	/// Records a run of a step to the current profile, from construction until destruction.
+	/// Does not measure anything if there is no current profile or if the step throws.
+	class Recorder: boost::noncopyable
+	{
+	public:
+		/// @param _measure returns the size of the code, is called before and after the step.
+		Recorder(char const* _optimiser, std::string const& _step, std::function<CodeSize()> _measure);
+		~Recorder();
+
+	private:
+		OptimiserProfile* m_profile = nullptr;
+		std::function<CodeSize()> m_measure;
+		StepRun m_run;
+		std::chrono::steady_clock::time_point m_start;
+		int m_uncaughtExceptions = 0;
+	};
+
+	/// @returns the current profile of the calling thread, nullptr if there is none.
+	static OptimiserProfile* current();
+
+	void record(StepRun _run);
+	std::vector<StepRun> stepRuns() const;
+
+	/// @returns an array with an object for each step run.
+	Json::Value toJson() const;
+
+private:
+	mutable std::mutex m_mutex;
+	std::vector<StepRun> m_stepRuns;
+};
+
+}
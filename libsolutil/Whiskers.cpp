@@ -25,11 +25,235 @@
 
 #include <libsolutil/Assertions.h>
 
-#include <regex>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 using namespace std;
 using namespace solidity::util;
 
+namespace
+{
+
+/// A template parsed into a sequence of literal text and parameter sections.
+struct Template
+{
+	enum class Kind { Text, Value, List, Condition };
+	struct Section
+	{
+		Kind kind;
+		/// Literal text or name of the parameter.
+		string text;
+		/// Body of a list or of a condition if it is true.
+		unique_ptr<Template const> body;
+		/// Body of a condition if it is false.
+		unique_ptr<Template const> elseBody;
+	};
+
+	/// Text of the template, used in error messages.
+	string source;
+	vector<Section> sections;
+};
+
+bool isParameterCharacter(char _c)
+{
+	return
+		('a' <= _c && _c <= 'z') ||
+		('A' <= _c && _c <= 'Z') ||
+		('0' <= _c && _c <= '9') ||
+		_c == '_' || _c == '$' || _c == '-';
+}
+
+/// @returns the length of the parameter name starting at @a _pos in @a _source.
+size_t parameterLength(string const& _source, size_t _pos)
+{
+	size_t end = _pos;
+	while (end < _source.size() && isParameterCharacter(_source[end]))
+		++end;
+	return end - _pos;
+}
+
+/// Parses @a _source. Tags that are not well-formed, e.g. lists and conditions without
+/// closing tag, are kept as literal text. A list or condition ends at the first closing tag
+/// of the same name and a condition is split at the first else tag of that name before it.
+unique_ptr<Template const> parse(string _source)
+{
+	auto result = make_unique<Template>();
+	string const& source = result->source = move(_source);
+	string text;
+	auto addSection = [&](Template::Kind _kind, string _name, unique_ptr<Template const> _body = {}, unique_ptr<Template const> _elseBody = {})
+	{
+		if (!text.empty())
+			result->sections.push_back({Template::Kind::Text, move(text), {}, {}});
+		text.clear();
+		result->sections.push_back({_kind, move(_name), move(_body), move(_elseBody)});
+	};
+
+	size_t pos = 0;
+	while (pos < source.size())
+	{
+		size_t open = source.find('<', pos);
+		if (open == string::npos)
+		{
+			text.append(source, pos, string::npos);
+			break;
+		}
+		text.append(source, pos, open - pos);
+		pos = open + 1;
+		if (pos == source.size())
+		{
+			text += '<';
+			break;
+		}
+
+		char marker = source[pos];
+		size_t nameStart = (marker == '#' || marker == '?') ? pos + 1 : pos;
+		size_t nameLength = parameterLength(source, nameStart);
+		size_t nameEnd = nameStart + nameLength;
+		if (nameLength == 0 || nameEnd == source.size() || source[nameEnd] != '>')
+		{
+			text += '<';
+			continue;
+		}
+		string name = source.substr(nameStart, nameLength);
+		size_t bodyStart = nameEnd + 1;
+		if (nameStart == pos)
+		{
+			addSection(Template::Kind::Value, move(name));
+			pos = bodyStart;
+			continue;
+		}
+
+		string closingTag = "</" + name + ">";
+		size_t close = source.find(closingTag, bodyStart);
+		if (close == string::npos)
+		{
+			text += '<';
+			continue;
+		}
+		if (marker == '#')
+			addSection(Template::Kind::List, move(name), parse(source.substr(bodyStart, close - bodyStart)));
+		else
+		{
+			string elseTag = "<!" + name + ">";
+			size_t elsePos = source.find(elseTag, bodyStart);
+			if (elsePos < close)
+				addSection(
+					Template::Kind::Condition,
+					move(name),
+					parse(source.substr(bodyStart, elsePos - bodyStart)),
+					parse(source.substr(elsePos + elseTag.size(), close - elsePos - elseTag.size()))
+				);
+			else
+				addSection(
+					Template::Kind::Condition,
+					move(name),
+					parse(source.substr(bodyStart, close - bodyStart)),
+					parse({})
+				);
+		}
+		pos = close + closingTag.size();
+	}
+	if (!text.empty())
+		result->sections.push_back({Template::Kind::Text, move(text), {}, {}});
+	return result;
+}
+
+/// @returns the parsed form of @a _source, parsing it only if it is not in the cache yet.
+shared_ptr<Template const> parsedTemplate(string const& _source)
+{
+	// Code generation renders templates from multiple threads.
+	static mutex cacheMutex;
+	static unordered_map<string, shared_ptr<Template const>> cache;
+	// Most templates are string literals, this only limits the memory used by generated ones.
+	static size_t constexpr maxCacheSize = 4096;
+
+	lock_guard<mutex> lock(cacheMutex);
+	auto it = cache.find(_source);
+	if (it != cache.end())
+		return it->second;
+	if (cache.size() >= maxCacheSize)
+		cache.clear();
+	shared_ptr<Template const> parsed = parse(_source);
+	cache.emplace(_source, parsed);
+	return parsed;
+}
+
+/// Appends @a _template to @a _output, replacing its parameters.
+/// @param _listElement values of the current list element, if inside a list.
+/// @param _listParameters list parameters, null inside a list, since lists cannot be nested.
+void render(
+	Template const& _template,
+	string& _output,
+	Whiskers::StringMap const& _parameters,
+	Whiskers::StringMap const* _listElement,
+	map<string, bool> const& _conditions,
+	Whiskers::StringListMap const* _listParameters
+)
+{
+	for (Template::Section const& section: _template.sections)
+		switch (section.kind)
+		{
+		case Template::Kind::Text:
+			_output += section.text;
+			break;
+		case Template::Kind::Value:
+		{
+			auto value = _parameters.find(section.text);
+			if (value != _parameters.end())
+			{
+				_output += value->second;
+				break;
+			}
+			assertThrow(
+				_listElement && _listElement->count(section.text),
+				WhiskersError,
+				"Value for tag " + section.text + " not provided.\n" +
+				"Template:\n" +
+				_template.source
+			);
+			_output += _listElement->at(section.text);
+			break;
+		}
+		case Template::Kind::List:
+		{
+			assertThrow(
+				_listParameters && _listParameters->count(section.text),
+				WhiskersError, "List parameter " + section.text + " not set."
+			);
+			for (auto const& element: _listParameters->at(section.text))
+			{
+				for (auto const& value: element)
+					assertThrow(
+						!_parameters.count(value.first),
+						WhiskersError,
+						"Parameter collision"
+					);
+				render(*section.body, _output, _parameters, &element, _conditions, nullptr);
+			}
+			break;
+		}
+		case Template::Kind::Condition:
+		{
+			assertThrow(
+				_conditions.count(section.text),
+				WhiskersError, "Condition parameter " + section.text + " not set."
+			);
+			render(
+				_conditions.at(section.text) ? *section.body : *section.elseBody,
+				_output,
+				_parameters,
+				_listElement,
+				_conditions,
+				_listParameters
+			);
+			break;
+		}
+		}
+}
+
+}
+
 Whiskers::Whiskers(string _template):
 	m_template(move(_template))
 {
@@ -67,14 +291,15 @@ Whiskers& Whiskers::operator()(
 
 string Whiskers::render() const
 {
-	return replace(m_template, m_parameters, m_conditions, m_listParameters);
+	string output;
+	::render(*parsedTemplate(m_template), output, m_parameters, nullptr, m_conditions, &m_listParameters);
+	return output;
 }
 
 void Whiskers::checkParameterValid(string const& _parameter) const
 {
-	static regex validParam("^" + paramRegex() + "$");
 	assertThrow(
-		regex_match(_parameter, validParam),
+		!_parameter.empty() && parameterLength(_parameter, 0) == _parameter.size(),
 		WhiskersError,
 		"Parameter" + _parameter + " contains invalid characters."
 	);
@@ -98,98 +323,3 @@ void Whiskers::checkParameterUnknown(string const& _parameter) const
 		_parameter + " already set as list parameter."
 	);
 }
-
-namespace
-{
-template<class ReplaceCallback>
-string regex_replace(
-	string const& _source,
-	regex const& _pattern,
-	ReplaceCallback _replace,
-	regex_constants::match_flag_type _flags = regex_constants::match_default
-)
-{
-	sregex_iterator curMatch(_source.begin(), _source.end(), _pattern, _flags);
-	sregex_iterator matchEnd;
-	string::const_iterator lastMatchedPos(_source.cbegin());
-	string result;
-	while (curMatch != matchEnd)
-	{
-		result.append(curMatch->prefix().first, curMatch->prefix().second);
-		result.append(_replace(*curMatch));
-		lastMatchedPos = (*curMatch)[0].second;
-		++curMatch;
-	}
-	result.append(lastMatchedPos, _source.cend());
-	return result;
-}
-}
-
-string Whiskers::replace(
-	string const& _template,
-	StringMap const& _parameters,
-	map<string, bool> const& _conditions,
-	map<string, vector<StringMap>> const& _listParameters
-)
-{
-	static regex listOrTag("<(" + paramRegex() + ")>|<#(" + paramRegex() + ")>((?:.|\\r|\\n)*?)</\\2>|<\\?(" + paramRegex() + ")>((?:.|\\r|\\n)*?)(<!\\4>((?:.|\\r|\\n)*?))?</\\4>");
-	return regex_replace(_template, listOrTag, [&](match_results<string::const_iterator> _match) -> string
-	{
-		string tagName(_match[1]);
-		string listName(_match[2]);
-		string conditionName(_match[4]);
-		if (!tagName.empty())
-		{
-			assertThrow(
-				_parameters.count(tagName),
-				WhiskersError,
-				"Value for tag " + tagName + " not provided.\n" +
-				"Template:\n" +
-				_template
-			);
-			return _parameters.at(tagName);
-		}
-		else if (!listName.empty())
-		{
-			string templ(_match[3]);
-			assertThrow(
-				_listParameters.count(listName),
-				WhiskersError, "List parameter " + listName + " not set."
-			);
-			string replacement;
-			for (auto const& parameters: _listParameters.at(listName))
-				replacement += replace(templ, joinMaps(_parameters, parameters), _conditions);
-			return replacement;
-		}
-		else
-		{
-			assertThrow(!conditionName.empty(), WhiskersError, "");
-			assertThrow(
-				_conditions.count(conditionName),
-				WhiskersError, "Condition parameter " + conditionName + " not set."
-			);
-			return replace(
-				_conditions.at(conditionName) ? _match[5] : _match[7],
-				_parameters,
-				_conditions,
-				_listParameters
-			);
-		}
-	});
-}
-
-Whiskers::StringMap Whiskers::joinMaps(
-	Whiskers::StringMap const& _a,
-	Whiskers::StringMap const& _b
-)
-{
-	Whiskers::StringMap ret = _a;
-	for (auto const& x: _b)
-		assertThrow(
-			ret.insert(x).second,
-			WhiskersError,
-			"Parameter collision"
-		);
-	return ret;
-}
-
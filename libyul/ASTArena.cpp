@@ -0,0 +1,168 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Memory arena for the nodes of the Yul AST.
+ */
+
+#include <libyul/ASTArena.h>
+
+#include <algorithm>
+#include <atomic>
+
+using namespace std;
+using namespace solidity::yul;
+
+/// A chunk is referenced by the arena while it allocates from it and by every allocation in it,
+/// including the freed ones kept for reuse by the arena.
+struct ASTArena::Chunk
+{
+	explicit Chunk(ASTArena const* _arena): arena(_arena) {}
+
+	atomic<size_t> references{1};
+	/// The arena the chunk belongs to. It is only compared to the current arena and may be dangling.
+	ASTArena const* arena = nullptr;
+};
+
+namespace
+{
+
+thread_local ASTArena* currentArena = nullptr;
+
+/// Precedes every allocation and refers to the chunk it is part of, or is null for heap allocations.
+struct alignas(ASTArena::alignment) Header
+{
+	void* chunk = nullptr;
+	/// Size of the allocation in the chunk, including the header.
+	size_t size = 0;
+};
+
+/// @returns the next entry of the free list, which is stored in the memory of a freed allocation.
+void*& nextFree(void* _entry)
+{
+	return *static_cast<void**>(static_cast<void*>(static_cast<Header*>(_entry) + 1));
+}
+
+/// Size of the first chunk of an arena, including the chunk header. Every further chunk is
+/// twice as large as the previous one up to the maximum size, so that small ASTs stay small.
+size_t constexpr c_minChunkSize = 4 * 1024;
+size_t constexpr c_maxChunkSize = 64 * 1024;
+/// Larger allocations, i.e. long lists, are taken from the heap.
+size_t constexpr c_maxSizeInChunk = c_maxChunkSize / 8;
+
+template <class Chunk>
+size_t constexpr chunkHeaderSize()
+{
+	return (sizeof(Chunk) + ASTArena::alignment - 1) / ASTArena::alignment * ASTArena::alignment;
+}
+
+size_t alignedSize(size_t _size)
+{
+	// Every allocation has room for the pointer to the next entry of the free list.
+	return (max(_size, sizeof(void*)) + ASTArena::alignment - 1) / ASTArena::alignment * ASTArena::alignment;
+}
+
+template <class Chunk>
+void release(Chunk* _chunk) noexcept
+{
+	if (_chunk && _chunk->references.fetch_sub(1, memory_order_acq_rel) == 1)
+	{
+		_chunk->~Chunk();
+		::operator delete(_chunk);
+	}
+}
+
+}
+
+ASTArena::Scope::Scope(ASTArena& _arena):
+	m_previous(currentArena)
+{
+	currentArena = &_arena;
+}
+
+ASTArena::Scope::~Scope()
+{
+	currentArena = m_previous;
+}
+
+ASTArena::~ASTArena()
+{
+	for (void* entry: m_freeLists)
+		while (entry)
+		{
+			Header* header = static_cast<Header*>(entry);
+			entry = nextFree(header);
+			release(static_cast<Chunk*>(header->chunk));
+		}
+	release(m_chunk);
+}
+
+void* ASTArena::allocate(size_t _size)
+{
+	if (currentArena && _size <= c_maxSizeInChunk)
+		return currentArena->allocateInChunk(_size);
+	Header* header = new (::operator new(sizeof(Header) + _size)) Header{};
+	return header + 1;
+}
+
+void ASTArena::deallocate(void* _memory) noexcept
+{
+	if (!_memory)
+		return;
+	Header* header = static_cast<Header*>(_memory) - 1;
+	Chunk* chunk = static_cast<Chunk*>(header->chunk);
+	if (!chunk)
+		::operator delete(header);
+	else if (currentArena && chunk->arena == currentArena)
+	{
+		// Keep the memory for reuse, which mainly happens while the optimiser replaces nodes.
+		vector<void*>& freeLists = currentArena->m_freeLists;
+		if (freeLists.empty())
+			freeLists.resize((sizeof(Header) + alignedSize(c_maxSizeInChunk)) / alignment + 1);
+		void*& freeList = freeLists[header->size / alignment];
+		nextFree(header) = freeList;
+		freeList = header;
+	}
+	else
+		release(chunk);
+}
+
+void* ASTArena::allocateInChunk(size_t _size)
+{
+	size_t const size = sizeof(Header) + alignedSize(_size);
+	if (!m_freeLists.empty() && m_freeLists[size / alignment])
+	{
+		void*& freeList = m_freeLists[size / alignment];
+		Header* header = static_cast<Header*>(freeList);
+		freeList = nextFree(header);
+		return header + 1;
+	}
+	if (size_t(m_end - m_next) < size)
+	{
+		size_t const chunkSize = max(c_minChunkSize << min<size_t>(m_chunkCount, 4), chunkHeaderSize<Chunk>() + size);
+		char* memory = static_cast<char*>(::operator new(chunkSize));
+		Chunk* chunk = new (memory) Chunk{this};
+		release(m_chunk);
+		m_chunk = chunk;
+		m_next = memory + chunkHeaderSize<Chunk>();
+		m_end = memory + chunkSize;
+		++m_chunkCount;
+	}
+	Header* header = new (m_next) Header{m_chunk, size};
+	m_chunk->references.fetch_add(1, memory_order_relaxed);
+	m_next += size;
+	return header + 1;
+}
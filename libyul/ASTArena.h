@@ -0,0 +1,161 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Memory arena for the nodes of the Yul AST.
+ */
+
+#pragma once
+
+#include <boost/noncopyable.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace solidity::yul
+{
+
+/**
+ * Memory arena for the nodes of Yul ASTs.
+ *
+ * The child nodes and lists of the AST allocate their memory from the current arena
+ * of the calling thread, or from the heap if there is none. Similar to the repository
+ * of YulStrings, an arena is made current using a Scope.
+ *
+ * An arena hands out consecutive parts of large chunks of memory. Freeing a node while
+ * its arena is current keeps the memory for reuse by the arena, otherwise the memory
+ * of a whole AST is returned chunk by chunk: A chunk is returned once the arena is gone
+ * or has moved on to the next chunk and all nodes allocated in it are freed. Because of
+ * that, nodes may outlive the arena and may be moved between ASTs of different arenas.
+ *
+ * An arena must only be current in one thread at a time, but nodes can be freed in any thread.
+ */
+class ASTArena: boost::noncopyable
+{
+public:
+	/// Makes an arena the current arena of the calling thread for the lifetime of the object.
+	class Scope: boost::noncopyable
+	{
+	public:
+		explicit Scope(ASTArena& _arena);
+		~Scope();
+
+	private:
+		ASTArena* m_previous = nullptr;
+	};
+
+	/// Alignment of all memory returned by allocate.
+	static constexpr size_t alignment = alignof(std::max_align_t);
+
+	ASTArena() = default;
+	~ASTArena();
+
+	/// @returns memory for @a _size bytes from the current arena of the calling thread
+	/// or from the heap if there is no current arena.
+	static void* allocate(size_t _size);
+	/// Frees memory returned by allocate.
+	static void deallocate(void* _memory) noexcept;
+
+	/// @returns the number of chunks allocated by this arena so far.
+	size_t chunkCount() const { return m_chunkCount; }
+
+private:
+	struct Chunk;
+
+	void* allocateInChunk(size_t _size);
+
+	/// Freed allocations of the arena by size, which can be reused. Created on the first free.
+	std::vector<void*> m_freeLists;
+	Chunk* m_chunk = nullptr;
+	char* m_next = nullptr;
+	char* m_end = nullptr;
+	size_t m_chunkCount = 0;
+};
+
+/// Allocator for the lists of AST nodes, which uses the current arena.
+template <class T>
+struct ASTAllocator
+{
+	using value_type = T;
+	using is_always_equal = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+
+	ASTAllocator() = default;
+	template <class U> ASTAllocator(ASTAllocator<U> const&) noexcept {}
+
+	T* allocate(size_t _count)
+	{
+		static_assert(alignof(T) <= ASTArena::alignment, "Over-aligned AST node.");
+		if (_count > std::numeric_limits<size_t>::max() / sizeof(T))
+			throw std::bad_array_new_length();
+		return static_cast<T*>(ASTArena::allocate(_count * sizeof(T)));
+	}
+	void deallocate(T* _memory, size_t) noexcept { ASTArena::deallocate(_memory); }
+
+	template <class U> bool operator==(ASTAllocator<U> const&) const noexcept { return true; }
+	template <class U> bool operator!=(ASTAllocator<U> const&) const noexcept { return false; }
+};
+
+/// Deleter for AST nodes created by makeASTNode.
+template <class T>
+struct ASTDeleter
+{
+	ASTDeleter() = default;
+	template <class U, class = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+	ASTDeleter(ASTDeleter<U> const&) noexcept {}
+
+	void operator()(T* _node) const noexcept
+	{
+		_node->~T();
+		ASTArena::deallocate(_node);
+	}
+};
+
+template <class T> using ASTVector = std::vector<T, ASTAllocator<T>>;
+template <class T> using ASTNodePtr = std::unique_ptr<T, ASTDeleter<T>>;
+
+/// Creates a list of nodes in the current arena.
+template <class T, class... Args>
+ASTVector<T> makeASTVector(Args&&... _args)
+{
+	ASTVector<T> result;
+	result.reserve(sizeof...(_args));
+	(result.emplace_back(std::forward<Args>(_args)), ...);
+	return result;
+}
+
+/// Creates a node in the current arena.
+template <class T, class... Args>
+ASTNodePtr<T> makeASTNode(Args&&... _args)
+{
+	static_assert(alignof(T) <= ASTArena::alignment, "Over-aligned AST node.");
+	void* memory = ASTArena::allocate(sizeof(T));
+	try
+	{
+		return ASTNodePtr<T>(new (memory) T(std::forward<Args>(_args)...));
+	}
+	catch (...)
+	{
+		ASTArena::deallocate(memory);
+		throw;
+	}
+}
+
+}
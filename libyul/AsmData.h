@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <libyul/ASTArena.h>
 #include <libyul/AsmDataForward.h>
 #include <libyul/YulString.h>
 
@@ -35,7 +36,7 @@ namespace solidity::yul
 using Type = YulString;
 
 struct TypedName { langutil::SourceLocation location; YulString name; Type type; };
-using TypedNameList = std::vector<TypedName>;
+using TypedNameList = ASTVector<TypedName>;
 
 /// Literal number or string (up to 32 bytes)
 enum class LiteralKind { Number, Boolean, String };
@@ -48,23 +49,23 @@ struct Identifier { langutil::SourceLocation location; YulString name; };
 /// Multiple assignment ("x, y := f()"), where the left hand side variables each occupy
 /// a single stack slot and expects a single expression on the right hand returning
 /// the same amount of items as the number of variables.
-struct Assignment { langutil::SourceLocation location; std::vector<Identifier> variableNames; std::unique_ptr<Expression> value; };
-struct FunctionCall { langutil::SourceLocation location; Identifier functionName; std::vector<Expression> arguments; };
+struct Assignment { langutil::SourceLocation location; ASTVector<Identifier> variableNames; ASTNodePtr<Expression> value; };
+struct FunctionCall { langutil::SourceLocation location; Identifier functionName; ASTVector<Expression> arguments; };
 /// Statement that contains only a single expression
 struct ExpressionStatement { langutil::SourceLocation location; Expression expression; };
 /// Block-scope variable declaration ("let x:u256 := mload(20:u256)"), non-hoisted
-struct VariableDeclaration { langutil::SourceLocation location; TypedNameList variables; std::unique_ptr<Expression> value; };
+struct VariableDeclaration { langutil::SourceLocation location; TypedNameList variables; ASTNodePtr<Expression> value; };
 /// Block that creates a scope (frees declared stack variables)
-struct Block { langutil::SourceLocation location; std::vector<Statement> statements; };
+struct Block { langutil::SourceLocation location; ASTVector<Statement> statements; };
 /// Function definition ("function f(a, b) -> (d, e) { ... }")
 struct FunctionDefinition { langutil::SourceLocation location; YulString name; TypedNameList parameters; TypedNameList returnVariables; Block body; };
 /// Conditional execution without "else" part.
-struct If { langutil::SourceLocation location; std::unique_ptr<Expression> condition; Block body; };
+struct If { langutil::SourceLocation location; ASTNodePtr<Expression> condition; Block body; };
 /// Switch case or default case
-struct Case { langutil::SourceLocation location; std::unique_ptr<Literal> value; Block body; };
+struct Case { langutil::SourceLocation location; ASTNodePtr<Literal> value; Block body; };
 /// Switch statement
-struct Switch { langutil::SourceLocation location; std::unique_ptr<Expression> expression; std::vector<Case> cases; };
-struct ForLoop { langutil::SourceLocation location; Block pre; std::unique_ptr<Expression> condition; Block post; Block body; };
+struct Switch { langutil::SourceLocation location; ASTNodePtr<Expression> expression; ASTVector<Case> cases; };
+struct ForLoop { langutil::SourceLocation location; Block pre; ASTNodePtr<Expression> condition; Block post; Block body; };
 /// Break statement (valid within for loop)
 struct Break { langutil::SourceLocation location; };
 /// Continue statement (valid within for loop)
@@ -22,6 +22,8 @@
 
 #pragma once
 
+#include <libyul/ASTArena.h>
+
 #include <variant>
 
 namespace solidity::yul
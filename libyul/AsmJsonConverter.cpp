@@ -191,7 +191,7 @@ Json::Value AsmJsonConverter::createAstNode(langutil::SourceLocation const& _loc
 }
 
 template <class T>
-Json::Value AsmJsonConverter::vectorOfVariantsToJson(vector<T> const& _vec) const
+Json::Value AsmJsonConverter::vectorOfVariantsToJson(ASTVector<T> const& _vec) const
 {
 	Json::Value ret{Json::arrayValue};
 	for (auto const& var: _vec)
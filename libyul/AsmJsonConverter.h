@@ -60,7 +60,7 @@ public:
 private:
 	Json::Value createAstNode(langutil::SourceLocation const& _location, std::string _nodeType) const;
 	template <class T>
-	Json::Value vectorOfVariantsToJson(std::vector<T> const& vec) const;
+	Json::Value vectorOfVariantsToJson(ASTVector<T> const& vec) const;
 
 	std::string const m_sourceIndex;
 };
@@ -63,9 +63,9 @@ unique_ptr<Block> Parser::parse(std::shared_ptr<Scanner> const& _scanner, bool _
 std::map<string, evmasm::Instruction> const& Parser::instructions()
 {
 	// Allowed instructions, lowercase names.
-	static map<string, evmasm::Instruction> s_instructions;
-	if (s_instructions.empty())
+	static map<string, evmasm::Instruction> const s_instructions = []()
 	{
+		map<string, evmasm::Instruction> instructions;
 		for (auto const& instruction: evmasm::c_instructions)
 		{
 			if (
@@ -75,9 +75,10 @@ std::map<string, evmasm::Instruction> const& Parser::instructions()
 				continue;
 			string name = instruction.first;
 			transform(name.begin(), name.end(), name.begin(), [](unsigned char _c) { return tolower(_c); });
-			s_instructions[name] = instruction.second;
+			instructions[name] = instruction.second;
 		}
-	}
+		return instructions;
+	}();
 	return s_instructions;
 }
 
@@ -108,7 +109,7 @@ Statement Parser::parseStatement()
 	{
 		If _if = createWithLocation<If>();
 		advance();
-		_if.condition = make_unique<Expression>(parseExpression());
+		_if.condition = makeASTNode<Expression>(parseExpression());
 		_if.body = parseBlock();
 		return Statement{move(_if)};
 	}
@@ -116,7 +117,7 @@ Statement Parser::parseStatement()
 	{
 		Switch _switch = createWithLocation<Switch>();
 		advance();
-		_switch.expression = make_unique<Expression>(parseExpression());
+		_switch.expression = makeASTNode<Expression>(parseExpression());
 		while (currentToken() == Token::Case)
 			_switch.cases.emplace_back(parseCase());
 		if (currentToken() == Token::Default)
@@ -175,7 +176,7 @@ Statement Parser::parseStatement()
 	case Token::Comma:
 	case Token::AssemblyAssign:
 	{
-		std::vector<Identifier> variableNames;
+		ASTVector<Identifier> variableNames;
 
 		while (true)
 		{
@@ -212,7 +213,7 @@ Statement Parser::parseStatement()
 
 		expectToken(Token::AssemblyAssign);
 
-		assignment.value = make_unique<Expression>(parseExpression());
+		assignment.value = makeASTNode<Expression>(parseExpression());
 		assignment.location.end = locationOf(*assignment.value).end;
 
 		return Statement{std::move(assignment)};
@@ -251,7 +252,7 @@ Case Parser::parseCase()
 		ElementaryOperation literal = parseElementaryOperation();
 		if (!holds_alternative<Literal>(literal))
 			fatalParserError("Literal expected.");
-		_case.value = make_unique<Literal>(std::get<Literal>(std::move(literal)));
+		_case.value = makeASTNode<Literal>(std::get<Literal>(std::move(literal)));
 	}
 	else
 		yulAssert(false, "Case or default case expected.");
@@ -271,7 +272,7 @@ ForLoop Parser::parseForLoop()
 	m_currentForLoopComponent = ForLoopComponent::ForLoopPre;
 	forLoop.pre = parseBlock();
 	m_currentForLoopComponent = ForLoopComponent::None;
-	forLoop.condition = make_unique<Expression>(parseExpression());
+	forLoop.condition = makeASTNode<Expression>(parseExpression());
 	m_currentForLoopComponent = ForLoopComponent::ForLoopPost;
 	forLoop.post = parseBlock();
 	m_currentForLoopComponent = ForLoopComponent::ForLoopBody;
@@ -301,15 +302,16 @@ Expression Parser::parseExpression()
 
 std::map<evmasm::Instruction, string> const& Parser::instructionNames()
 {
-	static map<evmasm::Instruction, string> s_instructionNames;
-	if (s_instructionNames.empty())
+	static map<evmasm::Instruction, string> const s_instructionNames = []()
 	{
+		map<evmasm::Instruction, string> instructionNames;
 		for (auto const& instr: instructions())
-			s_instructionNames[instr.second] = instr.first;
+			instructionNames[instr.second] = instr.first;
 		// set the ambiguous instructions to a clear default
-		s_instructionNames[evmasm::Instruction::SELFDESTRUCT] = "selfdestruct";
-		s_instructionNames[evmasm::Instruction::KECCAK256] = "keccak256";
-	}
+		instructionNames[evmasm::Instruction::SELFDESTRUCT] = "selfdestruct";
+		instructionNames[evmasm::Instruction::KECCAK256] = "keccak256";
+		return instructionNames;
+	}();
 	return s_instructionNames;
 }
 
@@ -402,7 +404,7 @@ VariableDeclaration Parser::parseVariableDeclaration()
 	if (currentToken() == Token::AssemblyAssign)
 	{
 		expectToken(Token::AssemblyAssign);
-		varDecl.value = make_unique<Expression>(parseExpression());
+		varDecl.value = makeASTNode<Expression>(parseExpression());
 		varDecl.location.end = locationOf(*varDecl.value).end;
 	}
 	else
@@ -77,10 +77,15 @@ Scanner const& AssemblyStack::scanner() const
 }
 
 bool AssemblyStack::parseAndAnalyze(std::string const& _sourceName, std::string const& _source)
+{
+	return parseAndAnalyze(_sourceName, SourceBuffer(_source));
+}
+
+bool AssemblyStack::parseAndAnalyze(std::string const& _sourceName, SourceBuffer _source)
 {
 	m_errors.clear();
 	m_analysisSuccessful = false;
-	m_scanner = make_shared<Scanner>(CharStream(_source, _sourceName));
+	m_scanner = make_shared<Scanner>(CharStream(std::move(_source), _sourceName));
 	m_parserResult = ObjectParser(m_errorReporter, languageToDialect(m_language, m_evmVersion)).parse(m_scanner, false);
 	if (!m_errorReporter.errors().empty())
 		return false;
@@ -183,7 +188,13 @@ void AssemblyStack::optimize(Object& _object, bool _isCreation)
 		dialect,
 		meter.get(),
 		_object,
-		m_optimiserSettings.optimizeStackAllocation
+		m_optimiserSettings.optimizeStackAllocation,
+		{},
+		m_optimiserSettings.yulFunctionParallel,
+		m_parallelism,
+		m_optimiserSettings.yulOptimiserSteps,
+		m_optimiserSettings.yulOptimiserMaxRounds,
+		chrono::milliseconds(m_optimiserSettings.yulOptimiserTimeBudget)
 	);
 }
 
@@ -77,6 +77,12 @@ public:
 	/// Runs parsing and analysis steps, returns false if input cannot be assembled.
 	/// Multiple calls overwrite the previous state.
 	bool parseAndAnalyze(std::string const& _sourceName, std::string const& _source);
+	/// Like parseAndAnalyze above, but scans @a _source without copying it.
+	bool parseAndAnalyze(std::string const& _sourceName, langutil::SourceBuffer _source);
+
+	/// Sets the number of threads used by the optimizer suite if the settings enable
+	/// its function-parallel mode. The output does not depend on this setting.
+	void setParallelism(unsigned _threads) { m_parallelism = _threads; }
 
 	/// Run the optimizer suite. Can only be used with Yul or strict assembly.
 	/// If the settings (see constructor) disabled the optimizer, nothing is done here.
@@ -108,6 +114,7 @@ private:
 	Language m_language = Language::Assembly;
 	langutil::EVMVersion m_evmVersion;
 	solidity::frontend::OptimiserSettings m_optimiserSettings;
+	unsigned m_parallelism = 1;
 
 	std::shared_ptr<langutil::Scanner> m_scanner;
 
@@ -22,12 +22,17 @@
 
 #include <libyul/AsmAnalysis.h>
 #include <libyul/AsmAnalysisInfo.h>
+#include <libyul/AsmData.h>
+#include <libyul/optimiser/BlockHasher.h>
+#include <libyul/optimiser/NameCollector.h>
 
 #include <libyul/backends/evm/EVMCodeTransform.h>
 #include <libyul/backends/evm/NoOutputAssembly.h>
 
 #include <liblangutil/EVMVersion.h>
 
+#include <libsolutil/Common.h>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
@@ -77,3 +82,87 @@ map<YulString, int> CompilabilityChecker::run(
 	else
 		return {};
 }
+
+map<YulString, int> const& IncrementalCompilabilityChecker::run(Object& _object)
+{
+	yulAssert(_object.code, "");
+	Block& code = *_object.code;
+	bool grouped = !code.statements.empty() && holds_alternative<Block>(code.statements.front());
+	for (size_t i = 1; grouped && i < code.statements.size(); ++i)
+		grouped = holds_alternative<FunctionDefinition>(code.statements[i]);
+	if (!grouped)
+	{
+		m_cache.clear();
+		m_result = CompilabilityChecker::run(m_dialect, _object, m_optimizeStackAllocation);
+		return m_result;
+	}
+
+	map<YulString, FunctionDefinition const*> functions;
+	for (size_t i = 1; i < code.statements.size(); ++i)
+	{
+		FunctionDefinition const& function = std::get<FunctionDefinition>(code.statements[i]);
+		functions[function.name] = &function;
+	}
+
+	m_result.clear();
+	// A stack error in the main block aborts the code transform before any function is checked.
+	if (int surplus = checkPart(_object, code.statements.front(), {}, functions))
+		m_result[{}] = surplus;
+	else
+		for (size_t i = 1; i < code.statements.size(); ++i)
+		{
+			YulString name = std::get<FunctionDefinition>(code.statements[i]).name;
+			if (int surplus = checkPart(_object, code.statements[i], name, functions))
+				m_result[name] = surplus;
+		}
+	return m_result;
+}
+
+int IncrementalCompilabilityChecker::stackSurplus(YulString _functionName) const
+{
+	auto it = m_result.find(_functionName);
+	return it == m_result.end() ? 0 : it->second;
+}
+
+int IncrementalCompilabilityChecker::checkPart(
+	Object const& _object,
+	Statement& _statement,
+	YulString _name,
+	map<YulString, FunctionDefinition const*> const& _functions
+)
+{
+	bool isMainBlock = holds_alternative<Block>(_statement);
+	uint64_t hash = isMainBlock ?
+		ASTHasher::run(std::get<Block>(_statement)) :
+		ASTHasher::run(std::get<FunctionDefinition>(_statement));
+
+	// The stack layout of a function call only depends on the signature of the called function.
+	shared_ptr<Block> code = make_shared<Block>();
+	code->statements.emplace_back(Block{});
+	for (auto const& reference: isMainBlock ?
+		ReferencesCounter::countReferences(std::get<Block>(_statement)) :
+		ReferencesCounter::countReferences(std::get<FunctionDefinition>(_statement))
+	)
+		if (reference.first != _name && _functions.count(reference.first))
+		{
+			FunctionDefinition const& callee = *_functions.at(reference.first);
+			FunctionDefinition declaration{{}, callee.name, callee.parameters, callee.returnVariables, {}};
+			hash = (hash * BlockHasher::fnvPrime) ^ ASTHasher::run(declaration);
+			code->statements.emplace_back(std::move(declaration));
+		}
+
+	if (m_cache.count(_name) && m_cache.at(_name).first == hash)
+		return m_cache.at(_name).second;
+
+	// Move the part into the code to be checked instead of copying it and move it back afterwards.
+	swap(code->statements.front(), _statement);
+	ScopeGuard restore([&]() { swap(code->statements.front(), _statement); });
+	Object object = _object;
+	object.code = code;
+	object.analysisInfo = nullptr;
+	map<YulString, int> surplus = CompilabilityChecker::run(m_dialect, object, m_optimizeStackAllocation);
+
+	int result = surplus.count(_name) ? surplus.at(_name) : 0;
+	m_cache[_name] = {hash, result};
+	return result;
+}
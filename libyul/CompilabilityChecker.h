@@ -50,4 +50,50 @@ public:
 	);
 };
 
+/**
+ * Variant of the CompilabilityChecker that checks the main block and each function
+ * separately and keeps the results across modifications of the code. When run again,
+ * only the parts that changed (or whose called functions changed their signature)
+ * are checked again. The results are the same as those of the CompilabilityChecker.
+ *
+ * Also answers how many stack slots are missing in a given function ("stack pressure"),
+ * which optimiser steps can use to decide whether to free stack slots.
+ *
+ * Prerequisite: FunctionGrouper. Falls back to checking the whole code at once
+ * if the code is not grouped.
+ */
+class IncrementalCompilabilityChecker
+{
+public:
+	IncrementalCompilabilityChecker(Dialect const& _dialect, bool _optimizeStackAllocation):
+		m_dialect(_dialect), m_optimizeStackAllocation(_optimizeStackAllocation)
+	{}
+
+	/// @returns the same as CompilabilityChecker::run for @a _object.
+	/// The code is modified while the parts are checked and restored afterwards.
+	std::map<YulString, int> const& run(Object& _object);
+
+	/// @returns the number of stack slots that were missing in the function @a _functionName
+	/// (or in the main block for the empty name) during the last call to run, zero if it
+	/// was compilable.
+	int stackSurplus(YulString _functionName) const;
+
+private:
+	/// @returns the stack surplus of @a _statement (the main block or a function definition),
+	/// checked as part of code that only contains declarations of the functions it calls.
+	int checkPart(
+		Object const& _object,
+		Statement& _statement,
+		YulString _name,
+		std::map<YulString, FunctionDefinition const*> const& _functions
+	);
+
+	Dialect const& m_dialect;
+	bool m_optimizeStackAllocation = false;
+	/// Hash of each part (including the signatures of the functions it calls) and
+	/// its stack surplus, by function name, using the empty name for the main block.
+	std::map<YulString, std::pair<uint64_t, int>> m_cache;
+	std::map<YulString, int> m_result;
+};
+
 }
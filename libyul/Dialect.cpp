@@ -21,6 +21,8 @@
 #include <libyul/Dialect.h>
 #include <libyul/AsmData.h>
 
+#include <mutex>
+
 using namespace solidity::yul;
 using namespace std;
 using namespace solidity::langutil;
@@ -42,9 +44,16 @@ bool Dialect::validTypeForLiteral(LiteralKind _kind, YulString, YulString _type)
 
 Dialect const& Dialect::yulDeprecated()
 {
-	static unique_ptr<Dialect> dialect;
-	static YulStringRepository::ResetCallback callback{[&] { dialect.reset(); }};
+	static map<YulStringRepository const*, unique_ptr<Dialect>> dialects;
+	static mutex dialectsMutex;
+	static YulStringRepository::ResetCallback callback{[&](YulStringRepository const& _repository)
+	{
+		lock_guard<mutex> lock(dialectsMutex);
+		dialects.erase(&_repository);
+	}};
 
+	lock_guard<mutex> lock(dialectsMutex);
+	unique_ptr<Dialect>& dialect = dialects[&YulStringRepository::instance()];
 	if (!dialect)
 	{
 		// TODO will probably change, especially the list of types.
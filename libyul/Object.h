@@ -71,6 +71,8 @@ public:
 	std::set<YulString> dataNames() const;
 
 	std::shared_ptr<Block> code;
+	/// Arena used for the nodes of the code while it is parsed and optimised.
+	std::shared_ptr<ASTArena> arena;
 	std::vector<std::shared_ptr<ObjectNode>> subObjects;
 	std::map<YulString, size_t> subIndexByName;
 	std::shared_ptr<yul::AsmAnalysisInfo> analysisInfo;
@@ -42,6 +42,8 @@ shared_ptr<Object> ObjectParser::parse(shared_ptr<Scanner> const& _scanner, bool
 		{
 			// Special case: Code-only form.
 			object = make_shared<Object>();
+			object->arena = make_shared<ASTArena>();
+			ASTArena::Scope arenaScope(*object->arena);
 			object->name = "object"_yulstring;
 			object->code = parseBlock();
 			if (!object->code)
@@ -74,7 +76,11 @@ shared_ptr<Object> ObjectParser::parseObject(Object* _containingObject)
 
 	expectToken(Token::LBrace);
 
-	ret->code = parseCode();
+	ret->arena = make_shared<ASTArena>();
+	{
+		ASTArena::Scope arenaScope(*ret->arena);
+		ret->code = parseCode();
+	}
 
 	while (currentToken() != Token::RBrace)
 	{
@@ -0,0 +1,119 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * String abstraction that avoids copies.
+ */
+
+#include <libyul/YulString.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+
+namespace
+{
+
+/// The repository that is used by threads without a current repository.
+/// It is never destroyed, so that YulStrings and dialects can outlive static destruction.
+YulStringRepository& defaultRepository()
+{
+	static YulStringRepository* repository = new YulStringRepository();
+	return *repository;
+}
+
+thread_local YulStringRepository* currentRepository = nullptr;
+
+mutex& resetCallbacksMutex()
+{
+	static mutex callbacksMutex;
+	return callbacksMutex;
+}
+
+vector<function<void(YulStringRepository const&)>>& resetCallbacks()
+{
+	static vector<function<void(YulStringRepository const&)>> callbacks;
+	return callbacks;
+}
+
+}
+
+string const YulStringRepository::s_emptyString;
+
+YulStringRepository::Scope::Scope(YulStringRepository& _repository):
+	m_previous(currentRepository)
+{
+	currentRepository = &_repository;
+}
+
+YulStringRepository::Scope::~Scope()
+{
+	currentRepository = m_previous;
+}
+
+YulStringRepository::~YulStringRepository()
+{
+	notifyReset();
+}
+
+YulStringRepository& YulStringRepository::instance()
+{
+	if (currentRepository)
+		return *currentRepository;
+	return defaultRepository();
+}
+
+YulStringRepository::Handle YulStringRepository::stringToHandle(string const& _string)
+{
+	if (_string.empty())
+		return Handle{emptyString(), emptyHash()};
+	uint64_t h = hash(_string);
+	Shard& shard = m_shards[h % c_shardCount];
+	lock_guard<mutex> lock(shard.mutex);
+	auto range = shard.strings.equal_range(h);
+	for (auto it = range.first; it != range.second; ++it)
+		if (it->second == _string)
+			return Handle{&it->second, h};
+	auto it = shard.strings.emplace_hint(range.second, h, _string);
+	return Handle{&it->second, h};
+}
+
+void YulStringRepository::clear()
+{
+	notifyReset();
+	for (Shard& shard: m_shards)
+	{
+		lock_guard<mutex> lock(shard.mutex);
+		shard.strings.clear();
+	}
+}
+
+YulStringRepository::ResetCallback::ResetCallback(function<void(YulStringRepository const&)> _fun)
+{
+	lock_guard<mutex> lock(resetCallbacksMutex());
+	resetCallbacks().emplace_back(move(_fun));
+}
+
+void YulStringRepository::notifyReset() const
+{
+	vector<function<void(YulStringRepository const&)>> callbacks;
+	{
+		lock_guard<mutex> lock(resetCallbacksMutex());
+		callbacks = resetCallbacks();
+	}
+	for (auto const& callback: callbacks)
+		callback(*this);
+}
@@ -22,8 +22,11 @@
 
 #include <boost/noncopyable.hpp>
 
+#include <array>
+#include <cstdint>
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <functional>
@@ -33,39 +36,43 @@ namespace solidity::yul
 
 /// Repository for YulStrings.
 /// Owns the string data for all YulStrings, which can be referenced by a Handle.
-/// A Handle consists of an ID (that depends on the insertion order of YulStrings and is potentially
-/// non-deterministic) and a deterministic string hash.
-class YulStringRepository
+/// A Handle consists of a pointer to the string data (that depends on the order of
+/// allocation and is potentially non-deterministic) and a deterministic string hash.
+///
+/// Each thread has a current repository that is used to create new YulStrings. By default,
+/// this is a process-wide repository, but a compilation can own a repository and make it
+/// current using a Scope. Its strings are freed together with the repository.
+/// YulStrings of different repositories must not be mixed.
+/// Strings can be added concurrently from multiple threads.
+class YulStringRepository: boost::noncopyable
 {
 public:
 	struct Handle
 	{
-		size_t id;
+		std::string const* string;
 		std::uint64_t hash;
 	};
 
-	static YulStringRepository& instance()
+	/// Makes a repository the current repository of the calling thread
+	/// for the lifetime of the object.
+	class Scope: boost::noncopyable
 	{
-		static YulStringRepository inst;
-		return inst;
-	}
+	public:
+		explicit Scope(YulStringRepository& _repository);
+		~Scope();
 
-	Handle stringToHandle(std::string const& _string)
-	{
-		if (_string.empty())
-			return { 0, emptyHash() };
-		std::uint64_t h = hash(_string);
-		auto range = m_hashToID.equal_range(h);
-		for (auto it = range.first; it != range.second; ++it)
-			if (*m_strings[it->second] == _string)
-				return Handle{it->second, h};
-		m_strings.emplace_back(std::make_shared<std::string>(_string));
-		size_t id = m_strings.size() - 1;
-		m_hashToID.emplace_hint(range.second, std::make_pair(h, id));
-
-		return Handle{id, h};
-	}
-	std::string const& idToString(size_t _id) const	{ return *m_strings.at(_id); }
+	private:
+		YulStringRepository* m_previous = nullptr;
+	};
+
+	YulStringRepository() = default;
+	/// Notifies the reset callbacks. There cannot be any dangling YulString references.
+	~YulStringRepository();
+
+	/// @returns the current repository of the calling thread.
+	static YulStringRepository& instance();
+
+	Handle stringToHandle(std::string const& _string);
 
 	static std::uint64_t hash(std::string const& v)
 	{
@@ -80,45 +87,47 @@ public:
 		return hash;
 	}
 	static constexpr std::uint64_t emptyHash() { return 14695981039346656037u; }
-	/// Clear the repository.
+	/// The empty string is shared by all repositories.
+	static std::string const* emptyString() { return &s_emptyString; }
+
+	/// Clear the current repository.
 	/// Use with care - there cannot be any dangling YulString references.
 	/// If references need to be cleared manually, register the callback via
 	/// resetCallback.
-	static void reset()
-	{
-		for (auto const& cb: resetCallbacks())
-			cb();
-		instance() = YulStringRepository{};
-	}
+	static void reset() { instance().clear(); }
+	/// Clear this repository. The same restrictions as for reset() apply.
+	void clear();
+
 	/// Struct that registers a reset callback as a side-effect of its construction.
 	/// Useful as static local variable to register a reset callback once.
+	/// The callback is invoked with the repository that is cleared or destroyed.
 	struct ResetCallback
 	{
-		ResetCallback(std::function<void()> _fun)
-		{
-			YulStringRepository::resetCallbacks().emplace_back(std::move(_fun));
-		}
+		ResetCallback(std::function<void(YulStringRepository const&)> _fun);
 	};
 
 private:
-	YulStringRepository() = default;
-	YulStringRepository(YulStringRepository const&) = delete;
-	YulStringRepository(YulStringRepository&&) = default;
-	YulStringRepository& operator=(YulStringRepository const& _rhs) = delete;
-	YulStringRepository& operator=(YulStringRepository&& _rhs) = default;
+	/// Number of independently locked parts of the repository.
+	static constexpr size_t c_shardCount = 16;
 
-	static std::vector<std::function<void()>>& resetCallbacks()
+	struct Shard
 	{
-		static std::vector<std::function<void()>> callbacks;
-		return callbacks;
-	}
+		std::mutex mutex;
+		/// Strings by hash. The elements are not moved when the map is rehashed,
+		/// so pointers to them stay valid until the repository is cleared.
+		std::unordered_multimap<std::uint64_t, std::string> strings;
+	};
+
+	/// Calls all reset callbacks for this repository.
+	void notifyReset() const;
+
+	static std::string const s_emptyString;
 
-	std::vector<std::shared_ptr<std::string>> m_strings = {std::make_shared<std::string>()};
-	std::unordered_multimap<std::uint64_t, size_t> m_hashToID = {{emptyHash(), 0}};
+	std::array<Shard, c_shardCount> m_shards;
 };
 
 /// Wrapper around handles into the YulString repository.
-/// Equality of two YulStrings is determined by comparing their ID.
+/// Equality of two YulStrings is determined by comparing the addresses of their string data.
 /// The <-operator depends on the string hash and is not consistent
 /// with string comparisons (however, it is still deterministic).
 class YulString
@@ -133,32 +142,29 @@ public:
 
 	/// This is not consistent with the string <-operator!
 	/// First compares the string hashes. If they are equal
-	/// it checks for identical IDs (only identical strings have
-	/// identical IDs and identical strings do not compare as "less").
+	/// it checks for identical string data (identical strings share
+	/// their data and identical strings do not compare as "less").
 	/// If the hashes are identical and the strings are distinct, it
 	/// falls back to string comparison.
 	bool operator<(YulString const& _other) const
 	{
 		if (m_handle.hash < _other.m_handle.hash) return true;
 		if (_other.m_handle.hash < m_handle.hash) return false;
-		if (m_handle.id == _other.m_handle.id) return false;
+		if (m_handle.string == _other.m_handle.string) return false;
 		return str() < _other.str();
 	}
-	/// Equality is determined based on the string ID.
-	bool operator==(YulString const& _other) const { return m_handle.id == _other.m_handle.id; }
-	bool operator!=(YulString const& _other) const { return m_handle.id != _other.m_handle.id; }
+	/// Equality is determined based on the address of the string data.
+	bool operator==(YulString const& _other) const { return m_handle.string == _other.m_handle.string; }
+	bool operator!=(YulString const& _other) const { return m_handle.string != _other.m_handle.string; }
 
-	bool empty() const { return m_handle.id == 0; }
-	std::string const& str() const
-	{
-		return YulStringRepository::instance().idToString(m_handle.id);
-	}
+	bool empty() const { return m_handle.string == YulStringRepository::emptyString(); }
+	std::string const& str() const { return *m_handle.string; }
 
 	uint64_t hash() const { return m_handle.hash; }
 
 private:
-	/// Handle of the string. Assumes that the empty string has ID zero.
-	YulStringRepository::Handle m_handle{ 0, YulStringRepository::emptyHash() };
+	/// Handle of the string. Assumes that all repositories share the empty string.
+	YulStringRepository::Handle m_handle{ YulStringRepository::emptyString(), YulStringRepository::emptyHash() };
 };
 
 inline YulString operator "" _yulstring(char const* _string, std::size_t _size)
@@ -56,7 +56,7 @@ public:
 
 	struct Representation
 	{
-		std::unique_ptr<Expression> expression;
+		ASTNodePtr<Expression> expression;
 		size_t cost = size_t(-1);
 	};
 
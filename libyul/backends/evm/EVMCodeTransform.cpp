@@ -619,7 +619,7 @@ void CodeTransform::visitExpression(Expression const& _expression)
 	expectDeposit(1, height);
 }
 
-void CodeTransform::visitStatements(vector<Statement> const& _statements)
+void CodeTransform::visitStatements(ASTVector<Statement> const& _statements)
 {
 	std::optional<AbstractAssembly::LabelID> jumpTarget = std::nullopt;
 
@@ -673,7 +673,7 @@ void CodeTransform::finalizeBlock(Block const& _block, int blockStartStackHeight
 	yulAssert(deposit == 0, "Invalid stack height at end of block: " + to_string(deposit));
 }
 
-void CodeTransform::generateMultiAssignment(vector<Identifier> const& _variableNames)
+void CodeTransform::generateMultiAssignment(ASTVector<Identifier> const& _variableNames)
 {
 	yulAssert(m_scope, "");
 	for (auto const& variableName: _variableNames | boost::adaptors::reversed)
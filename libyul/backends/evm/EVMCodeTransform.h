@@ -188,13 +188,13 @@ private:
 	/// Generates code for an expression that is supposed to return a single value.
 	void visitExpression(Expression const& _expression);
 
-	void visitStatements(std::vector<Statement> const& _statements);
+	void visitStatements(ASTVector<Statement> const& _statements);
 
 	/// Pops all variables declared in the block and checks that the stack height is equal
 	/// to @a _blackStartStackHeight.
 	void finalizeBlock(Block const& _block, int _blockStartStackHeight);
 
-	void generateMultiAssignment(std::vector<Identifier> const& _variableNames);
+	void generateMultiAssignment(ASTVector<Identifier> const& _variableNames);
 	void generateAssignment(Identifier const& _variableName);
 
 	/// Determines the stack height difference to the given variables. Throws
@@ -34,6 +34,8 @@
 
 #include <boost/range/adaptor/reversed.hpp>
 
+#include <mutex>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
@@ -189,20 +191,35 @@ BuiltinFunctionForEVM const* EVMDialect::builtin(YulString _name) const
 
 EVMDialect const& EVMDialect::strictAssemblyForEVM(langutil::EVMVersion _version)
 {
-	static map<langutil::EVMVersion, unique_ptr<EVMDialect const>> dialects;
-	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
-	if (!dialects[_version])
-		dialects[_version] = make_unique<EVMDialect>(_version, false);
-	return *dialects[_version];
+	// The builtins refer to strings of the current YulStringRepository.
+	static map<YulStringRepository const*, map<langutil::EVMVersion, unique_ptr<EVMDialect const>>> dialects;
+	static mutex dialectsMutex;
+	static YulStringRepository::ResetCallback callback{[&](YulStringRepository const& _repository)
+	{
+		lock_guard<mutex> lock(dialectsMutex);
+		dialects.erase(&_repository);
+	}};
+	lock_guard<mutex> lock(dialectsMutex);
+	auto& dialect = dialects[&YulStringRepository::instance()][_version];
+	if (!dialect)
+		dialect = make_unique<EVMDialect>(_version, false);
+	return *dialect;
 }
 
 EVMDialect const& EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion _version)
 {
-	static map<langutil::EVMVersion, unique_ptr<EVMDialect const>> dialects;
-	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
-	if (!dialects[_version])
-		dialects[_version] = make_unique<EVMDialect>(_version, true);
-	return *dialects[_version];
+	static map<YulStringRepository const*, map<langutil::EVMVersion, unique_ptr<EVMDialect const>>> dialects;
+	static mutex dialectsMutex;
+	static YulStringRepository::ResetCallback callback{[&](YulStringRepository const& _repository)
+	{
+		lock_guard<mutex> lock(dialectsMutex);
+		dialects.erase(&_repository);
+	}};
+	lock_guard<mutex> lock(dialectsMutex);
+	auto& dialect = dialects[&YulStringRepository::instance()][_version];
+	if (!dialect)
+		dialect = make_unique<EVMDialect>(_version, true);
+	return *dialect;
 }
 
 SideEffects EVMDialect::sideEffectsOfInstruction(evmasm::Instruction _instruction)
@@ -316,9 +333,16 @@ BuiltinFunctionForEVM const* EVMDialectTyped::equalityFunction(YulString _type)
 
 EVMDialectTyped const& EVMDialectTyped::instance(langutil::EVMVersion _version)
 {
-	static map<langutil::EVMVersion, unique_ptr<EVMDialectTyped const>> dialects;
-	static YulStringRepository::ResetCallback callback{[&] { dialects.clear(); }};
-	if (!dialects[_version])
-		dialects[_version] = make_unique<EVMDialectTyped>(_version, true);
-	return *dialects[_version];
+	static map<YulStringRepository const*, map<langutil::EVMVersion, unique_ptr<EVMDialectTyped const>>> dialects;
+	static mutex dialectsMutex;
+	static YulStringRepository::ResetCallback callback{[&](YulStringRepository const& _repository)
+	{
+		lock_guard<mutex> lock(dialectsMutex);
+		dialects.erase(&_repository);
+	}};
+	lock_guard<mutex> lock(dialectsMutex);
+	auto& dialect = dialects[&YulStringRepository::instance()][_version];
+	if (!dialect)
+		dialect = make_unique<EVMDialectTyped>(_version, true);
+	return *dialect;
 }
@@ -293,7 +293,7 @@ wasm::Expression WasmCodeTransform::visitReturnByValue(yul::Expression const& _e
 	return std::visit(*this, _expression);
 }
 
-vector<wasm::Expression> WasmCodeTransform::visit(vector<yul::Expression> const& _expressions)
+vector<wasm::Expression> WasmCodeTransform::visit(yul::ASTVector<yul::Expression> const& _expressions)
 {
 	vector<wasm::Expression> ret;
 	for (auto const& e: _expressions)
@@ -306,7 +306,7 @@ wasm::Expression WasmCodeTransform::visit(yul::Statement const& _statement)
 	return std::visit(*this, _statement);
 }
 
-vector<wasm::Expression> WasmCodeTransform::visit(vector<yul::Statement> const& _statements)
+vector<wasm::Expression> WasmCodeTransform::visit(yul::ASTVector<yul::Statement> const& _statements)
 {
 	vector<wasm::Expression> ret;
 	for (auto const& s: _statements)
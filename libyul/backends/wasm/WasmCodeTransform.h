@@ -64,9 +64,9 @@ private:
 
 	std::unique_ptr<wasm::Expression> visit(yul::Expression const& _expression);
 	wasm::Expression visitReturnByValue(yul::Expression const& _expression);
-	std::vector<wasm::Expression> visit(std::vector<yul::Expression> const& _expressions);
+	std::vector<wasm::Expression> visit(yul::ASTVector<yul::Expression> const& _expressions);
 	wasm::Expression visit(yul::Statement const& _statement);
-	std::vector<wasm::Expression> visit(std::vector<yul::Statement> const& _statements);
+	std::vector<wasm::Expression> visit(yul::ASTVector<yul::Statement> const& _statements);
 
 	/// Returns an assignment or a block containing multiple assignments.
 	/// @param _variableNames the names of the variables to assign to
@@ -22,6 +22,8 @@
 
 #include <libyul/Exceptions.h>
 
+#include <mutex>
+
 using namespace std;
 using namespace solidity::yul;
 
@@ -135,8 +137,15 @@ BuiltinFunction const* WasmDialect::equalityFunction(YulString _type) const
 
 WasmDialect const& WasmDialect::instance()
 {
-	static std::unique_ptr<WasmDialect> dialect;
-	static YulStringRepository::ResetCallback callback{[&] { dialect.reset(); }};
+	static map<YulStringRepository const*, unique_ptr<WasmDialect>> dialects;
+	static mutex dialectsMutex;
+	static YulStringRepository::ResetCallback callback{[&](YulStringRepository const& _repository)
+	{
+		lock_guard<mutex> lock(dialectsMutex);
+		dialects.erase(&_repository);
+	}};
+	lock_guard<mutex> lock(dialectsMutex);
+	unique_ptr<WasmDialect>& dialect = dialects[&YulStringRepository::instance()];
 	if (!dialect)
 		dialect = make_unique<WasmDialect>();
 	return *dialect;
@@ -54,7 +54,7 @@ void WordSizeTransform::operator()(FunctionCall& _fc)
 
 void WordSizeTransform::operator()(If& _if)
 {
-	_if.condition = make_unique<Expression>(FunctionCall{
+	_if.condition = makeASTNode<Expression>(FunctionCall{
 		locationOf(*_if.condition),
 		Identifier{locationOf(*_if.condition), "or_bool"_yulstring},
 		expandValueToVector(*_if.condition)
@@ -70,7 +70,7 @@ void WordSizeTransform::operator()(Switch&)
 void WordSizeTransform::operator()(ForLoop& _for)
 {
 	(*this)(_for.pre);
-	_for.condition = make_unique<Expression>(FunctionCall{
+	_for.condition = makeASTNode<Expression>(FunctionCall{
 		locationOf(*_for.condition),
 		Identifier{locationOf(*_for.condition), "or_bool"_yulstring},
 		expandValueToVector(*_for.condition)
@@ -83,7 +83,7 @@ void WordSizeTransform::operator()(Block& _block)
 {
 	iterateReplacing(
 		_block.statements,
-		[&](Statement& _s) -> std::optional<vector<Statement>>
+		[&](Statement& _s) -> std::optional<ASTVector<Statement>>
 		{
 			if (holds_alternative<VariableDeclaration>(_s))
 			{
@@ -102,12 +102,12 @@ void WordSizeTransform::operator()(Block& _block)
 							yulAssert(f->name == "datasize"_yulstring || f->name == "dataoffset"_yulstring, "");
 							yulAssert(varDecl.variables.size() == 1, "");
 							auto newLhs = generateU64IdentifierNames(varDecl.variables[0].name);
-							vector<Statement> ret;
+							ASTVector<Statement> ret;
 							for (int i = 0; i < 3; i++)
 								ret.push_back(VariableDeclaration{
 									varDecl.location,
 									{TypedName{varDecl.location, newLhs[i], m_targetDialect.defaultType}},
-									make_unique<Expression>(Literal{
+									makeASTNode<Expression>(Literal{
 										locationOf(*varDecl.value),
 										LiteralKind::Number,
 										"0"_yulstring,
@@ -133,7 +133,7 @@ void WordSizeTransform::operator()(Block& _block)
 					yulAssert(varDecl.variables.size() == 1, "");
 					auto newRhs = expandValue(*varDecl.value);
 					auto newLhs = generateU64IdentifierNames(varDecl.variables[0].name);
-					vector<Statement> ret;
+					ASTVector<Statement> ret;
 					for (int i = 0; i < 4; i++)
 						ret.push_back(
 							VariableDeclaration{
@@ -163,12 +163,12 @@ void WordSizeTransform::operator()(Block& _block)
 							yulAssert(f->name == "datasize"_yulstring || f->name == "dataoffset"_yulstring, "");
 							yulAssert(assignment.variableNames.size() == 1, "");
 							auto newLhs = generateU64IdentifierNames(assignment.variableNames[0].name);
-							vector<Statement> ret;
+							ASTVector<Statement> ret;
 							for (int i = 0; i < 3; i++)
 								ret.push_back(Assignment{
 									assignment.location,
 									{Identifier{assignment.location, newLhs[i]}},
-									make_unique<Expression>(Literal{
+									makeASTNode<Expression>(Literal{
 										locationOf(*assignment.value),
 										LiteralKind::Number,
 										"0"_yulstring,
@@ -194,7 +194,7 @@ void WordSizeTransform::operator()(Block& _block)
 					yulAssert(assignment.variableNames.size() == 1, "");
 					auto newRhs = expandValue(*assignment.value);
 					YulString lhsName = assignment.variableNames[0].name;
-					vector<Statement> ret;
+					ASTVector<Statement> ret;
 					for (int i = 0; i < 4; i++)
 						ret.push_back(
 							Assignment{
@@ -254,13 +254,13 @@ void WordSizeTransform::rewriteVarDeclList(TypedNameList& _nameList)
 	);
 }
 
-void WordSizeTransform::rewriteIdentifierList(vector<Identifier>& _ids)
+void WordSizeTransform::rewriteIdentifierList(ASTVector<Identifier>& _ids)
 {
 	iterateReplacing(
 		_ids,
-		[&](Identifier const& _id) -> std::optional<vector<Identifier>>
+		[&](Identifier const& _id) -> std::optional<ASTVector<Identifier>>
 		{
-			vector<Identifier> ret;
+			ASTVector<Identifier> ret;
 			for (auto newId: m_variableMapping.at(_id.name))
 				ret.push_back(Identifier{_id.location, newId});
 			return ret;
@@ -268,21 +268,21 @@ void WordSizeTransform::rewriteIdentifierList(vector<Identifier>& _ids)
 	);
 }
 
-void WordSizeTransform::rewriteFunctionCallArguments(vector<Expression>& _args)
+void WordSizeTransform::rewriteFunctionCallArguments(ASTVector<Expression>& _args)
 {
 	iterateReplacing(
 		_args,
-		[&](Expression& _e) -> std::optional<vector<Expression>>
+		[&](Expression& _e) -> std::optional<ASTVector<Expression>>
 		{
 			return expandValueToVector(_e);
 		}
 	);
 }
 
-vector<Statement> WordSizeTransform::handleSwitchInternal(
+ASTVector<Statement> WordSizeTransform::handleSwitchInternal(
 	langutil::SourceLocation const& _location,
 	vector<YulString> const& _splitExpressions,
-	vector<Case> _cases,
+	ASTVector<Case> _cases,
 	YulString _runDefaultFlag,
 	size_t _depth
 )
@@ -294,7 +294,7 @@ vector<Statement> WordSizeTransform::handleSwitchInternal(
 	}
 
 	// Extract current 64 bit segment and group by it.
-	map<u256, vector<Case>> cases;
+	map<u256, ASTVector<Case>> cases;
 	for (Case& c: _cases)
 	{
 		yulAssert(c.value, "Default case still present.");
@@ -306,7 +306,7 @@ vector<Statement> WordSizeTransform::handleSwitchInternal(
 
 	Switch ret{
 		_location,
-		make_unique<Expression>(Identifier{_location, _splitExpressions.at(_depth)}),
+		makeASTNode<Expression>(Identifier{_location, _splitExpressions.at(_depth)}),
 		{}
 	};
 
@@ -315,7 +315,7 @@ vector<Statement> WordSizeTransform::handleSwitchInternal(
 		Literal label{_location, LiteralKind::Number, YulString(c.first.str()), m_targetDialect.defaultType};
 		ret.cases.emplace_back(Case{
 			c.second.front().location,
-			make_unique<Literal>(std::move(label)),
+			makeASTNode<Literal>(std::move(label)),
 			Block{_location, handleSwitchInternal(
 				_location,
 				_splitExpressions,
@@ -329,25 +329,25 @@ vector<Statement> WordSizeTransform::handleSwitchInternal(
 		ret.cases.emplace_back(Case{
 			_location,
 			nullptr,
-			Block{_location, make_vector<Statement>(
+			Block{_location, makeASTVector<Statement>(
 				Assignment{
 					_location,
 					{{_location, _runDefaultFlag}},
-					make_unique<Expression>(Literal{_location, LiteralKind::Boolean, "true"_yulstring, m_targetDialect.boolType})
+					makeASTNode<Expression>(Literal{_location, LiteralKind::Boolean, "true"_yulstring, m_targetDialect.boolType})
 				}
 			)}
 		});
-	return make_vector<Statement>(std::move(ret));
+	return makeASTVector<Statement>(std::move(ret));
 }
 
-std::vector<Statement> WordSizeTransform::handleSwitch(Switch& _switch)
+ASTVector<Statement> WordSizeTransform::handleSwitch(Switch& _switch)
 {
 	for (auto& c: _switch.cases)
 		(*this)(c.body);
 
 	// Turns the switch into a quadruply-nested switch plus
 	// a flag that tells to execute the default case after all the switches.
-	vector<Statement> ret;
+	ASTVector<Statement> ret;
 
 	YulString runDefaultFlag;
 	Case defaultCase;
@@ -376,7 +376,7 @@ std::vector<Statement> WordSizeTransform::handleSwitch(Switch& _switch)
 	if (!runDefaultFlag.empty())
 		ret.emplace_back(If{
 			_switch.location,
-			make_unique<Expression>(Identifier{_switch.location, runDefaultFlag}),
+			makeASTNode<Expression>(Identifier{_switch.location, runDefaultFlag}),
 			std::move(defaultCase.body)
 		});
 	return ret;
@@ -391,14 +391,14 @@ array<YulString, 4> WordSizeTransform::generateU64IdentifierNames(YulString cons
 	return m_variableMapping[_s];
 }
 
-array<unique_ptr<Expression>, 4> WordSizeTransform::expandValue(Expression const& _e)
+array<ASTNodePtr<Expression>, 4> WordSizeTransform::expandValue(Expression const& _e)
 {
-	array<unique_ptr<Expression>, 4> ret;
+	array<ASTNodePtr<Expression>, 4> ret;
 	if (holds_alternative<Identifier>(_e))
 	{
 		Identifier const& id = std::get<Identifier>(_e);
 		for (int i = 0; i < 4; i++)
-			ret[i] = make_unique<Expression>(Identifier{id.location, m_variableMapping.at(id.name)[i]});
+			ret[i] = makeASTNode<Expression>(Identifier{id.location, m_variableMapping.at(id.name)[i]});
 	}
 	else if (holds_alternative<Literal>(_e))
 	{
@@ -408,7 +408,7 @@ array<unique_ptr<Expression>, 4> WordSizeTransform::expandValue(Expression const
 		{
 			u256 currentVal = val & std::numeric_limits<uint64_t>::max();
 			val >>= 64;
-			ret[i] = make_unique<Expression>(
+			ret[i] = makeASTNode<Expression>(
 				Literal{
 					lit.location,
 					LiteralKind::Number,
@@ -423,10 +423,10 @@ array<unique_ptr<Expression>, 4> WordSizeTransform::expandValue(Expression const
 	return ret;
 }
 
-vector<Expression> WordSizeTransform::expandValueToVector(Expression const& _e)
+ASTVector<Expression> WordSizeTransform::expandValueToVector(Expression const& _e)
 {
-	vector<Expression> ret;
-	for (unique_ptr<Expression>& val: expandValue(_e))
+	ASTVector<Expression> ret;
+	for (ASTNodePtr<Expression>& val: expandValue(_e))
 		ret.emplace_back(std::move(*val));
 	return ret;
 }
@@ -81,22 +81,22 @@ private:
 		NameDispenser& _nameDispenser
 	);
 
-	void rewriteVarDeclList(std::vector<TypedName>&);
-	void rewriteIdentifierList(std::vector<Identifier>&);
-	void rewriteFunctionCallArguments(std::vector<Expression>&);
+	void rewriteVarDeclList(ASTVector<TypedName>&);
+	void rewriteIdentifierList(ASTVector<Identifier>&);
+	void rewriteFunctionCallArguments(ASTVector<Expression>&);
 
-	std::vector<Statement> handleSwitch(Switch& _switch);
-	std::vector<Statement> handleSwitchInternal(
+	ASTVector<Statement> handleSwitch(Switch& _switch);
+	ASTVector<Statement> handleSwitchInternal(
 		langutil::SourceLocation const& _location,
 		std::vector<YulString> const& _splitExpressions,
-		std::vector<Case> _cases,
+		ASTVector<Case> _cases,
 		YulString _runDefaultFlag,
 		size_t _depth
 	);
 
 	std::array<YulString, 4> generateU64IdentifierNames(YulString const& _s);
-	std::array<std::unique_ptr<Expression>, 4> expandValue(Expression const& _e);
-	std::vector<Expression> expandValueToVector(Expression const& _e);
+	std::array<ASTNodePtr<Expression>, 4> expandValue(Expression const& _e);
+	ASTVector<Expression> expandValueToVector(Expression const& _e);
 
 	Dialect const& m_inputDialect;
 	Dialect const& m_targetDialect;
@@ -150,6 +150,12 @@ Block ASTCopier::translate(Block const& _block)
 	return Block{_block.location, translateVector(_block.statements)};
 }
 
+Block ASTCopier::clone(Block const& _block, ASTArena& _arena)
+{
+	ASTArena::Scope arenaScope(_arena);
+	return ASTCopier{}.translate(_block);
+}
+
 Case ASTCopier::translate(Case const& _case)
 {
 	return Case{_case.location, translate(_case.value), translate(_case.body)};
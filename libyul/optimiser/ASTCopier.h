@@ -85,14 +85,17 @@ public:
 	virtual Statement translate(Statement const& _statement);
 
 	Block translate(Block const& _block);
+
+	/// @returns a copy of @a _block whose nodes are allocated in @a _arena.
+	static Block clone(Block const& _block, ASTArena& _arena);
 protected:
 	template <typename T>
-	std::vector<T> translateVector(std::vector<T> const& _values);
+	ASTVector<T> translateVector(ASTVector<T> const& _values);
 
 	template <typename T>
-	std::unique_ptr<T> translate(std::unique_ptr<T> const& _v)
+	ASTNodePtr<T> translate(ASTNodePtr<T> const& _v)
 	{
-		return _v ? std::make_unique<T>(translate(*_v)) : nullptr;
+		return _v ? makeASTNode<T>(translate(*_v)) : nullptr;
 	}
 
 	Case translate(Case const& _case);
@@ -108,9 +111,10 @@ protected:
 };
 
 template <typename T>
-std::vector<T> ASTCopier::translateVector(std::vector<T> const& _values)
+ASTVector<T> ASTCopier::translateVector(ASTVector<T> const& _values)
 {
-	std::vector<T> translated;
+	ASTVector<T> translated;
+	translated.reserve(_values.size());
 	for (auto const& v: _values)
 		translated.emplace_back(translate(v));
 	return translated;
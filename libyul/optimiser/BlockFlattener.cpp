@@ -31,7 +31,7 @@ void BlockFlattener::operator()(Block& _block)
 
 	iterateReplacing(
 		_block.statements,
-		[](Statement& _s) -> std::optional<vector<Statement>>
+		[](Statement& _s) -> std::optional<ASTVector<Statement>>
 		{
 			if (holds_alternative<Block>(_s))
 				return std::move(std::get<Block>(_s).statements);
@@ -23,6 +23,8 @@
 #include <libyul/Utilities.h>
 #include <libsolutil/CommonData.h>
 
+#include <limits>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
@@ -191,3 +193,189 @@ void BlockHasher::operator()(Block const& _block)
 	for (auto& externalReference: subBlockHasher.m_externalReferences)
 		(*this)(Identifier{{}, externalReference});
 }
+
+uint64_t ExpressionHasher::run(Expression const& _e)
+{
+	ExpressionHasher hasher;
+	hasher.visit(_e);
+	return hasher.m_hash;
+}
+
+void ExpressionHasher::operator()(Literal const& _literal)
+{
+	hash64(compileTimeLiteralHash("Literal"));
+	if (_literal.kind == LiteralKind::Number)
+		hash64(static_cast<uint64_t>(valueOfNumberLiteral(_literal) & u256(numeric_limits<uint64_t>::max())));
+	else
+		hash64(_literal.value.hash());
+	hash64(_literal.type.hash());
+	hash64(static_cast<uint64_t>(_literal.kind));
+}
+
+void ExpressionHasher::operator()(Identifier const& _identifier)
+{
+	hash64(compileTimeLiteralHash("Identifier"));
+	hash64(_identifier.name.hash());
+}
+
+void ExpressionHasher::operator()(FunctionCall const& _funCall)
+{
+	hash64(compileTimeLiteralHash("FunctionCall"));
+	hash64(_funCall.functionName.name.hash());
+	hash64(_funCall.arguments.size());
+	ASTWalker::operator()(_funCall);
+}
+
+uint64_t ASTHasher::run(Block const& _block, bool _signaturesOnly)
+{
+	ASTHasher hasher(_signaturesOnly);
+	hasher(_block);
+	return hasher.m_hash;
+}
+
+uint64_t ASTHasher::run(FunctionDefinition const& _function, bool _signaturesOnly)
+{
+	ASTHasher hasher(_signaturesOnly);
+	hasher(_function);
+	return hasher.m_hash;
+}
+
+void ASTHasher::operator()(Literal const& _literal)
+{
+	hash64(compileTimeLiteralHash("Literal"));
+	hash64(_literal.value.hash());
+	hash64(_literal.type.hash());
+	hash64(static_cast<uint64_t>(_literal.kind));
+}
+
+void ASTHasher::operator()(Identifier const& _identifier)
+{
+	hash64(compileTimeLiteralHash("Identifier"));
+	hash64(_identifier.name.hash());
+}
+
+void ASTHasher::operator()(FunctionCall const& _funCall)
+{
+	hash64(compileTimeLiteralHash("FunctionCall"));
+	hash64(_funCall.functionName.name.hash());
+	hash64(_funCall.arguments.size());
+	ASTWalker::operator()(_funCall);
+}
+
+void ASTHasher::operator()(ExpressionStatement const& _statement)
+{
+	hash64(compileTimeLiteralHash("ExpressionStatement"));
+	ASTWalker::operator()(_statement);
+}
+
+void ASTHasher::operator()(Assignment const& _assignment)
+{
+	hash64(compileTimeLiteralHash("Assignment"));
+	hash64(_assignment.variableNames.size());
+	for (auto const& name: _assignment.variableNames)
+		(*this)(name);
+	visit(*_assignment.value);
+}
+
+void ASTHasher::operator()(VariableDeclaration const& _varDecl)
+{
+	hash64(compileTimeLiteralHash("VariableDeclaration"));
+	hashTypedNames(_varDecl.variables);
+	hash64(_varDecl.value ? 1 : 0);
+	ASTWalker::operator()(_varDecl);
+}
+
+void ASTHasher::operator()(If const& _if)
+{
+	hash64(compileTimeLiteralHash("If"));
+	ASTWalker::operator()(_if);
+}
+
+void ASTHasher::operator()(Switch const& _switch)
+{
+	hash64(compileTimeLiteralHash("Switch"));
+	hash64(_switch.cases.size());
+	visit(*_switch.expression);
+	for (auto const& _case: _switch.cases)
+	{
+		hash64(_case.value ? 1 : 0);
+		if (_case.value)
+			(*this)(*_case.value);
+		(*this)(_case.body);
+	}
+}
+
+void ASTHasher::operator()(FunctionDefinition const& _funDef)
+{
+	hashAlways(compileTimeLiteralHash("FunctionDefinition"));
+	hashAlways(_funDef.name.hash());
+	hashAlways(_funDef.parameters.size());
+	for (auto const& parameter: _funDef.parameters)
+	{
+		hashAlways(parameter.name.hash());
+		hashAlways(parameter.type.hash());
+	}
+	hashAlways(_funDef.returnVariables.size());
+	for (auto const& returnVariable: _funDef.returnVariables)
+	{
+		hashAlways(returnVariable.name.hash());
+		hashAlways(returnVariable.type.hash());
+	}
+	ASTWalker::operator()(_funDef);
+}
+
+void ASTHasher::operator()(ForLoop const& _loop)
+{
+	hash64(compileTimeLiteralHash("ForLoop"));
+	ASTWalker::operator()(_loop);
+}
+
+void ASTHasher::operator()(Break const&)
+{
+	hash64(compileTimeLiteralHash("Break"));
+}
+
+void ASTHasher::operator()(Continue const&)
+{
+	hash64(compileTimeLiteralHash("Continue"));
+}
+
+void ASTHasher::operator()(Leave const&)
+{
+	hash64(compileTimeLiteralHash("Leave"));
+}
+
+void ASTHasher::operator()(Block const& _block)
+{
+	hash64(compileTimeLiteralHash("Block"));
+	hash64(static_cast<uint64_t>(_block.location.start));
+	hash64(static_cast<uint64_t>(_block.location.end));
+	hash64(_block.statements.size());
+	ASTWalker::operator()(_block);
+}
+
+void ASTHasher::visit(Statement const& _st)
+{
+	langutil::SourceLocation const location = locationOf(_st);
+	hash64(static_cast<uint64_t>(location.start));
+	hash64(static_cast<uint64_t>(location.end));
+	ASTWalker::visit(_st);
+}
+
+void ASTHasher::visit(Expression const& _e)
+{
+	langutil::SourceLocation const location = locationOf(_e);
+	hash64(static_cast<uint64_t>(location.start));
+	hash64(static_cast<uint64_t>(location.end));
+	ASTWalker::visit(_e);
+}
+
+void ASTHasher::hashTypedNames(TypedNameList const& _names)
+{
+	hash64(_names.size());
+	for (auto const& name: _names)
+	{
+		hash64(name.name.hash());
+		hash64(name.type.hash());
+	}
+}
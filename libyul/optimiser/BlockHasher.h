@@ -105,5 +105,93 @@ private:
 	size_t m_internalIdentifierCount = 0;
 };
 
+/**
+ * Optimiser component that calculates hash values for expressions.
+ * Expressions that are equal according to SyntacticallyEqual (without any declared
+ * variables) have identical hashes, i.e. number literals are hashed by their value.
+ */
+class ExpressionHasher: public ASTWalker
+{
+public:
+	using ASTWalker::operator();
+
+	void operator()(Literal const&) override;
+	void operator()(Identifier const&) override;
+	void operator()(FunctionCall const& _funCall) override;
+
+	static uint64_t run(Expression const& _e);
+
+private:
+	ExpressionHasher() = default;
+
+	void hash64(uint64_t _value)
+	{
+		for (size_t i = 0; i < 8; ++i)
+		{
+			m_hash *= BlockHasher::fnvPrime;
+			m_hash ^= (_value >> (8 * i)) & 0xFF;
+		}
+	}
+
+	uint64_t m_hash = BlockHasher::fnvEmptyHash;
+};
+
+/**
+ * Optimiser component that calculates a hash value for a block or function that,
+ * in contrast to BlockHasher, takes the names of all identifiers and the source
+ * locations into account. Used to detect whether an optimiser step modified the code.
+ *
+ * If @a _signaturesOnly is true, only the names and types of the parameters and
+ * return variables of the function definitions in the code are taken into account.
+ */
+class ASTHasher: public ASTWalker
+{
+public:
+	using ASTWalker::operator();
+
+	void operator()(Literal const&) override;
+	void operator()(Identifier const&) override;
+	void operator()(FunctionCall const& _funCall) override;
+	void operator()(ExpressionStatement const& _statement) override;
+	void operator()(Assignment const& _assignment) override;
+	void operator()(VariableDeclaration const& _varDecl) override;
+	void operator()(If const& _if) override;
+	void operator()(Switch const& _switch) override;
+	void operator()(FunctionDefinition const&) override;
+	void operator()(ForLoop const&) override;
+	void operator()(Break const&) override;
+	void operator()(Continue const&) override;
+	void operator()(Leave const&) override;
+	void operator()(Block const& _block) override;
+
+	void visit(Statement const& _st) override;
+	void visit(Expression const& _e) override;
+
+	static uint64_t run(Block const& _block, bool _signaturesOnly = false);
+	static uint64_t run(FunctionDefinition const& _function, bool _signaturesOnly = false);
+
+private:
+	explicit ASTHasher(bool _signaturesOnly): m_signaturesOnly(_signaturesOnly) {}
+
+	void hash64(uint64_t _value)
+	{
+		if (m_signaturesOnly)
+			return;
+		hashAlways(_value);
+	}
+	void hashAlways(uint64_t _value)
+	{
+		for (size_t i = 0; i < 8; ++i)
+		{
+			m_hash *= BlockHasher::fnvPrime;
+			m_hash ^= (_value >> (8 * i)) & 0xFF;
+		}
+	}
+	void hashTypedNames(TypedNameList const& _names);
+
+	bool const m_signaturesOnly;
+	uint64_t m_hash = BlockHasher::fnvEmptyHash;
+};
+
 
 }
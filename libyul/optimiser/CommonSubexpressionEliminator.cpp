@@ -21,6 +21,7 @@
 
 #include <libyul/optimiser/CommonSubexpressionEliminator.h>
 
+#include <libyul/optimiser/BlockHasher.h>
 #include <libyul/optimiser/Metrics.h>
 #include <libyul/optimiser/SyntacticalEquality.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
@@ -30,6 +31,8 @@
 #include <libyul/AsmData.h>
 #include <libyul/Dialect.h>
 
+#include <boost/range/algorithm_ext/erase.hpp>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
@@ -39,7 +42,7 @@ void CommonSubexpressionEliminator::run(OptimiserStepContext& _context, Block& _
 {
 	CommonSubexpressionEliminator cse{
 		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast))
+		SideEffectsPropagator::sideEffects(_context, _ast)
 	};
 	cse(_ast);
 }
@@ -90,16 +93,39 @@ void CommonSubexpressionEliminator::visit(Expression& _e)
 	}
 	else
 	{
-		// TODO this search is rather inefficient.
-		for (auto const& [variable, value]: m_value)
-		{
-			assertThrow(value.value, OptimizerException, "");
-			assertThrow(inScope(variable), OptimizerException, "");
-			if (SyntacticallyEqual{}(_e, *value.value))
+		auto candidates = m_variablesByValueHash.find(ExpressionHasher::run(_e));
+		if (candidates == m_variablesByValueHash.end())
+			return;
+		boost::remove_erase_if(candidates->second, [&](pair<YulString, Expression const*> const& _candidate) {
+			auto it = m_value.find(_candidate.first);
+			return it == m_value.end() || it->second.value != _candidate.second;
+		});
+		// Use the smallest matching variable, which is the first match in m_value.
+		optional<YulString> match;
+		for (auto const& [variable, value]: candidates->second)
+			if (!match || variable < *match)
 			{
-				_e = Identifier{locationOf(_e), variable};
-				break;
+				assertThrow(inScope(variable), OptimizerException, "");
+				if (SyntacticallyEqual{}(_e, *value))
+					match = variable;
 			}
-		}
+		if (match)
+			_e = Identifier{locationOf(_e), *match};
 	}
 }
+
+void CommonSubexpressionEliminator::operator()(FunctionDefinition& _fun)
+{
+	// The values of variables outside the function are not available inside of it.
+	unordered_map<uint64_t, vector<pair<YulString, Expression const*>>> variablesByValueHash;
+	swap(m_variablesByValueHash, variablesByValueHash);
+	DataFlowAnalyzer::operator()(_fun);
+	swap(m_variablesByValueHash, variablesByValueHash);
+}
+
+void CommonSubexpressionEliminator::assignValue(YulString _variable, Expression const* _value)
+{
+	DataFlowAnalyzer::assignValue(_variable, _value);
+	assertThrow(_value, OptimizerException, "");
+	m_variablesByValueHash[ExpressionHasher::run(*_value)].emplace_back(_variable, _value);
+}
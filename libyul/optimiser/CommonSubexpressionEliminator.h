@@ -24,6 +24,10 @@
 #include <libyul/optimiser/DataFlowAnalyzer.h>
 #include <libyul/optimiser/OptimiserStep.h>
 
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace solidity::yul
 {
 
@@ -49,8 +53,17 @@ private:
 	);
 
 protected:
+	using ASTModifier::operator();
 	using ASTModifier::visit;
+	void operator()(FunctionDefinition&) override;
 	void visit(Expression& _e) override;
+
+	void assignValue(YulString _variable, Expression const* _value) override;
+
+private:
+	/// Variables and the values assigned to them, by the hash of the value.
+	/// Entries whose variable currently has another value or no value are removed lazily.
+	std::unordered_map<uint64_t, std::vector<std::pair<YulString, Expression const*>>> m_variablesByValueHash;
 };
 
 }
@@ -45,7 +45,7 @@ void ConditionalSimplifier::operator()(Switch& _switch)
 				Assignment{
 					_case.body.location,
 					{Identifier{_case.body.location, expr}},
-					make_unique<Expression>(*_case.value)
+					makeASTNode<Expression>(*_case.value)
 				}
 			);
 		}
@@ -57,7 +57,7 @@ void ConditionalSimplifier::operator()(Block& _block)
 {
 	iterateReplacing(
 		_block.statements,
-		[&](Statement& _s) -> std::optional<vector<Statement>>
+		[&](Statement& _s) -> std::optional<ASTVector<Statement>>
 		{
 			visit(_s);
 			if (holds_alternative<If>(_s))
@@ -72,12 +72,12 @@ void ConditionalSimplifier::operator()(Block& _block)
 				{
 					YulString condition = std::get<Identifier>(*_if.condition).name;
 					langutil::SourceLocation location = _if.location;
-					return make_vector<Statement>(
+					return makeASTVector<Statement>(
 						std::move(_s),
 						Assignment{
 							location,
 							{Identifier{location, condition}},
-							make_unique<Expression>(m_dialect.zeroLiteralForType(m_dialect.boolType))
+							makeASTNode<Expression>(m_dialect.zeroLiteralForType(m_dialect.boolType))
 						}
 					);
 				}
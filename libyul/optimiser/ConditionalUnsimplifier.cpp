@@ -65,7 +65,7 @@ void ConditionalUnsimplifier::operator()(Block& _block)
 	walkVector(_block.statements);
 	iterateReplacingWindow<2>(
 		_block.statements,
-		[&](Statement& _stmt1, Statement& _stmt2) -> std::optional<vector<Statement>>
+		[&](Statement& _stmt1, Statement& _stmt2) -> std::optional<ASTVector<Statement>>
 		{
 			if (holds_alternative<If>(_stmt1))
 			{
@@ -89,7 +89,7 @@ void ConditionalUnsimplifier::operator()(Block& _block)
 							holds_alternative<Literal>(*assignment.value) &&
 							valueOfLiteral(std::get<Literal>(*assignment.value)) == 0
 						)
-							return {make_vector<Statement>(std::move(_stmt1))};
+							return {makeASTVector<Statement>(std::move(_stmt1))};
 					}
 				}
 			}
@@ -32,7 +32,7 @@ using namespace solidity;
 using namespace solidity::util;
 using namespace solidity::yul;
 
-using OptionalStatements = std::optional<vector<Statement>>;
+using OptionalStatements = std::optional<ASTVector<Statement>>;
 
 namespace
 {
@@ -78,7 +78,7 @@ void removeEmptyCasesFromSwitch(Switch& _switchStmt)
 
 void ControlFlowSimplifier::run(OptimiserStepContext& _context, Block& _ast)
 {
-	TypeInfo typeInfo(_context.dialect, _ast);
+	TypeInfo typeInfo(_context, _ast);
 	ControlFlowSimplifier{_context.dialect, typeInfo}(_ast);
 }
 
@@ -139,14 +139,14 @@ void ControlFlowSimplifier::visit(Statement& _st)
 		ASTModifier::visit(_st);
 }
 
-void ControlFlowSimplifier::simplify(std::vector<yul::Statement>& _statements)
+void ControlFlowSimplifier::simplify(yul::ASTVector<yul::Statement>& _statements)
 {
 	GenericVisitor visitor{
 		VisitorFallback<OptionalStatements>{},
 		[&](If& _ifStmt) -> OptionalStatements {
 			if (_ifStmt.body.statements.empty() && m_dialect.discardFunction(m_dialect.boolType))
 			{
-				OptionalStatements s = vector<Statement>{};
+				OptionalStatements s = ASTVector<Statement>{};
 				s->emplace_back(makeDiscardCall(
 					_ifStmt.location,
 					*m_dialect.discardFunction(m_dialect.boolType),
@@ -192,7 +192,7 @@ OptionalStatements ControlFlowSimplifier::reduceNoCaseSwitch(Switch& _switchStmt
 
 	auto loc = locationOf(*_switchStmt.expression);
 
-	return make_vector<Statement>(makeDiscardCall(
+	return makeASTVector<Statement>(makeDiscardCall(
 		loc,
 		*discardFunction,
 		std::move(*_switchStmt.expression)
@@ -210,9 +210,9 @@ OptionalStatements ControlFlowSimplifier::reduceSingleCaseSwitch(Switch& _switch
 	{
 		if (!m_dialect.equalityFunction(type))
 			return {};
-		return make_vector<Statement>(If{
+		return makeASTVector<Statement>(If{
 			std::move(_switchStmt.location),
-			make_unique<Expression>(FunctionCall{
+			makeASTNode<Expression>(FunctionCall{
 				loc,
 				Identifier{loc, m_dialect.equalityFunction(type)->name},
 				{std::move(*switchCase.value), std::move(*_switchStmt.expression)}
@@ -225,7 +225,7 @@ OptionalStatements ControlFlowSimplifier::reduceSingleCaseSwitch(Switch& _switch
 		if (!m_dialect.discardFunction(type))
 			return {};
 
-		return make_vector<Statement>(
+		return makeASTVector<Statement>(
 			makeDiscardCall(
 				loc,
 				*m_dialect.discardFunction(type),
@@ -67,10 +67,10 @@ private:
 		m_typeInfo(_typeInfo)
 	{}
 
-	void simplify(std::vector<Statement>& _statements);
+	void simplify(ASTVector<Statement>& _statements);
 
-	std::optional<std::vector<Statement>> reduceNoCaseSwitch(Switch& _switchStmt) const;
-	std::optional<std::vector<Statement>> reduceSingleCaseSwitch(Switch& _switchStmt) const;
+	std::optional<ASTVector<Statement>> reduceNoCaseSwitch(Switch& _switchStmt) const;
+	std::optional<ASTVector<Statement>> reduceSingleCaseSwitch(Switch& _switchStmt) const;
 
 	Dialect const& m_dialect;
 	TypeInfo const& m_typeInfo;
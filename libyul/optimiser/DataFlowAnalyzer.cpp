@@ -104,8 +104,8 @@ void DataFlowAnalyzer::operator()(VariableDeclaration& _varDecl)
 void DataFlowAnalyzer::operator()(If& _if)
 {
 	clearKnowledgeIfInvalidated(*_if.condition);
-	InvertibleMap<YulString, YulString> storage = m_storage;
-	InvertibleMap<YulString, YulString> memory = m_memory;
+	size_t storage = m_storage.checkpoint();
+	size_t memory = m_memory.checkpoint();
 
 	ASTModifier::operator()(_if);
 
@@ -123,8 +123,8 @@ void DataFlowAnalyzer::operator()(Switch& _switch)
 	set<YulString> assignedVariables;
 	for (auto& _case: _switch.cases)
 	{
-		InvertibleMap<YulString, YulString> storage = m_storage;
-		InvertibleMap<YulString, YulString> memory = m_memory;
+		size_t storage = m_storage.checkpoint();
+		size_t memory = m_memory.checkpoint();
 		(*this)(_case.body);
 		joinKnowledge(storage, memory);
 
@@ -331,33 +331,14 @@ void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Expression const& _expr)
 		m_memory.clear();
 }
 
-void DataFlowAnalyzer::joinKnowledge(
-	InvertibleMap<YulString, YulString> const& _olderStorage,
-	InvertibleMap<YulString, YulString> const& _olderMemory
-)
-{
-	joinKnowledgeHelper(m_storage, _olderStorage);
-	joinKnowledgeHelper(m_memory, _olderMemory);
-}
-
-void DataFlowAnalyzer::joinKnowledgeHelper(
-	InvertibleMap<YulString, YulString>& _this,
-	InvertibleMap<YulString, YulString> const& _older
-)
+void DataFlowAnalyzer::joinKnowledge(size_t _olderStorage, size_t _olderMemory)
 {
 	// We clear if the key does not exist in the older map or if the value is different.
-	// This also works for memory because _older is an "older version"
+	// This also works for memory because the older state is an "older version"
 	// of m_memory and thus any overlapping write would have cleared the keys
 	// that are not known to be different inside m_memory already.
-	set<YulString> keysToErase;
-	for (auto const& item: _this.values)
-	{
-		auto it = _older.values.find(item.first);
-		if (it == _older.values.end() || it->second != item.second)
-			keysToErase.insert(item.first);
-	}
-	for (auto const& key: keysToErase)
-		_this.eraseKey(key);
+	m_storage.joinWithCheckpoint(_olderStorage);
+	m_memory.joinWithCheckpoint(_olderMemory);
 }
 
 bool DataFlowAnalyzer::inScope(YulString _variableName) const
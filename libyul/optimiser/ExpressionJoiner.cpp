@@ -84,7 +84,7 @@ ExpressionJoiner::ExpressionJoiner(Block& _ast)
 	m_references = ReferencesCounter::countReferences(_ast);
 }
 
-void ExpressionJoiner::handleArguments(vector<Expression>& _arguments)
+void ExpressionJoiner::handleArguments(ASTVector<Expression>& _arguments)
 {
 	// We have to fill from left to right, but we can only
 	// fill if everything to the right is just an identifier
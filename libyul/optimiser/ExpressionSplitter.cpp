@@ -41,7 +41,7 @@ using namespace solidity::langutil;
 
 void ExpressionSplitter::run(OptimiserStepContext& _context, Block& _ast)
 {
-	TypeInfo typeInfo(_context.dialect, _ast);
+	TypeInfo typeInfo(_context, _ast);
 	ExpressionSplitter{_context.dialect, _context.dispenser, typeInfo}(_ast);
 }
 
@@ -80,11 +80,11 @@ void ExpressionSplitter::operator()(ForLoop& _loop)
 
 void ExpressionSplitter::operator()(Block& _block)
 {
-	vector<Statement> saved;
+	ASTVector<Statement> saved;
 	swap(saved, m_statementsToPrefix);
 
-	function<std::optional<vector<Statement>>(Statement&)> f =
-			[&](Statement& _statement) -> std::optional<vector<Statement>> {
+	function<std::optional<ASTVector<Statement>>(Statement&)> f =
+			[&](Statement& _statement) -> std::optional<ASTVector<Statement>> {
 		m_statementsToPrefix.clear();
 		visit(_statement);
 		if (m_statementsToPrefix.empty())
@@ -110,7 +110,7 @@ void ExpressionSplitter::outlineExpression(Expression& _expr)
 	m_statementsToPrefix.emplace_back(VariableDeclaration{
 		location,
 		{{TypedName{location, var, type}}},
-		make_unique<Expression>(std::move(_expr))
+		makeASTNode<Expression>(std::move(_expr))
 	});
 	_expr = Identifier{location, var};
 	m_typeInfo.setVariableType(var, type);
@@ -85,7 +85,7 @@ private:
 
 	/// List of statements that should go in front of the currently visited AST element,
 	/// at the statement level.
-	std::vector<Statement> m_statementsToPrefix;
+	ASTVector<Statement> m_statementsToPrefix;
 	Dialect const& m_dialect;
 	NameDispenser& m_nameDispenser;
 	TypeInfo& m_typeInfo;
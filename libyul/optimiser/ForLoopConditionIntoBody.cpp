@@ -43,17 +43,17 @@ void ForLoopConditionIntoBody::operator()(ForLoop& _forLoop)
 			begin(_forLoop.body.statements),
 			If {
 				loc,
-				make_unique<Expression>(
+				makeASTNode<Expression>(
 					FunctionCall {
 						loc,
 						{loc, m_dialect.booleanNegationFunction()->name},
-						util::make_vector<Expression>(std::move(*_forLoop.condition))
+						makeASTVector<Expression>(std::move(*_forLoop.condition))
 					}
 				),
-				Block {loc, util::make_vector<Statement>(Break{{}})}
+				Block {loc, makeASTVector<Statement>(Break{{}})}
 			}
 		);
-		_forLoop.condition = make_unique<Expression>(
+		_forLoop.condition = makeASTNode<Expression>(
 			Literal {
 				loc,
 				LiteralKind::Boolean,
@@ -59,12 +59,12 @@ void ForLoopConditionOutOfBody::operator()(ForLoop& _forLoop)
 		holds_alternative<FunctionCall>(*firstStatement.condition) &&
 		std::get<FunctionCall>(*firstStatement.condition).functionName.name == iszero
 	)
-		_forLoop.condition = make_unique<Expression>(std::move(std::get<FunctionCall>(*firstStatement.condition).arguments.front()));
+		_forLoop.condition = makeASTNode<Expression>(std::move(std::get<FunctionCall>(*firstStatement.condition).arguments.front()));
 	else
-		_forLoop.condition = make_unique<Expression>(FunctionCall{
+		_forLoop.condition = makeASTNode<Expression>(FunctionCall{
 			location,
 			Identifier{location, iszero},
-			util::make_vector<Expression>(
+			makeASTVector<Expression>(
 				std::move(*firstStatement.condition)
 			)
 		});
@@ -27,7 +27,7 @@ void ForLoopInitRewriter::operator()(Block& _block)
 {
 	util::iterateReplacing(
 		_block.statements,
-		[&](Statement& _stmt) -> std::optional<vector<Statement>>
+		[&](Statement& _stmt) -> std::optional<ASTVector<Statement>>
 		{
 			if (holds_alternative<ForLoop>(_stmt))
 			{
@@ -35,7 +35,7 @@ void ForLoopInitRewriter::operator()(Block& _block)
 				(*this)(forLoop.pre);
 				(*this)(forLoop.body);
 				(*this)(forLoop.post);
-				vector<Statement> rewrite;
+				ASTVector<Statement> rewrite;
 				swap(rewrite, forLoop.pre.statements);
 				rewrite.emplace_back(move(forLoop));
 				return { std::move(rewrite) };
@@ -151,14 +151,14 @@ bool FullInliner::recursive(FunctionDefinition const& _fun) const
 
 void InlineModifier::operator()(Block& _block)
 {
-	function<std::optional<vector<Statement>>(Statement&)> f = [&](Statement& _statement) -> std::optional<vector<Statement>> {
+	function<std::optional<ASTVector<Statement>>(Statement&)> f = [&](Statement& _statement) -> std::optional<ASTVector<Statement>> {
 		visit(_statement);
 		return tryInlineStatement(_statement);
 	};
 	util::iterateReplacing(_block.statements, f);
 }
 
-std::optional<vector<Statement>> InlineModifier::tryInlineStatement(Statement& _statement)
+std::optional<ASTVector<Statement>> InlineModifier::tryInlineStatement(Statement& _statement)
 {
 	// Only inline for expression statements, assignments and variable declarations.
 	Expression* e = std::visit(util::GenericVisitor{
@@ -180,9 +180,9 @@ std::optional<vector<Statement>> InlineModifier::tryInlineStatement(Statement& _
 	return {};
 }
 
-vector<Statement> InlineModifier::performInline(Statement& _statement, FunctionCall& _funCall)
+ASTVector<Statement> InlineModifier::performInline(Statement& _statement, FunctionCall& _funCall)
 {
-	vector<Statement> newStatements;
+	ASTVector<Statement> newStatements;
 	map<YulString, YulString> variableReplacements;
 
 	FunctionDefinition* function = m_driver.function(_funCall.functionName.name);
@@ -197,9 +197,9 @@ vector<Statement> InlineModifier::performInline(Statement& _statement, FunctionC
 		variableReplacements[_existingVariable.name] = newName;
 		VariableDeclaration varDecl{_funCall.location, {{_funCall.location, newName, _existingVariable.type}}, {}};
 		if (_value)
-			varDecl.value = make_unique<Expression>(std::move(*_value));
+			varDecl.value = makeASTNode<Expression>(std::move(*_value));
 		else
-			varDecl.value = make_unique<Expression>(m_dialect.zeroLiteralForType(varDecl.variables.front().type));
+			varDecl.value = makeASTNode<Expression>(m_dialect.zeroLiteralForType(varDecl.variables.front().type));
 		newStatements.emplace_back(std::move(varDecl));
 	};
 
@@ -219,7 +219,7 @@ vector<Statement> InlineModifier::performInline(Statement& _statement, FunctionC
 				newStatements.emplace_back(Assignment{
 					_assignment.location,
 					{_assignment.variableNames[i]},
-					make_unique<Expression>(Identifier{
+					makeASTNode<Expression>(Identifier{
 						_assignment.location,
 						variableReplacements.at(function->returnVariables[i].name)
 					})
@@ -231,7 +231,7 @@ vector<Statement> InlineModifier::performInline(Statement& _statement, FunctionC
 				newStatements.emplace_back(VariableDeclaration{
 					_varDecl.location,
 					{std::move(_varDecl.variables[i])},
-					make_unique<Expression>(Identifier{
+					makeASTNode<Expression>(Identifier{
 						_varDecl.location,
 						variableReplacements.at(function->returnVariables[i].name)
 					})
@@ -128,8 +128,8 @@ public:
 	void operator()(Block& _block) override;
 
 private:
-	std::optional<std::vector<Statement>> tryInlineStatement(Statement& _statement);
-	std::vector<Statement> performInline(Statement& _statement, FunctionCall& _funCall);
+	std::optional<ASTVector<Statement>> tryInlineStatement(Statement& _statement);
+	ASTVector<Statement> performInline(Statement& _statement, FunctionCall& _funCall);
 
 	YulString m_currentFunction;
 	FullInliner& m_driver;
@@ -35,7 +35,7 @@ void FunctionGrouper::operator()(Block& _block)
 	if (alreadyGrouped(_block))
 		return;
 
-	vector<Statement> reordered;
+	ASTVector<Statement> reordered;
 	reordered.emplace_back(Block{_block.location, {}});
 
 	for (auto&& statement: _block.statements)
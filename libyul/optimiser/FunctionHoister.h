@@ -48,7 +48,7 @@ private:
 	FunctionHoister() = default;
 
 	bool m_isTopLevel = true;
-	std::vector<Statement> m_functions;
+	ASTVector<Statement> m_functions;
 };
 
 }
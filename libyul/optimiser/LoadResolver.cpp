@@ -33,10 +33,10 @@ using namespace solidity::yul;
 
 void LoadResolver::run(OptimiserStepContext& _context, Block& _ast)
 {
-	bool containsMSize = MSizeFinder::containsMSize(_context.dialect, _ast);
+	bool containsMSize = MSizeFinder::containsMSize(_context, _ast);
 	LoadResolver{
 		_context.dialect,
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast)),
+		SideEffectsPropagator::sideEffects(_context, _ast),
 		!containsMSize
 	}(_ast);
 }
@@ -60,7 +60,7 @@ void LoadResolver::visit(Expression& _e)
 void LoadResolver::tryResolve(
 	Expression& _e,
 	evmasm::Instruction _instruction,
-	vector<Expression> const& _arguments
+	ASTVector<Expression> const& _arguments
 )
 {
 	if (_arguments.empty() || !holds_alternative<Identifier>(_arguments.at(0)))
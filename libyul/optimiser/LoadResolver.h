@@ -63,7 +63,7 @@ protected:
 	void tryResolve(
 		Expression& _e,
 		evmasm::Instruction _instruction,
-		std::vector<Expression> const& _arguments
+		ASTVector<Expression> const& _arguments
 	);
 
 	bool m_optimizeMLoad = false;
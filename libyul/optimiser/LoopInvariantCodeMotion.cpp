@@ -33,7 +33,7 @@ using namespace solidity::yul;
 void LoopInvariantCodeMotion::run(OptimiserStepContext& _context, Block& _ast)
 {
 	map<YulString, SideEffects> functionSideEffects =
-		SideEffectsPropagator::sideEffects(_context.dialect, CallGraphGenerator::callGraph(_ast));
+		SideEffectsPropagator::sideEffects(_context, _ast);
 
 	set<YulString> ssaVars = SSAValueTracker::ssaVariables(_ast);
 	LoopInvariantCodeMotion{_context.dialect, ssaVars, functionSideEffects}(_ast);
@@ -43,7 +43,7 @@ void LoopInvariantCodeMotion::operator()(Block& _block)
 {
 	util::iterateReplacing(
 		_block.statements,
-		[&](Statement& _s) -> optional<vector<Statement>>
+		[&](Statement& _s) -> optional<ASTVector<Statement>>
 		{
 			visit(_s);
 			if (holds_alternative<ForLoop>(_s))
@@ -78,16 +78,16 @@ bool LoopInvariantCodeMotion::canBePromoted(
 	return true;
 }
 
-optional<vector<Statement>> LoopInvariantCodeMotion::rewriteLoop(ForLoop& _for)
+optional<ASTVector<Statement>> LoopInvariantCodeMotion::rewriteLoop(ForLoop& _for)
 {
 	assertThrow(_for.pre.statements.empty(), OptimizerException, "");
-	vector<Statement> replacement;
+	ASTVector<Statement> replacement;
 	for (Block* block: {&_for.post, &_for.body})
 	{
 		set<YulString> varsDefinedInScope;
 		util::iterateReplacing(
 			block->statements,
-			[&](Statement& _s) -> optional<vector<Statement>>
+			[&](Statement& _s) -> optional<ASTVector<Statement>>
 			{
 				if (holds_alternative<VariableDeclaration>(_s))
 				{
@@ -96,7 +96,7 @@ optional<vector<Statement>> LoopInvariantCodeMotion::rewriteLoop(ForLoop& _for)
 					{
 						replacement.emplace_back(std::move(_s));
 						// Do not add the variables declared here to varsDefinedInScope because we are moving them.
-						return vector<Statement>{};
+						return ASTVector<Statement>{};
 					}
 					for (auto const& var: varDecl.variables)
 						varsDefinedInScope.insert(var.name);
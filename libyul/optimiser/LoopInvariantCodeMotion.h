@@ -57,7 +57,7 @@ private:
 
 	/// @returns true if the given variable declaration can be moved to in front of the loop.
 	bool canBePromoted(VariableDeclaration const& _varDecl, std::set<YulString> const& _varsDefinedInCurrentScope) const;
-	std::optional<std::vector<Statement>> rewriteLoop(ForLoop& _for);
+	std::optional<ASTVector<Statement>> rewriteLoop(ForLoop& _for);
 
 	Dialect const& m_dialect;
 	std::set<YulString> const& m_ssaVariables;
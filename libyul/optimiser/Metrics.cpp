@@ -98,6 +98,25 @@ void CodeSize::visit(Expression const& _expression)
 }
 
 
+size_t NodeCounter::countNodes(Block const& _block)
+{
+	NodeCounter counter;
+	counter(_block);
+	return counter.m_count;
+}
+
+void NodeCounter::visit(Statement const& _statement)
+{
+	++m_count;
+	ASTWalker::visit(_statement);
+}
+
+void NodeCounter::visit(Expression const& _expression)
+{
+	++m_count;
+	ASTWalker::visit(_expression);
+}
+
 size_t CodeCost::codeCost(Dialect const& _dialect, Expression const& _expr)
 {
 	CodeCost cc(_dialect);
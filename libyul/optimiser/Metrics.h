@@ -66,6 +66,21 @@ private:
 	size_t m_size = 0;
 };
 
+/**
+ * Number of statements and expressions, including those in function definitions.
+ */
+class NodeCounter: public ASTWalker
+{
+public:
+	static size_t countNodes(Block const& _block);
+
+private:
+	void visit(Statement const& _statement) override;
+	void visit(Expression const& _expression) override;
+
+	size_t m_count = 0;
+};
+
 /**
  * Very rough cost that takes the size and execution cost of code into account.
  * The cost per AST element is one, except for literals where it is the byte size.
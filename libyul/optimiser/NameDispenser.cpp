@@ -23,6 +23,7 @@
 #include <libyul/optimiser/NameCollector.h>
 #include <libyul/AsmData.h>
 #include <libyul/Dialect.h>
+#include <libyul/Exceptions.h>
 #include <libyul/backends/evm/EVMDialect.h>
 #include <libyul/AsmParser.h>
 
@@ -56,10 +57,31 @@ YulString NameDispenser::newName(YulString _nameHint)
 	return name;
 }
 
-bool NameDispenser::illegalName(YulString _name)
+NameDispenser NameDispenser::derive() const
+{
+	NameDispenser derived(m_dialect, set<YulString>{});
+	derived.m_counter = m_counter;
+	derived.m_parent = this;
+	return derived;
+}
+
+set<YulString> NameDispenser::merge(NameDispenser const& _derived)
+{
+	yulAssert(_derived.m_parent == this, "");
+	set<YulString> clashes;
+	for (YulString name: _derived.m_usedNames)
+		if (!m_usedNames.insert(name).second)
+			clashes.insert(name);
+	m_counter = max(m_counter, _derived.m_counter);
+	return clashes;
+}
+
+bool NameDispenser::illegalName(YulString _name) const
 {
 	if (_name.empty() || m_usedNames.count(_name) || m_dialect.builtin(_name))
 		return true;
+	if (m_parent && m_parent->illegalName(_name))
+		return true;
 	if (dynamic_cast<EVMDialect const*>(&m_dialect))
 		return Parser::instructions().count(_name.str());
 	return false;
@@ -49,13 +49,26 @@ public:
 	/// Mark @a _name as used, i.e. the dispenser's newName function will not
 	/// return it.
 	void markUsed(YulString _name) { m_usedNames.insert(_name); }
+	/// @returns the number of names marked as used, which grows with every call to newName.
+	size_t usedNameCount() const { return m_usedNames.size(); }
+
+	/// @returns a dispenser that avoids the names used by this dispenser without copying them.
+	/// This dispenser has to outlive the returned one and must not be modified while it is in use.
+	/// Used to generate names for multiple parts of the code concurrently.
+	NameDispenser derive() const;
+	/// Marks the names used by @a _derived, which was derived from this dispenser, as used.
+	/// @returns the names that were already used, i.e. that were also generated by another
+	/// dispenser derived from this one.
+	std::set<YulString> merge(NameDispenser const& _derived);
 
 private:
-	bool illegalName(YulString _name);
+	bool illegalName(YulString _name) const;
 
 	Dialect const& m_dialect;
 	std::set<YulString> m_usedNames;
 	size_t m_counter = 0;
+	/// The dispenser this one was derived from, if any.
+	NameDispenser const* m_parent = nullptr;
 };
 
 }
@@ -18,7 +18,11 @@
 #pragma once
 
 #include <libyul/Exceptions.h>
+#include <libyul/SideEffects.h>
+#include <libyul/YulString.h>
 
+#include <map>
+#include <memory>
 #include <string>
 #include <set>
 
@@ -27,14 +31,30 @@ namespace solidity::yul
 
 struct Dialect;
 struct Block;
-class YulString;
 class NameDispenser;
+class TypeInfo;
+
+/**
+ * Properties of the whole code, for steps that are only run on one function at a time
+ * and thus cannot determine them from the code they are given.
+ */
+struct GlobalProperties
+{
+	/// Side effects of all user-defined functions.
+	std::map<YulString, SideEffects> functionSideEffects;
+	/// Types of all user-defined functions.
+	std::shared_ptr<TypeInfo const> typeInfo;
+	/// True if the code contains the msize instruction.
+	bool containsMSize = false;
+};
 
 struct OptimiserStepContext
 {
 	Dialect const& dialect;
 	NameDispenser& dispenser;
 	std::set<YulString> const& reservedIdentifiers;
+	/// Properties of the whole code if the step is only run on a part of it, nullptr otherwise.
+	GlobalProperties const* global = nullptr;
 };
 
 
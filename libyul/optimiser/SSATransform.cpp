@@ -67,7 +67,7 @@ void IntroduceSSA::operator()(Block& _block)
 {
 	util::iterateReplacing(
 		_block.statements,
-		[&](Statement& _s) -> std::optional<vector<Statement>>
+		[&](Statement& _s) -> std::optional<ASTVector<Statement>>
 		{
 			if (holds_alternative<VariableDeclaration>(_s))
 			{
@@ -85,7 +85,7 @@ void IntroduceSSA::operator()(Block& _block)
 				// Replace "let a := v" by "let a_1 := v  let a := a_1"
 				// Replace "let a, b := v" by "let a_1, b_1 := v  let a := a_1 let b := b_2"
 				auto loc = varDecl.location;
-				vector<Statement> statements;
+				ASTVector<Statement> statements;
 				statements.emplace_back(VariableDeclaration{loc, {}, std::move(varDecl.value)});
 				TypedNameList newVariables;
 				for (auto const& var: varDecl.variables)
@@ -96,7 +96,7 @@ void IntroduceSSA::operator()(Block& _block)
 					statements.emplace_back(VariableDeclaration{
 						loc,
 						{TypedName{loc, oldName, var.type}},
-						make_unique<Expression>(Identifier{loc, newName})
+						makeASTNode<Expression>(Identifier{loc, newName})
 					});
 				}
 				std::get<VariableDeclaration>(statements.front()).variables = std::move(newVariables);
@@ -112,7 +112,7 @@ void IntroduceSSA::operator()(Block& _block)
 				// Replace "a := v" by "let a_1 := v  a := v"
 				// Replace "a, b := v" by "let a_1, b_1 := v  a := a_1 b := b_2"
 				auto loc = assignment.location;
-				vector<Statement> statements;
+				ASTVector<Statement> statements;
 				statements.emplace_back(VariableDeclaration{loc, {}, std::move(assignment.value)});
 				TypedNameList newVariables;
 				for (auto const& var: assignment.variableNames)
@@ -127,7 +127,7 @@ void IntroduceSSA::operator()(Block& _block)
 					statements.emplace_back(Assignment{
 						loc,
 						{Identifier{loc, oldName}},
-						make_unique<Expression>(Identifier{loc, newName})
+						makeASTNode<Expression>(Identifier{loc, newName})
 					});
 				}
 				std::get<VariableDeclaration>(statements.front()).variables = std::move(newVariables);
@@ -230,16 +230,16 @@ void IntroduceControlFlowSSA::operator()(Block& _block)
 
 	util::iterateReplacing(
 		_block.statements,
-		[&](Statement& _s) -> std::optional<vector<Statement>>
+		[&](Statement& _s) -> std::optional<ASTVector<Statement>>
 		{
-			vector<Statement> toPrepend;
+			ASTVector<Statement> toPrepend;
 			for (YulString toReassign: m_variablesToReassign)
 			{
 				YulString newName = m_nameDispenser.newName(toReassign);
 				toPrepend.emplace_back(VariableDeclaration{
 					locationOf(_s),
 					{TypedName{locationOf(_s), newName, m_typeInfo.typeOfVariable(toReassign)}},
-					make_unique<Expression>(Identifier{locationOf(_s), toReassign})
+					makeASTNode<Expression>(Identifier{locationOf(_s), toReassign})
 				});
 				assignedVariables.insert(toReassign);
 			}
@@ -392,7 +392,7 @@ void PropagateValues::operator()(Block& _block)
 
 void SSATransform::run(OptimiserStepContext& _context, Block& _ast)
 {
-	TypeInfo typeInfo(_context.dialect, _ast);
+	TypeInfo typeInfo(_context, _ast);
 	Assignments assignments;
 	assignments(_ast);
 	IntroduceSSA{_context.dispenser, assignments.names(), typeInfo}(_ast);
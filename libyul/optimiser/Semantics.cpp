@@ -81,6 +81,13 @@ bool MSizeFinder::containsMSize(Dialect const& _dialect, Block const& _ast)
 	return finder.m_msizeFound;
 }
 
+bool MSizeFinder::containsMSize(OptimiserStepContext const& _context, Block const& _ast)
+{
+	if (_context.global)
+		return _context.global->containsMSize;
+	return containsMSize(_context.dialect, _ast);
+}
+
 void MSizeFinder::operator()(FunctionCall const& _functionCall)
 {
 	ASTWalker::operator()(_functionCall);
@@ -154,6 +161,31 @@ map<YulString, SideEffects> SideEffectsPropagator::sideEffects(
 	return ret;
 }
 
+map<YulString, SideEffects> SideEffectsPropagator::sideEffects(
+	OptimiserStepContext const& _context,
+	Block const& _ast
+)
+{
+	CallGraph callGraph = CallGraphGenerator::callGraph(_ast);
+	if (!_context.global)
+		return sideEffects(_context.dialect, callGraph);
+
+	map<YulString, SideEffects> ret;
+	auto copySideEffects = [&](YulString _function)
+	{
+		auto it = _context.global->functionSideEffects.find(_function);
+		if (it != _context.global->functionSideEffects.end())
+			ret.insert(*it);
+	};
+	for (auto const& calls: callGraph.functionCalls)
+	{
+		copySideEffects(calls.first);
+		for (YulString callee: calls.second)
+			copySideEffects(callee);
+	}
+	return ret;
+}
+
 MovableChecker::MovableChecker(Dialect const& _dialect, Expression const& _expression):
 	MovableChecker(_dialect)
 {
@@ -172,7 +204,7 @@ void MovableChecker::visit(Statement const&)
 }
 
 pair<TerminationFinder::ControlFlow, size_t> TerminationFinder::firstUnconditionalControlFlowChange(
-	vector<Statement> const& _statements
+	ASTVector<Statement> const& _statements
 )
 {
 	for (size_t i = 0; i < _statements.size(); ++i)
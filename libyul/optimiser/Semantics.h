@@ -23,6 +23,7 @@
 #include <libyul/optimiser/ASTWalker.h>
 #include <libyul/SideEffects.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/optimiser/OptimiserStep.h>
 #include <libyul/AsmData.h>
 
 #include <set>
@@ -88,6 +89,12 @@ public:
 		Dialect const& _dialect,
 		CallGraph const& _directCallGraph
 	);
+	/// @returns the side effects of the functions defined or called in @a _ast. They are taken
+	/// from the global properties of @a _context if the step only runs on a part of the code.
+	static std::map<YulString, SideEffects> sideEffects(
+		OptimiserStepContext const& _context,
+		Block const& _ast
+	);
 };
 
 /**
@@ -102,6 +109,9 @@ class MSizeFinder: public ASTWalker
 {
 public:
 	static bool containsMSize(Dialect const& _dialect, Block const& _ast);
+	/// @returns true if the whole code contains the msize instruction, also if the step
+	/// only runs on a part of it.
+	static bool containsMSize(OptimiserStepContext const& _context, Block const& _ast);
 
 	using ASTWalker::operator();
 	void operator()(FunctionCall const& _funCall);
@@ -185,7 +195,7 @@ public:
 	/// The function might return ``FlowOut`` even though control
 	/// flow cannot actually continue.
 	std::pair<ControlFlow, size_t> firstUnconditionalControlFlowChange(
-		std::vector<Statement> const& _statements
+		ASTVector<Statement> const& _statements
 	);
 
 	/// @returns the control flow type of the given statement.
@@ -46,7 +46,8 @@ SimplificationRule<yul::Pattern> const* SimplificationRules::findFirstMatch(
 	if (!instruction)
 		return nullptr;
 
-	static SimplificationRules rules;
+	// Matching modifies the match groups of the rules, so every thread needs its own copy.
+	static thread_local SimplificationRules rules;
 	assertThrow(rules.isInitialized(), OptimizerException, "Rule list not properly initialized.");
 
 	for (auto const& rule: rules.m_rules[uint8_t(instruction->first)])
@@ -64,7 +65,7 @@ bool SimplificationRules::isInitialized() const
 	return !m_rules[uint8_t(evmasm::Instruction::ADD)].empty();
 }
 
-std::optional<std::pair<evmasm::Instruction, vector<Expression> const*>>
+std::optional<std::pair<evmasm::Instruction, ASTVector<Expression> const*>>
 	SimplificationRules::instructionAndArguments(Dialect const& _dialect, Expression const& _expr)
 {
 	if (holds_alternative<FunctionCall>(_expr))
@@ -220,7 +221,7 @@ Expression Pattern::toExpression(SourceLocation const& _location) const
 	}
 	else if (m_kind == PatternKind::Operation)
 	{
-		vector<Expression> arguments;
+		ASTVector<Expression> arguments;
 		for (auto const& arg: m_arguments)
 			arguments.emplace_back(arg.toExpression(_location));
 
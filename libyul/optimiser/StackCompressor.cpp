@@ -166,9 +166,11 @@ bool StackCompressor::run(
 		"Need to run the function grouper before the stack compressor."
 	);
 	bool allowMSizeOptimzation = !MSizeFinder::containsMSize(_dialect, *_object.code);
+	// Only re-checks the functions that were modified in the previous iteration.
+	IncrementalCompilabilityChecker checker(_dialect, _optimizeStackAllocation);
 	for (size_t iterations = 0; iterations < _maxIterations; iterations++)
 	{
-		map<YulString, int> stackSurplus = CompilabilityChecker::run(_dialect, _object, _optimizeStackAllocation);
+		map<YulString, int> stackSurplus = checker.run(_object);
 		if (stackSurplus.empty())
 			return true;
 
@@ -28,7 +28,7 @@ using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
 
-using OptionalStatements = std::optional<vector<Statement>>;
+using OptionalStatements = std::optional<ASTVector<Statement>>;
 
 namespace {
 
@@ -52,9 +52,9 @@ OptionalStatements replaceConstArgSwitch(Switch& _switchStmt, u256 const& _const
 		matchingCaseBlock = &defaultCase->body;
 
 	if (matchingCaseBlock)
-		return util::make_vector<Statement>(std::move(*matchingCaseBlock));
+		return makeASTVector<Statement>(std::move(*matchingCaseBlock));
 	else
-		return optional<vector<Statement>>{vector<Statement>{}};
+		return optional<ASTVector<Statement>>{ASTVector<Statement>{}};
 }
 
 }
@@ -69,7 +69,7 @@ void StructuralSimplifier::operator()(Block& _block)
 	simplify(_block.statements);
 }
 
-void StructuralSimplifier::simplify(std::vector<yul::Statement>& _statements)
+void StructuralSimplifier::simplify(yul::ASTVector<yul::Statement>& _statements)
 {
 	util::GenericVisitor visitor{
 		util::VisitorFallback<OptionalStatements>{},
@@ -77,7 +77,7 @@ void StructuralSimplifier::simplify(std::vector<yul::Statement>& _statements)
 			if (expressionAlwaysTrue(*_ifStmt.condition))
 				return {std::move(_ifStmt.body.statements)};
 			else if (expressionAlwaysFalse(*_ifStmt.condition))
-				return {vector<Statement>{}};
+				return {ASTVector<Statement>{}};
 			return {};
 		},
 		[&](Switch& _switchStmt) -> OptionalStatements {
@@ -48,7 +48,7 @@ public:
 private:
 	StructuralSimplifier() = default;
 
-	void simplify(std::vector<Statement>& _statements);
+	void simplify(ASTVector<Statement>& _statements);
 	bool expressionAlwaysTrue(Expression const& _expression);
 	bool expressionAlwaysFalse(Expression const& _expression);
 	std::optional<u256> hasLiteralValue(Expression const& _expression) const;
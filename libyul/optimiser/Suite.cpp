@@ -23,6 +23,7 @@
 #include <libyul/optimiser/Disambiguator.h>
 #include <libyul/optimiser/VarDeclInitializer.h>
 #include <libyul/optimiser/BlockFlattener.h>
+#include <libyul/optimiser/BlockHasher.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
 #include <libyul/optimiser/CircularReferencesPruner.h>
 #include <libyul/optimiser/ControlFlowSimplifier.h>
@@ -55,6 +56,8 @@
 #include <libyul/optimiser/LoadResolver.h>
 #include <libyul/optimiser/LoopInvariantCodeMotion.h>
 #include <libyul/optimiser/Metrics.h>
+#include <libyul/optimiser/NameDisplacer.h>
+#include <libyul/optimiser/TypeInfo.h>
 #include <libyul/backends/evm/ConstantOptimiser.h>
 #include <libyul/AsmAnalysis.h>
 #include <libyul/AsmAnalysisInfo.h>
@@ -66,19 +69,45 @@
 #include <libyul/backends/evm/NoOutputAssembly.h>
 
 #include <libsolutil/CommonData.h>
+#include <libsolutil/OptimiserProfile.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <thread>
 
 using namespace std;
 using namespace solidity;
 using namespace solidity::yul;
 
-void OptimiserSuite::run(
+namespace
+{
+
+util::OptimiserProfile::CodeSize measureCode(Block const& _ast)
+{
+	return {NodeCounter::countNodes(_ast), CodeSize::codeSizeIncludingFunctions(_ast)};
+}
+
+}
+
+OptimiserSuite::Statistics OptimiserSuite::run(
 	Dialect const& _dialect,
 	GasMeter const* _meter,
 	Object& _object,
 	bool _optimizeStackAllocation,
-	set<YulString> const& _externallyUsedIdentifiers
+	set<YulString> const& _externallyUsedIdentifiers,
+	bool _functionParallel,
+	unsigned _threads,
+	string const& _optimisationSequence,
+	size_t _maxRounds,
+	chrono::milliseconds _timeBudget
 )
 {
+	if (!_object.arena)
+		_object.arena = make_shared<ASTArena>();
+	ASTArena::Scope arenaScope(*_object.arena);
+
 	set<YulString> reservedIdentifiers = _externallyUsedIdentifiers;
 	reservedIdentifiers += _dialect.fixedFunctionNames();
 
@@ -89,216 +118,38 @@ void OptimiserSuite::run(
 	)(*_object.code));
 	Block& ast = *_object.code;
 
-	OptimiserSuite suite(_dialect, reservedIdentifiers, Debug::None, ast);
-
-	suite.runSequence({
-		VarDeclInitializer::name,
-		FunctionHoister::name,
-		BlockFlattener::name,
-		ForLoopInitRewriter::name,
-		DeadCodeEliminator::name,
-		FunctionGrouper::name,
-		EquivalentFunctionCombiner::name,
-		UnusedPruner::name,
-		CircularReferencesPruner::name,
-		BlockFlattener::name,
-		ControlFlowSimplifier::name,
-		LiteralRematerialiser::name,
-		ConditionalUnsimplifier::name,
-		StructuralSimplifier::name,
-		ControlFlowSimplifier::name,
-		ForLoopConditionIntoBody::name,
-		BlockFlattener::name
-	}, ast);
-
-	// None of the above can make stack problems worse.
+	OptimiserSuite suite(_dialect, reservedIdentifiers, Debug::None, ast, _functionParallel, _threads);
+	if (_timeBudget > chrono::milliseconds::zero())
+		suite.m_deadline = chrono::steady_clock::now() + _timeBudget;
 
-	size_t codeSize = 0;
-	for (size_t rounds = 0; rounds < 12; ++rounds)
+	if (_optimisationSequence.empty())
+		suite.runSequence(DefaultOptimiserSteps, ast, _maxRounds);
+	else
 	{
-		{
-			size_t newSize = CodeSize::codeSizeIncludingFunctions(ast);
-			if (newSize == codeSize)
-				break;
-			codeSize = newSize;
-		}
-
-		{
-			// Turn into SSA and simplify
-			suite.runSequence({
-				ExpressionSplitter::name,
-				SSATransform::name,
-				RedundantAssignEliminator::name,
-				RedundantAssignEliminator::name,
-				ExpressionSimplifier::name,
-				CommonSubexpressionEliminator::name,
-				LoadResolver::name,
-				LoopInvariantCodeMotion::name
-			}, ast);
-		}
-
-		{
-			// perform structural simplification
-			suite.runSequence({
-				CommonSubexpressionEliminator::name,
-				ConditionalSimplifier::name,
-				LiteralRematerialiser::name,
-				ConditionalUnsimplifier::name,
-				StructuralSimplifier::name,
-				LiteralRematerialiser::name,
-				ForLoopConditionOutOfBody::name,
-				ControlFlowSimplifier::name,
-				StructuralSimplifier::name,
-				ControlFlowSimplifier::name,
-				BlockFlattener::name,
-				DeadCodeEliminator::name,
-				ForLoopConditionIntoBody::name,
-				UnusedPruner::name,
-				CircularReferencesPruner::name
-			}, ast);
-		}
-
-		{
-			// simplify again
-			suite.runSequence({
-				LoadResolver::name,
-				CommonSubexpressionEliminator::name,
-				UnusedPruner::name,
-				CircularReferencesPruner::name,
-			}, ast);
-		}
-
-		{
-			// reverse SSA
-			suite.runSequence({
-				SSAReverser::name,
-				CommonSubexpressionEliminator::name,
-				UnusedPruner::name,
-				CircularReferencesPruner::name,
-
-				ExpressionJoiner::name,
-				ExpressionJoiner::name,
-			}, ast);
-		}
-
-		// should have good "compilability" property here.
-
-		{
-			// run functional expression inliner
-			suite.runSequence({
-				ExpressionInliner::name,
-				UnusedPruner::name,
-				CircularReferencesPruner::name,
-			}, ast);
-		}
-
-		{
-			// Prune a bit more in SSA
-			suite.runSequence({
-				ExpressionSplitter::name,
-				SSATransform::name,
-				RedundantAssignEliminator::name,
-				UnusedPruner::name,
-				CircularReferencesPruner::name,
-				RedundantAssignEliminator::name,
-				UnusedPruner::name,
-				CircularReferencesPruner::name,
-			}, ast);
-		}
-
-		{
-			// Turn into SSA again and simplify
-			suite.runSequence({
-				ExpressionSplitter::name,
-				SSATransform::name,
-				RedundantAssignEliminator::name,
-				RedundantAssignEliminator::name,
-				CommonSubexpressionEliminator::name,
-				LoadResolver::name,
-			}, ast);
-		}
-
-		{
-			// run full inliner
-			suite.runSequence({
-				FunctionGrouper::name,
-				EquivalentFunctionCombiner::name,
-				FullInliner::name,
-				BlockFlattener::name
-			}, ast);
-		}
-
-		{
-			// SSA plus simplify
-			suite.runSequence({
-				ConditionalSimplifier::name,
-				LiteralRematerialiser::name,
-				ConditionalUnsimplifier::name,
-				CommonSubexpressionEliminator::name,
-				SSATransform::name,
-				RedundantAssignEliminator::name,
-				RedundantAssignEliminator::name,
-				LoadResolver::name,
-				ExpressionSimplifier::name,
-				LiteralRematerialiser::name,
-				ForLoopConditionOutOfBody::name,
-				StructuralSimplifier::name,
-				BlockFlattener::name,
-				DeadCodeEliminator::name,
-				ControlFlowSimplifier::name,
-				CommonSubexpressionEliminator::name,
-				SSATransform::name,
-				RedundantAssignEliminator::name,
-				RedundantAssignEliminator::name,
-				ForLoopConditionIntoBody::name,
-				UnusedPruner::name,
-				CircularReferencesPruner::name,
-				CommonSubexpressionEliminator::name,
-			}, ast);
-		}
+		validateSequence(_optimisationSequence);
+		suite.runSequence(prerequisiteSteps(), ast);
+		suite.runSequence(_optimisationSequence, ast, _maxRounds);
 	}
 
-	// Make source short and pretty.
-
-	suite.runSequence({
-		ExpressionJoiner::name,
-		Rematerialiser::name,
-		UnusedPruner::name,
-		CircularReferencesPruner::name,
-		ExpressionJoiner::name,
-		UnusedPruner::name,
-		CircularReferencesPruner::name,
-		ExpressionJoiner::name,
-		UnusedPruner::name,
-		CircularReferencesPruner::name,
-
-		SSAReverser::name,
-		CommonSubexpressionEliminator::name,
-		LiteralRematerialiser::name,
-		ForLoopConditionOutOfBody::name,
-		CommonSubexpressionEliminator::name,
-		UnusedPruner::name,
-		CircularReferencesPruner::name,
-
-		ExpressionJoiner::name,
-		Rematerialiser::name,
-		UnusedPruner::name,
-		CircularReferencesPruner::name,
-	}, ast);
+	// The remaining steps are needed to generate code and not subject to the time budget.
+	suite.m_deadline.reset();
 
 	// This is a tuning parameter, but actually just prevents infinite loops.
 	size_t stackCompressorMaxIterations = 16;
-	suite.runSequence({
+	suite.runSequence(vector<string>{
 		FunctionGrouper::name
 	}, ast);
-	// We ignore the return value because we will get a much better error
-	// message once we perform code generation.
-	StackCompressor::run(
-		_dialect,
-		_object,
-		_optimizeStackAllocation,
-		stackCompressorMaxIterations
-	);
+	{
+		util::OptimiserProfile::Recorder recorder("yul", "StackCompressor", [&]() { return measureCode(ast); });
+		// We ignore the return value because we will get a much better error
+		// message once we perform code generation.
+		StackCompressor::run(
+			_dialect,
+			_object,
+			_optimizeStackAllocation,
+			stackCompressorMaxIterations
+		);
+	}
 	suite.runSequence({
 		BlockFlattener::name,
 		DeadCodeEliminator::name,
@@ -313,6 +164,7 @@ void OptimiserSuite::run(
 	if (EVMDialect const* dialect = dynamic_cast<EVMDialect const*>(&_dialect))
 	{
 		yulAssert(_meter, "");
+		util::OptimiserProfile::Recorder recorder("yul", "ConstantOptimiser", [&]() { return measureCode(ast); });
 		ConstantOptimiser{*dialect, *_meter}(ast);
 	}
 	else if (dynamic_cast<WasmDialect const*>(&_dialect))
@@ -325,6 +177,8 @@ void OptimiserSuite::run(
 	VarNameCleaner::run(suite.m_context, ast);
 
 	*_object.analysisInfo = AsmAnalyzer::analyzeStrictAssertCorrect(_dialect, _object);
+
+	return suite.m_statistics;
 }
 
 namespace
@@ -349,9 +203,8 @@ map<string, unique_ptr<OptimiserStep>> optimiserStepCollection()
 
 map<string, unique_ptr<OptimiserStep>> const& OptimiserSuite::allSteps()
 {
-	static map<string, unique_ptr<OptimiserStep>> instance;
-	if (instance.empty())
-		instance = optimiserStepCollection<
+	static map<string, unique_ptr<OptimiserStep>> const instance =
+		optimiserStepCollection<
 			BlockFlattener,
 			CircularReferencesPruner,
 			CommonSubexpressionEliminator,
@@ -422,6 +275,52 @@ map<string, char> const& OptimiserSuite::stepNameToAbbreviationMap()
 	return lookupTable;
 }
 
+bool OptimiserSuite::isFunctionLocal(string const& _step)
+{
+	// All other steps need to see the whole code, because they move code between functions
+	// or remove functions or variables depending on references from other functions.
+	static set<string> const functionLocalSteps{
+		BlockFlattener::name,
+		CommonSubexpressionEliminator::name,
+		ConditionalSimplifier::name,
+		ConditionalUnsimplifier::name,
+		ControlFlowSimplifier::name,
+		DeadCodeEliminator::name,
+		ExpressionJoiner::name,
+		ExpressionSimplifier::name,
+		ExpressionSplitter::name,
+		ForLoopConditionIntoBody::name,
+		ForLoopConditionOutOfBody::name,
+		ForLoopInitRewriter::name,
+		LiteralRematerialiser::name,
+		LoadResolver::name,
+		LoopInvariantCodeMotion::name,
+		RedundantAssignEliminator::name,
+		Rematerialiser::name,
+		SSAReverser::name,
+		SSATransform::name,
+		StructuralSimplifier::name,
+		VarDeclInitializer::name
+	};
+	return functionLocalSteps.count(_step);
+}
+
+vector<string> const& OptimiserSuite::prerequisiteSteps()
+{
+	static vector<string> const steps{
+		FunctionHoister::name,
+		FunctionGrouper::name,
+		ForLoopInitRewriter::name
+	};
+	return steps;
+}
+
+bool OptimiserSuite::isPrerequisite(string const& _step)
+{
+	auto const& steps = prerequisiteSteps();
+	return find(steps.begin(), steps.end(), _step) != steps.end();
+}
+
 map<char, string> const& OptimiserSuite::stepAbbreviationToNameMap()
 {
 	static map<char, string> lookupTable = util::invertMap(stepNameToAbbreviationMap());
@@ -429,16 +328,125 @@ map<char, string> const& OptimiserSuite::stepAbbreviationToNameMap()
 	return lookupTable;
 }
 
+void OptimiserSuite::validateSequence(string const& _stepAbbreviations)
+{
+	bool insideLoop = false;
+	bool hadLoop = false;
+	for (char abbreviation: _stepAbbreviations)
+		switch (abbreviation)
+		{
+		case ' ':
+		case '\n':
+			break;
+		case '[':
+			assertThrow(!insideLoop, OptimizerException, "Nested brackets are not supported in the optimisation sequence.");
+			assertThrow(!hadLoop, OptimizerException, "Only one part of the optimisation sequence can be enclosed in brackets.");
+			insideLoop = true;
+			break;
+		case ']':
+			assertThrow(insideLoop, OptimizerException, "Unbalanced brackets in the optimisation sequence.");
+			insideLoop = false;
+			hadLoop = true;
+			break;
+		default:
+			assertThrow(
+				stepAbbreviationToNameMap().count(abbreviation),
+				OptimizerException,
+				"'"s + abbreviation + "' is not a valid optimisation step abbreviation."
+			);
+		}
+	assertThrow(!insideLoop, OptimizerException, "Unbalanced brackets in the optimisation sequence.");
+}
+
+void OptimiserSuite::runSequence(string const& _stepAbbreviations, Block& _ast, size_t _maxRounds)
+{
+	auto toSteps = [](string const& _abbreviations)
+	{
+		vector<string> steps;
+		for (char abbreviation: _abbreviations)
+			if (abbreviation != ' ' && abbreviation != '\n')
+				steps.emplace_back(stepAbbreviationToNameMap().at(abbreviation));
+		return steps;
+	};
+
+	size_t openingBracket = _stepAbbreviations.find('[');
+	if (openingBracket == string::npos)
+	{
+		runSequence(toSteps(_stepAbbreviations), _ast);
+		return;
+	}
+	size_t closingBracket = _stepAbbreviations.find(']', openingBracket);
+	yulAssert(closingBracket != string::npos, "");
+
+	runSequence(toSteps(_stepAbbreviations.substr(0, openingBracket)), _ast);
+
+	vector<string> roundSteps = toSteps(_stepAbbreviations.substr(openingBracket + 1, closingBracket - openingBracket - 1));
+	size_t codeSize = 0;
+	for (size_t rounds = 0; rounds < _maxRounds && !m_statistics.outOfTime; ++rounds)
+	{
+		{
+			size_t newSize = CodeSize::codeSizeIncludingFunctions(_ast);
+			if (newSize == codeSize)
+				break;
+			codeSize = newSize;
+		}
+		++m_statistics.rounds;
+		runSequence(roundSteps, _ast);
+	}
+
+	runSequence(toSteps(_stepAbbreviations.substr(closingBracket + 1)), _ast);
+}
+
 void OptimiserSuite::runSequence(std::vector<string> const& _steps, Block& _ast)
 {
 	unique_ptr<Block> copy;
 	if (m_debug == Debug::PrintChanges)
 		copy = make_unique<Block>(std::get<Block>(ASTCopier{}(_ast)));
+	optional<uint64_t> astHash;
 	for (string const& step: _steps)
 	{
-		if (m_debug == Debug::PrintStep)
-			cout << "Running " << step << endl;
-		allSteps().at(step)->run(m_context, _ast);
+		if (m_deadline && !isPrerequisite(step) && chrono::steady_clock::now() >= *m_deadline)
+		{
+			m_statistics.outOfTime = true;
+			continue;
+		}
+		if (m_functionParallel && isFunctionLocal(step))
+		{
+			if (m_debug == Debug::PrintStep)
+				cout << "Running " << step << endl;
+			{
+				util::OptimiserProfile::Recorder recorder("yul", step, [&]() { return measureCode(_ast); });
+				runPerFunction(*allSteps().at(step), _ast);
+			}
+			astHash.reset();
+		}
+		else
+		{
+			// Steps only depend on the code and, if they generate names, on the name dispenser.
+			// Thus a step that did not change anything and did not generate names
+			// will not do so if it is run on the same code again.
+			if (!astHash)
+				astHash = ASTHasher::run(_ast);
+			++m_statistics.stepRuns;
+			if (m_unchangedCode.count(step) && m_unchangedCode.at(step) == *astHash)
+			{
+				if (m_debug == Debug::PrintStep)
+					cout << "Skipping " << step << endl;
+				++m_statistics.skippedStepRuns;
+				continue;
+			}
+			if (m_debug == Debug::PrintStep)
+				cout << "Running " << step << endl;
+			size_t usedNameCount = m_dispenser.usedNameCount();
+			{
+				util::OptimiserProfile::Recorder recorder("yul", step, [&]() { return measureCode(_ast); });
+				allSteps().at(step)->run(m_context, _ast);
+			}
+			uint64_t newAstHash = ASTHasher::run(_ast);
+			if (usedNameCount == m_dispenser.usedNameCount() && newAstHash == *astHash)
+				m_unchangedCode[step] = newAstHash;
+			astHash = newAstHash;
+		}
 		if (m_debug == Debug::PrintChanges)
 		{
 			// TODO should add switch to also compare variable names!
@@ -453,3 +461,127 @@ void OptimiserSuite::runSequence(std::vector<string> const& _steps, Block& _ast)
 		}
 	}
 }
+
+void OptimiserSuite::runPerFunction(OptimiserStep const& _step, Block& _ast)
+{
+	GlobalProperties global;
+	global.functionSideEffects = SideEffectsPropagator::sideEffects(
+		m_context.dialect,
+		CallGraphGenerator::callGraph(_ast)
+	);
+	global.typeInfo = make_shared<TypeInfo>(m_context.dialect, _ast);
+	global.containsMSize = MSizeFinder::containsMSize(m_context.dialect, _ast);
+
+	// The first part is the code outside of the top-level functions,
+	// which is kept in front of the functions.
+	vector<Block> parts(1);
+	parts.front().location = _ast.location;
+	for (Statement& statement: _ast.statements)
+		if (holds_alternative<FunctionDefinition>(statement))
+		{
+			parts.emplace_back();
+			parts.back().location = std::get<FunctionDefinition>(statement).location;
+			parts.back().statements.emplace_back(std::move(statement));
+		}
+		else
+			parts.front().statements.emplace_back(std::move(statement));
+	_ast.statements.clear();
+
+	// A part does not have to be processed if the step did not change it before and neither
+	// the part nor the properties of the whole code changed since then.
+	uint64_t globalHash = BlockHasher::fnvEmptyHash;
+	auto combine = [](uint64_t& _hash, uint64_t _value) { _hash = (_hash * BlockHasher::fnvPrime) ^ _value; };
+	for (Block const& part: parts)
+		combine(globalHash, ASTHasher::run(part, true));
+	for (auto const& [name, sideEffects]: global.functionSideEffects)
+	{
+		combine(globalHash, name.hash());
+		combine(globalHash, sideEffects.movable);
+		combine(globalHash, sideEffects.sideEffectFree);
+		combine(globalHash, sideEffects.sideEffectFreeIfNoMSize);
+		combine(globalHash, sideEffects.invalidatesStorage);
+		combine(globalHash, sideEffects.invalidatesMemory);
+	}
+	combine(globalHash, global.containsMSize);
+
+	map<YulString, uint64_t>& unchangedParts = m_unchangedParts[_step.name];
+	vector<YulString> partNames(parts.size());
+	vector<uint64_t> partHashes(parts.size());
+	vector<size_t> pendingParts;
+	for (size_t i = 0; i < parts.size(); ++i)
+	{
+		if (i > 0)
+			partNames[i] = std::get<FunctionDefinition>(parts[i].statements.front()).name;
+		partHashes[i] = globalHash;
+		combine(partHashes[i], ASTHasher::run(parts[i]));
+		++m_statistics.stepRuns;
+		if (unchangedParts.count(partNames[i]) && unchangedParts.at(partNames[i]) == partHashes[i])
+			++m_statistics.skippedStepRuns;
+		else
+			pendingParts.emplace_back(i);
+	}
+
+	vector<NameDispenser> dispensers;
+	dispensers.reserve(parts.size());
+	for (size_t i = 0; i < parts.size(); ++i)
+		dispensers.emplace_back(m_dispenser.derive());
+
+	vector<exception_ptr> failures(parts.size());
+	atomic<size_t> nextPart{0};
+	YulStringRepository& yulStrings = YulStringRepository::instance();
+	auto worker = [&]()
+	{
+		YulStringRepository::Scope yulStringScope(yulStrings);
+		for (size_t next = nextPart++; next < pendingParts.size(); next = nextPart++)
+		{
+			size_t i = pendingParts[next];
+			try
+			{
+				OptimiserStepContext context{m_context.dialect, dispensers[i], m_context.reservedIdentifiers, &global};
+				_step.run(context, parts[i]);
+			}
+			catch (...)
+			{
+				failures[i] = current_exception();
+			}
+		}
+	};
+	if (m_threads <= 1 || pendingParts.size() <= 1)
+		worker();
+	else
+	{
+		vector<thread> threads;
+		for (size_t i = 0; i < min<size_t>(m_threads, pendingParts.size()); ++i)
+			threads.emplace_back([&]() {
+				// Arenas are not shared between threads, but the nodes can still be moved into the AST.
+				ASTArena arena;
+				ASTArena::Scope arenaScope(arena);
+				worker();
+			});
+		for (thread& t: threads)
+			t.join();
+	}
+
+	for (size_t i: pendingParts)
+		if (!failures[i] && dispensers[i].usedNameCount() == 0)
+		{
+			uint64_t partHash = globalHash;
+			combine(partHash, ASTHasher::run(parts[i]));
+			if (partHash == partHashes[i])
+				unchangedParts[partNames[i]] = partHash;
+		}
+
+	// Put the parts back in order. Names that were generated for an earlier part as well
+	// are replaced, so that all names are unique again.
+	for (size_t i = 0; i < parts.size(); ++i)
+	{
+		set<YulString> clashes = m_dispenser.merge(dispensers[i]);
+		if (!clashes.empty())
+			NameDisplacer{m_dispenser, clashes}(parts[i]);
+		_ast.statements += std::move(parts[i].statements);
+	}
+
+	for (exception_ptr const& failure: failures)
+		if (failure)
+			rethrow_exception(failure);
+}
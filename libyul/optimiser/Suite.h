@@ -26,9 +26,12 @@
 #include <libyul/optimiser/NameDispenser.h>
 #include <liblangutil/EVMVersion.h>
 
+#include <chrono>
+#include <map>
+#include <memory>
+#include <optional>
 #include <set>
 #include <string>
-#include <memory>
 
 namespace solidity::yul
 {
@@ -41,6 +44,17 @@ struct Object;
 /**
  * Optimiser suite that combines all steps and also provides the settings for the heuristics.
  * Only optimizes the code of the provided object, does not descend into the sub-objects.
+ *
+ * In function-parallel mode, steps that only look at one function at a time are run
+ * separately on each top-level function and on the code outside of them, concurrently
+ * if more than one thread is allowed. Names generated for different functions are made
+ * unique afterwards. The result does not depend on the number of threads, but it can differ
+ * from the result of the default mode, because names are generated in a different order.
+ *
+ * The steps to run can be given as a sequence of step abbreviations (see
+ * stepNameToAbbreviationMap), where at most one part can be enclosed in brackets.
+ * That part is run repeatedly until the code size does not change anymore
+ * or the maximum number of rounds is reached.
  */
 class OptimiserSuite
 {
@@ -51,15 +65,68 @@ public:
 		PrintStep,
 		PrintChanges
 	};
-	static void run(
+	/// Counts of the step runs, where a step run is the application of a step to the whole code
+	/// or, in function-parallel mode, to one function or to the code outside of the functions.
+	struct Statistics
+	{
+		size_t stepRuns = 0;
+		/// Step runs that were skipped, because the step did not change the same code before.
+		size_t skippedStepRuns = 0;
+		/// Rounds of the main optimisation loop.
+		size_t rounds = 0;
+		/// True if steps were not run because the time budget was exhausted.
+		bool outOfTime = false;
+	};
+
+	/// The sequence of steps run by default. Spaces are only used for readability.
+	static constexpr char DefaultOptimiserSteps[] =
+		"dhfoDgvulfnTUtnIf "
+		"["
+			"xarrscLM cCTUtTOntnfDIul Lcul Vculjj eul xarulrul xarrcL gvif CTUcarrLsTOtfDncarrIulc"
+		"] "
+		"jmuljuljul VcTOcul jmul";
+	static constexpr size_t DefaultMaxRounds = 12;
+
+	/// Optimises the code of @a _object.
+	/// @param _optimisationSequence the steps to run as abbreviations, the default sequence if empty.
+	/// A custom sequence is always preceded by the steps that establish the properties
+	/// (hoisted and grouped functions, empty for loop initialisers) needed by most steps.
+	/// @param _maxRounds the maximum number of times the bracketed part of the sequence is run.
+	/// @param _timeBudget if not zero, no further steps of the sequence are started once that
+	/// much time has passed, except for the prerequisite steps. The steps needed for code
+	/// generation are run nevertheless.
+	/// @returns statistics about the step runs.
+	static Statistics run(
 		Dialect const& _dialect,
 		GasMeter const* _meter,
 		Object& _object,
 		bool _optimizeStackAllocation,
-		std::set<YulString> const& _externallyUsedIdentifiers = {}
+		std::set<YulString> const& _externallyUsedIdentifiers = {},
+		bool _functionParallel = false,
+		unsigned _threads = 1,
+		std::string const& _optimisationSequence = {},
+		size_t _maxRounds = DefaultMaxRounds,
+		std::chrono::milliseconds _timeBudget = std::chrono::milliseconds::zero()
 	);
 
+	/// Throws an OptimizerException if @a _stepAbbreviations is not a valid sequence
+	/// of step abbreviations.
+	static void validateSequence(std::string const& _stepAbbreviations);
+
 	void runSequence(std::vector<std::string> const& _steps, Block& _ast);
+	/// Runs the steps given by @a _stepAbbreviations, repeating the bracketed part
+	/// at most @a _maxRounds times.
+	void runSequence(std::string const& _stepAbbreviations, Block& _ast, size_t _maxRounds = DefaultMaxRounds);
+
+	/// @returns true if @a _step only looks at and modifies one function at a time,
+	/// given the global properties of the code.
+	static bool isFunctionLocal(std::string const& _step);
+
+	/// @returns the steps that establish the properties (hoisted and grouped functions, empty
+	/// for loop initialisers) needed by most other steps, including the ones needed for code generation.
+	/// They are run even once the time budget is exhausted.
+	static std::vector<std::string> const& prerequisiteSteps();
+	static bool isPrerequisite(std::string const& _step);
 
 	static std::map<std::string, std::unique_ptr<OptimiserStep>> const& allSteps();
 	static std::map<std::string, char> const& stepNameToAbbreviationMap();
@@ -70,16 +137,33 @@ private:
 		Dialect const& _dialect,
 		std::set<YulString> const& _externallyUsedIdentifiers,
 		Debug _debug,
-		Block& _ast
+		Block& _ast,
+		bool _functionParallel = false,
+		unsigned _threads = 1
 	):
 		m_dispenser{_dialect, _ast, _externallyUsedIdentifiers},
 		m_context{_dialect, m_dispenser, _externallyUsedIdentifiers},
-		m_debug(_debug)
+		m_debug(_debug),
+		m_functionParallel(_functionParallel),
+		m_threads(_threads)
 	{}
 
+	/// Runs @a _step separately on each top-level function and on the code outside of them.
+	void runPerFunction(OptimiserStep const& _step, Block& _ast);
+
 	NameDispenser m_dispenser;
 	OptimiserStepContext m_context;
 	Debug m_debug;
+	bool m_functionParallel = false;
+	unsigned m_threads = 1;
+	Statistics m_statistics;
+	/// Point in time after which no further steps are started.
+	std::optional<std::chrono::steady_clock::time_point> m_deadline;
+	/// Hash of the code on which a step did not change anything, by step name.
+	std::map<std::string, uint64_t> m_unchangedCode;
+	/// Hash of each part of the code (including the properties of the whole code) that a
+	/// step did not change in function-parallel mode, by step name and function name.
+	std::map<std::string, std::map<YulString, uint64_t>> m_unchangedParts;
 };
 
 }
@@ -21,6 +21,7 @@
 #include <libyul/optimiser/TypeInfo.h>
 
 #include <libyul/optimiser/NameCollector.h>
+#include <libyul/optimiser/OptimiserStep.h>
 
 #include <libyul/AsmData.h>
 #include <libyul/Dialect.h>
@@ -71,10 +72,20 @@ TypeInfo::TypeInfo(Dialect const& _dialect, Block const& _ast):
 	m_dialect(_dialect)
 {
 	TypeCollector types(_ast);
-	m_functionTypes = std::move(types.functionTypes);
+	m_functionTypes = make_shared<map<YulString, FunctionType>>(std::move(types.functionTypes));
 	m_variableTypes = std::move(types.variableTypes);
 }
 
+TypeInfo::TypeInfo(OptimiserStepContext const& _context, Block const& _ast):
+	TypeInfo(_context.dialect, _ast)
+{
+	if (_context.global)
+	{
+		yulAssert(_context.global->typeInfo, "");
+		m_functionTypes = _context.global->typeInfo->m_functionTypes;
+	}
+}
+
 YulString TypeInfo::typeOf(Expression const& _expression) const
 {
 	return std::visit(GenericVisitor{
@@ -84,7 +95,7 @@ YulString TypeInfo::typeOf(Expression const& _expression) const
 			if (BuiltinFunction const* fun = m_dialect.builtin(name))
 				retTypes = &fun->returns;
 			else
-				retTypes = &m_functionTypes.at(name).returns;
+				retTypes = &m_functionTypes->at(name).returns;
 			yulAssert(retTypes && retTypes->size() == 1, "Call to typeOf for non-single-value expression.");
 			return retTypes->front();
 		},
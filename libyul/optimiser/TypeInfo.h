@@ -22,12 +22,14 @@
 #include <libyul/AsmDataForward.h>
 #include <libyul/YulString.h>
 
-#include <vector>
 #include <map>
+#include <memory>
+#include <vector>
 
 namespace solidity::yul
 {
 struct Dialect;
+struct OptimiserStepContext;
 
 /**
  * Helper class that keeps track of the types while performing optimizations.
@@ -38,6 +40,9 @@ class TypeInfo
 {
 public:
 	TypeInfo(Dialect const& _dialect, Block const& _ast);
+	/// Collects the types in @a _ast. The types of the functions are taken from the global
+	/// properties of @a _context if the step only runs on a part of the code.
+	TypeInfo(OptimiserStepContext const& _context, Block const& _ast);
 
 	void setVariableType(YulString _name, YulString _type) { m_variableTypes[_name] = _type; }
 
@@ -58,7 +63,8 @@ private:
 
 	Dialect const& m_dialect;
 	std::map<YulString, YulString> m_variableTypes;
-	std::map<YulString, FunctionType> m_functionTypes;
+	/// Shared with the TypeInfo of the whole code if the step only runs on a part of it.
+	std::shared_ptr<std::map<YulString, FunctionType> const> m_functionTypes;
 };
 
 }
@@ -30,7 +30,7 @@ void VarDeclInitializer::operator()(Block& _block)
 {
 	ASTModifier::operator()(_block);
 
-	using OptionalStatements = std::optional<vector<Statement>>;
+	using OptionalStatements = std::optional<ASTVector<Statement>>;
 	util::GenericVisitor visitor{
 		util::VisitorFallback<OptionalStatements>{},
 		[this](VariableDeclaration& _varDecl) -> OptionalStatements
@@ -40,16 +40,16 @@ void VarDeclInitializer::operator()(Block& _block)
 
 			if (_varDecl.variables.size() == 1)
 			{
-				_varDecl.value = make_unique<Expression>(m_dialect.zeroLiteralForType(_varDecl.variables.front().type));
+				_varDecl.value = makeASTNode<Expression>(m_dialect.zeroLiteralForType(_varDecl.variables.front().type));
 				return {};
 			}
 			else
 			{
-				OptionalStatements ret{vector<Statement>{}};
+				OptionalStatements ret{ASTVector<Statement>{}};
 				langutil::SourceLocation loc{std::move(_varDecl.location)};
 				for (auto& var: _varDecl.variables)
 				{
-					unique_ptr<Expression> expr = make_unique<Expression >(m_dialect.zeroLiteralForType(var.type));
+					ASTNodePtr<Expression> expr = makeASTNode<Expression>(m_dialect.zeroLiteralForType(var.type));
 					ret->emplace_back(VariableDeclaration{loc, {std::move(var)}, std::move(expr)});
 				}
 				return ret;
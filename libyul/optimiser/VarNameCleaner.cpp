@@ -71,7 +71,7 @@ void VarNameCleaner::operator()(VariableDeclaration& _varDecl)
 	ASTModifier::operator()(_varDecl);
 }
 
-void VarNameCleaner::renameVariables(vector<TypedName>& _variables)
+void VarNameCleaner::renameVariables(ASTVector<TypedName>& _variables)
 {
 	for (TypedName& typedName: _variables)
 	{
@@ -67,7 +67,7 @@ private:
 	);
 
 	/// Tries to rename a list of variables.
-	void renameVariables(std::vector<TypedName>& _variables);
+	void renameVariables(ASTVector<TypedName>& _variables);
 
 	/// @returns suffix-stripped name, if a suffix was detected, none otherwise.
 	YulString stripSuffix(YulString const& _name) const;
@@ -36,6 +36,7 @@
 #include <libsolidity/interface/DebugSettings.h>
 
 #include <libyul/AssemblyStack.h>
+#include <libyul/optimiser/Suite.h>
 
 #include <libevmasm/Instruction.h>
 #include <libevmasm/GasMeter.h>
@@ -111,6 +112,7 @@ static string const g_strAstJson = "ast-json";
 static string const g_strAstCompactJson = "ast-compact-json";
 static string const g_strBinary = "bin";
 static string const g_strBinaryRuntime = "bin-runtime";
+static string const g_strCacheDir = "cache-dir";
 static string const g_strCombinedJson = "combined-json";
 static string const g_strCompactJSON = "compact-format";
 static string const g_strContracts = "contracts";
@@ -124,8 +126,13 @@ static string const g_strHelp = "help";
 static string const g_strImportAst = "import-ast";
 static string const g_strInputFile = "input-file";
 static string const g_strInterface = "interface";
+static string const g_strJobs = "jobs";
 static string const g_strYul = "yul";
 static string const g_strYulDialect = "yul-dialect";
+static string const g_strYulFunctionParallel = "yul-function-parallel";
+static string const g_strYulOptimizations = "yul-optimizations";
+static string const g_strYulOptimizerRounds = "yul-optimizer-rounds";
+static string const g_strYulOptimizerTimeBudget = "yul-optimizer-time-budget";
 static string const g_strIR = "ir";
 static string const g_strIROptimized = "ir-optimized";
 static string const g_strIPFS = "ipfs";
@@ -144,6 +151,7 @@ static string const g_strOpcodes = "opcodes";
 static string const g_strOptimize = "optimize";
 static string const g_strOptimizeRuns = "optimize-runs";
 static string const g_strOptimizeYul = "optimize-yul";
+static string const g_strOptimizerProfile = "optimizer-profile";
 static string const g_strOutputDir = "output-dir";
 static string const g_strOverwrite = "overwrite";
 static string const g_strRevertStrings = "revert-strings";
@@ -157,7 +165,10 @@ static set<string> const g_revertStringsArgs
 	revertStringsToString(RevertStrings::VerboseDebug)
 };
 
+static string const g_strServer = "server";
 static string const g_strSignatureHashes = "hashes";
+static string const g_strSMTCacheDir = "smt-cache-dir";
+static string const g_strSMTPortfolio = "smt-portfolio";
 static string const g_strSources = "sources";
 static string const g_strSourceList = "sourceList";
 static string const g_strSrcMap = "srcmap";
@@ -182,6 +193,7 @@ static string const g_argAstCompactJson = g_strAstCompactJson;
 static string const g_argAstJson = g_strAstJson;
 static string const g_argBinary = g_strBinary;
 static string const g_argBinaryRuntime = g_strBinaryRuntime;
+static string const g_argCacheDir = g_strCacheDir;
 static string const g_argCombinedJson = g_strCombinedJson;
 static string const g_argCompactJSON = g_strCompactJSON;
 static string const g_argErrorRecovery = g_strErrorRecovery;
@@ -189,6 +201,7 @@ static string const g_argGas = g_strGas;
 static string const g_argHelp = g_strHelp;
 static string const g_argImportAst = g_strImportAst;
 static string const g_argInputFile = g_strInputFile;
+static string const g_argJobs = g_strJobs;
 static string const g_argYul = g_strYul;
 static string const g_argIR = g_strIR;
 static string const g_argIROptimized = g_strIROptimized;
@@ -205,6 +218,7 @@ static string const g_argOpcodes = g_strOpcodes;
 static string const g_argOptimize = g_strOptimize;
 static string const g_argOptimizeRuns = g_strOptimizeRuns;
 static string const g_argOutputDir = g_strOutputDir;
+static string const g_argServer = g_strServer;
 static string const g_argSignatureHashes = g_strSignatureHashes;
 static string const g_argStandardJSON = g_strStandardJSON;
 static string const g_argStrictAssembly = g_strStrictAssembly;
@@ -563,13 +577,13 @@ bool CommandLineInterface::readInputFilesAndConfigureRemappings()
 					continue;
 				}
 
-				m_sourceCodes[infile.generic_string()] = readFileAsString(infile.string());
+				m_sourceCodes[infile.generic_string()] = SourceBuffer::fromFile(infile.string());
 				path = boost::filesystem::canonical(infile).string();
 			}
 			m_allowedDirectories.push_back(boost::filesystem::path(path).remove_filename());
 		}
 	if (addStdin)
-		m_sourceCodes[g_stdinFileName] = readStandardInput();
+		m_sourceCodes[g_stdinFileName] = SourceBuffer(readStandardInput());
 	if (m_sourceCodes.size() == 0)
 	{
 		serr() << "No input files given. If you wish to use the standard input please specify \"-\" explicitly." << endl;
@@ -642,15 +656,50 @@ bool CommandLineInterface::parseLibraryOption(string const& _input)
 	return true;
 }
 
+bool CommandLineInterface::parseYulOptimizerOptions(OptimiserSettings& _settings)
+{
+	if (m_args.count(g_strYulOptimizations))
+	{
+		_settings.yulOptimiserSteps = m_args[g_strYulOptimizations].as<string>();
+		try
+		{
+			yul::OptimiserSuite::validateSequence(_settings.yulOptimiserSteps);
+		}
+		catch (yul::OptimizerException const& _exception)
+		{
+			serr() << "Invalid optimizer step sequence in --" << g_strYulOptimizations << ": ";
+			serr() << *boost::get_error_info<errinfo_comment>(_exception) << endl;
+			return false;
+		}
+	}
+	_settings.yulOptimiserMaxRounds = m_args[g_strYulOptimizerRounds].as<unsigned>();
+	if (m_args.count(g_strYulOptimizerTimeBudget))
+		_settings.yulOptimiserTimeBudget = m_args[g_strYulOptimizerTimeBudget].as<unsigned>();
+	return true;
+}
+
+bool CommandLineInterface::writeOptimizerProfile(Json::Value const& _profile)
+{
+	string pathName = m_args[g_strOptimizerProfile].as<string>();
+	ofstream outFile(pathName);
+	outFile << jsonPrettyPrint(_profile) << endl;
+	if (!outFile)
+	{
+		serr() << "Could not write the optimizer profile to \"" << pathName << "\"." << endl;
+		return false;
+	}
+	return true;
+}
+
 map<string, Json::Value> CommandLineInterface::parseAstFromInput()
 {
 	map<string, Json::Value> sourceJsons;
-	map<string, string> tmpSources;
+	SourceBufferMap tmpSources;
 
 	for (auto const& srcPair: m_sourceCodes)
 	{
 		Json::Value ast;
-		astAssert(jsonParseStrict(srcPair.second, ast), "Input file could not be parsed to JSON");
+		astAssert(jsonParseStrict(srcPair.second.str(), ast), "Input file could not be parsed to JSON");
 		astAssert(ast.isMember("sources"), "Invalid Format for import-JSON: Must have 'sources'-object");
 
 		for (auto& src: ast["sources"].getMemberNames())
@@ -661,7 +710,7 @@ map<string, Json::Value> CommandLineInterface::parseAstFromInput()
 			astAssert(ast["sources"][src][astKey]["nodeType"].asString() == "SourceUnit",  "Top-level node should be a 'SourceUnit'");
 			astAssert(sourceJsons.count(src) == 0, "All sources must have unique names");
 			sourceJsons.emplace(src, move(ast["sources"][src][astKey]));
-			tmpSources[src] = util::jsonCompactPrint(ast);
+			tmpSources[src] = SourceBuffer(util::jsonCompactPrint(ast));
 		}
 	}
 
@@ -738,6 +787,55 @@ Allowed options)",
 		)
 		(g_strOptimizeYul.c_str(), "Enable Yul optimizer in Solidity. Legacy option: the yul optimizer is enabled as part of the general --optimize option.")
 		(g_strNoOptimizeYul.c_str(), "Disable Yul optimizer in Solidity.")
+		(
+			g_strYulFunctionParallel.c_str(),
+			"Run the function-local steps of the Yul optimizer on each function separately, "
+			"concurrently if --jobs is greater than one. "
+			"This changes the generated code and is recorded in the metadata."
+		)
+		(
+			g_strYulOptimizations.c_str(),
+			po::value<string>()->value_name("steps"),
+			"Sequence of Yul optimizer steps to run instead of the default sequence, given as step abbreviations. "
+			"At most one part can be enclosed in brackets, which is repeated until the code size does not change anymore."
+		)
+		(
+			g_strYulOptimizerRounds.c_str(),
+			po::value<unsigned>()->value_name("n")->default_value(unsigned(yul::OptimiserSuite::DefaultMaxRounds)),
+			"Maximum number of times the bracketed part of the Yul optimizer step sequence is run."
+		)
+		(
+			g_strYulOptimizerTimeBudget.c_str(),
+			po::value<unsigned>()->value_name("ms"),
+			"Do not start any further Yul optimizer step once this many milliseconds have passed for a contract or object. "
+			"The steps needed for code generation are still run. The output then depends on the speed of the machine."
+		)
+		(
+			g_strOptimizerProfile.c_str(),
+			po::value<string>()->value_name("file"),
+			"Write the time and the code size before and after every run of an optimizer step "
+			"to the given file as JSON, grouped by contract (or by source file in assembly mode)."
+		)
+		(
+			g_argJobs.c_str(),
+			po::value<unsigned>()->value_name("n")->default_value(1),
+			"Number of threads used to generate the code of independent contracts, "
+			"to optimise independent sub-assemblies "
+			"and to check SMTChecker verification targets concurrently. "
+			"The output does not depend on this setting."
+		)
+		(
+			g_strSMTPortfolio.c_str(),
+			po::value<string>()->value_name("sequential,race,strictRace")->default_value("sequential"),
+			"How the SMTChecker combines the answers of multiple SMT solvers. "
+			"race queries the solvers concurrently and uses the first answer, "
+			"strictRace queries them concurrently but waits for all answers to detect conflicts."
+		)
+		(
+			g_strSMTCacheDir.c_str(),
+			po::value<string>()->value_name("path"),
+			"Cache the answers of SMT solvers in the given directory and reuse them in later runs of the SMTChecker."
+		)
 		(g_argPrettyJson.c_str(), "Output JSON in pretty format. Currently it only works with the combined JSON output.")
 		(
 			g_argLibraries.c_str(),
@@ -768,6 +866,18 @@ Allowed options)",
 			"Switch to Standard JSON input / output mode, ignoring all options. "
 			"It reads from standard input, if no input file was given, otherwise it reads from the provided input file. The result will be written to standard output."
 		)
+		(
+			g_argServer.c_str(),
+			"Switch to server mode, ignoring all options except --allow-paths, --cache-dir and --smt-cache-dir. "
+			"It reads Standard JSON inputs from standard input, one per line, and writes each result to standard output "
+			"as a single line. Results are reused if the same input is compiled again and none of the imported files changed."
+		)
+		(
+			g_argCacheDir.c_str(),
+			po::value<string>()->value_name("path"),
+			"Cache the outputs of Standard JSON compilations in the given directory and reuse them "
+			"if the same input is compiled again and none of the imported files changed. Only used together with --standard-json or --server."
+		)
 		(
 			g_argImportAst.c_str(),
 			"Import ASTs to be compiled, assumes input holds the AST in compact JSON format."
@@ -950,9 +1060,9 @@ bool CommandLineInterface::processInput()
 			if (!boost::filesystem::is_regular_file(canonicalPath))
 				return ReadCallback::Result{false, "Not a valid file."};
 
-			auto contents = readFileAsString(canonicalPath.string());
+			SourceBuffer contents = SourceBuffer::fromFile(canonicalPath.string());
 			m_sourceCodes[path.generic_string()] = contents;
-			return ReadCallback::Result{true, contents};
+			return ReadCallback::Result{true, {}, move(contents)};
 		}
 		catch (Exception const& _exception)
 		{
@@ -999,10 +1109,31 @@ bool CommandLineInterface::processInput()
 		else
 			input = readFileAsString(jsonFile);
 		StandardCompiler compiler(fileReader);
+		if (m_args.count(g_argCacheDir))
+			compiler.setCacheDirectory(m_args[g_argCacheDir].as<string>());
+		if (m_args.count(g_strSMTCacheDir))
+			compiler.setSMTQueryCacheDirectory(m_args[g_strSMTCacheDir].as<string>());
 		sout() << compiler.compile(std::move(input)) << endl;
 		return true;
 	}
 
+	if (m_args.count(g_argServer))
+	{
+		StandardCompiler compiler(fileReader);
+		if (m_args.count(g_argCacheDir))
+			compiler.setCacheDirectory(m_args[g_argCacheDir].as<string>());
+		else
+			compiler.enableCache();
+		if (m_args.count(g_strSMTCacheDir))
+			compiler.setSMTQueryCacheDirectory(m_args[g_strSMTCacheDir].as<string>());
+		string input;
+		while (getline(cin, input))
+			if (!boost::trim_copy(input).empty())
+				// The output does not contain newlines and is flushed after each request.
+				sout() << compiler.compile(input) << endl;
+		return true;
+	}
+
 	if (!readInputFilesAndConfigureRemappings())
 		return false;
 
@@ -1138,16 +1269,38 @@ bool CommandLineInterface::processInput()
 			m_compiler->setLibraries(m_libraries);
 		m_compiler->setEVMVersion(m_evmVersion);
 		m_compiler->setRevertStringBehaviour(m_revertStrings);
+		if (m_args[g_argJobs].as<unsigned>() == 0)
+		{
+			serr() << "Invalid option for --" << g_argJobs << ": must be at least 1." << endl;
+			return false;
+		}
+		m_compiler->setParallelism(m_args[g_argJobs].as<unsigned>());
+		string const smtPortfolio = m_args[g_strSMTPortfolio].as<string>();
+		if (smtPortfolio == "race")
+			m_compiler->setSMTPortfolioStrategy(smt::PortfolioStrategy::Race);
+		else if (smtPortfolio == "strictRace")
+			m_compiler->setSMTPortfolioStrategy(smt::PortfolioStrategy::StrictRace);
+		else if (smtPortfolio != "sequential")
+		{
+			serr() << "Invalid option for --" << g_strSMTPortfolio << ": " << smtPortfolio << endl;
+			return false;
+		}
+		if (m_args.count(g_strSMTCacheDir))
+			m_compiler->setSMTQueryCache(make_shared<smt::SMTQueryCache>(m_args[g_strSMTCacheDir].as<string>()));
 		// TODO: Perhaps we should not compile unless requested
 
 		m_compiler->enableIRGeneration(m_args.count(g_argIR) || m_args.count(g_argIROptimized));
 		m_compiler->enableEwasmGeneration(m_args.count(g_argEwasm));
+		m_compiler->enableOptimiserProfile(m_args.count(g_strOptimizerProfile));
 
 		OptimiserSettings settings = m_args.count(g_argOptimize) ? OptimiserSettings::standard() : OptimiserSettings::minimal();
 		settings.expectedExecutionsPerDeployment = m_args[g_argOptimizeRuns].as<unsigned>();
 		if (m_args.count(g_strNoOptimizeYul))
 			settings.runYulOptimiser = false;
 		settings.optimizeStackAllocation = settings.runYulOptimiser;
+		settings.yulFunctionParallel = settings.runYulOptimiser && m_args.count(g_strYulFunctionParallel);
+		if (settings.runYulOptimiser && !parseYulOptimizerOptions(settings))
+			return false;
 		m_compiler->setOptimiserSettings(settings);
 
 		if (m_args.count(g_argImportAst))
@@ -1381,7 +1534,7 @@ void CommandLineInterface::handleAst(string const& _argStr)
 
 bool CommandLineInterface::actOnInput()
 {
-	if (m_args.count(g_argStandardJSON) || m_onlyAssemble)
+	if (m_args.count(g_argStandardJSON) || m_args.count(g_argServer) || m_onlyAssemble)
 		// Already done in "processInput" phase.
 		return true;
 	else if (m_onlyLink)
@@ -1414,14 +1567,15 @@ bool CommandLineInterface::link()
 	}
 	for (auto& src: m_sourceCodes)
 	{
-		auto end = src.second.end();
-		for (auto it = src.second.begin(); it != end;)
+		string contents = src.second.str();
+		auto end = contents.end();
+		for (auto it = contents.begin(); it != end;)
 		{
 			while (it != end && *it != '_') ++it;
 			if (it == end) break;
 			if (end - it < placeholderSize)
 			{
-				serr() << "Error in binary object file " << src.first << " at position " << (end - src.second.begin()) << endl;
+				serr() << "Error in binary object file " << src.first << " at position " << (end - contents.begin()) << endl;
 				return false;
 			}
 
@@ -1437,9 +1591,11 @@ bool CommandLineInterface::link()
 		}
 		// Remove hints for resolved libraries.
 		for (auto const& library: m_libraries)
-			boost::algorithm::erase_all(src.second, "\n" + libraryPlaceholderHint(library.first));
-		while (!src.second.empty() && *prev(src.second.end()) == '\n')
-			src.second.resize(src.second.size() - 1);
+			boost::algorithm::erase_all(contents, "\n" + libraryPlaceholderHint(library.first));
+		while (!contents.empty() && *prev(contents.end()) == '\n')
+			contents.resize(contents.size() - 1);
+		// This also releases a memory mapping of the file before writeLinkedFiles overwrites it.
+		src.second = SourceBuffer(move(contents));
 	}
 	return true;
 }
@@ -1448,11 +1604,11 @@ void CommandLineInterface::writeLinkedFiles()
 {
 	for (auto const& src: m_sourceCodes)
 		if (src.first == g_stdinFileName)
-			sout() << src.second << endl;
+			sout() << src.second.view() << endl;
 		else
 		{
 			ofstream outFile(src.first);
-			outFile << src.second;
+			outFile << src.second.view();
 			if (!outFile)
 			{
 				serr() << "Could not write to file " << src.first << ". Aborting." << endl;
@@ -1485,15 +1641,20 @@ bool CommandLineInterface::assemble(
 	bool _optimize
 )
 {
+	OptimiserSettings settings = _optimize ? OptimiserSettings::full() : OptimiserSettings::minimal();
+	settings.yulFunctionParallel = _optimize && m_args.count(g_strYulFunctionParallel);
+	if (_optimize && !parseYulOptimizerOptions(settings))
+		return false;
+
 	bool successful = true;
 	map<string, yul::AssemblyStack> assemblyStacks;
+	map<string, util::OptimiserProfile> optimiserProfiles;
+	bool const profileOptimiser = m_args.count(g_strOptimizerProfile);
 	for (auto const& src: m_sourceCodes)
 	{
-		auto& stack = assemblyStacks[src.first] = yul::AssemblyStack(
-			m_evmVersion,
-			_language,
-			_optimize ? OptimiserSettings::full() : OptimiserSettings::minimal()
-		);
+		auto& stack = assemblyStacks[src.first] = yul::AssemblyStack(m_evmVersion, _language, settings);
+		stack.setParallelism(m_args[g_argJobs].as<unsigned>());
+		util::OptimiserProfile::Scope profileScope(profileOptimiser ? &optimiserProfiles[src.first] : nullptr);
 		try
 		{
 			if (!stack.parseAndAnalyze(src.first, src.second))
@@ -1551,6 +1712,7 @@ bool CommandLineInterface::assemble(
 		sout() << endl << "======= " << src.first << " (" << machine << ") =======" << endl;
 
 		yul::AssemblyStack& stack = assemblyStacks[src.first];
+		util::OptimiserProfile::Scope profileScope(profileOptimiser ? &optimiserProfiles[src.first] : nullptr);
 
 		sout() << endl << "Pretty printed source:" << endl;
 		sout() << stack.print() << endl;
@@ -1601,6 +1763,14 @@ bool CommandLineInterface::assemble(
 			serr() << "No text representation found." << endl;
 	}
 
+	if (profileOptimiser)
+	{
+		Json::Value profile{Json::objectValue};
+		for (auto const& [sourceName, sourceProfile]: optimiserProfiles)
+			profile[sourceName] = sourceProfile.toJson();
+		return writeOptimizerProfile(profile);
+	}
+
 	return true;
 }
 
@@ -1618,6 +1788,12 @@ void CommandLineInterface::outputCompilationResults()
 		return;
 	}
 
+	// The source snippets in the assembly output need the contents as strings.
+	StringMap sourceCodes;
+	if (m_args.count(g_argAsm) && !m_args.count(g_argAsmJson))
+		for (auto const& src: m_sourceCodes)
+			sourceCodes[src.first] = src.second.str();
+
 	vector<string> contracts = m_compiler->contractNames();
 	for (string const& contract: contracts)
 	{
@@ -1631,7 +1807,7 @@ void CommandLineInterface::outputCompilationResults()
 			if (m_args.count(g_argAsmJson))
 				ret = jsonPrettyPrint(m_compiler->assemblyJSON(contract));
 			else
-				ret = m_compiler->assemblyString(contract, m_sourceCodes);
+				ret = m_compiler->assemblyString(contract, sourceCodes);
 
 			if (m_args.count(g_argOutputDir))
 			{
@@ -1657,6 +1833,19 @@ void CommandLineInterface::outputCompilationResults()
 		handleNatspec(false, contract);
 	} // end of contracts iteration
 
+	if (m_args.count(g_strOptimizerProfile))
+	{
+		Json::Value profile{Json::objectValue};
+		for (string const& contract: contracts)
+		{
+			Json::Value contractProfile = m_compiler->optimiserProfile(contract);
+			if (!contractProfile.isNull())
+				profile[contract] = move(contractProfile);
+		}
+		if (!writeOptimizerProfile(profile))
+			m_error = true;
+	}
+
 	if (!g_hasOutput)
 	{
 		if (m_args.count(g_argOutputDir))
@@ -25,6 +25,7 @@
 #include <libsolidity/interface/DebugSettings.h>
 #include <libyul/AssemblyStack.h>
 #include <liblangutil/EVMVersion.h>
+#include <liblangutil/SourceBuffer.h>
 
 #include <boost/program_options.hpp>
 #include <boost/filesystem/path.hpp>
@@ -80,6 +81,12 @@ private:
 	/// Tries to read from the file @a _input or interprets _input literally if that fails.
 	/// It then tries to parse the contents and appends to m_libraries.
 	bool parseLibraryOption(std::string const& _input);
+	/// Applies the options controlling the steps of the Yul optimizer to @a _settings.
+	/// @returns false and prints an error if they are invalid.
+	bool parseYulOptimizerOptions(OptimiserSettings& _settings);
+	/// Writes @a _profile to the file given by --optimizer-profile.
+	/// @returns false and prints an error if that fails.
+	bool writeOptimizerProfile(Json::Value const& _profile);
 
 	/// Tries to read @ m_sourceCodes as a JSONs holding ASTs
 	/// such that they can be imported into the compiler  (importASTs())
@@ -106,7 +113,7 @@ private:
 	/// Compiler arguments variable map
 	boost::program_options::variables_map m_args;
 	/// map of input files to source code strings
-	std::map<std::string, std::string> m_sourceCodes;
+	langutil::SourceBufferMap m_sourceCodes;
 	/// list of remappings
 	std::vector<frontend::CompilerStack::Remapping> m_remappings;
 	/// list of allowed directories to read files from
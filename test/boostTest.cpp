@@ -40,9 +40,13 @@
 #include <test/EVMHost.h>
 #include <test/Common.h>
 
+#include <libsolidity/ast/TypeProvider.h>
+
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/test/tree/observer.hpp>
+#include <memory>
 #include <string>
 
 using namespace boost::unit_test;
@@ -122,6 +126,35 @@ int registerTests(
 	return numTestsAdded;
 }
 
+/// Selects a fresh TypeProvider for every test case, just like the CompilerStack does for every
+/// compilation, so that test cases that analyse code without a CompilerStack do not share types.
+class TypeProviderObserver: public test_observer
+{
+public:
+	void test_unit_start(test_unit const& _unit) override
+	{
+		if (_unit.p_type == TUT_CASE)
+		{
+			m_typeProvider = std::make_unique<solidity::frontend::TypeProvider>();
+			solidity::frontend::TypeProvider::setInstance(m_typeProvider.get());
+		}
+	}
+	void test_unit_finish(test_unit const& _unit, unsigned long) override
+	{
+		if (_unit.p_type == TUT_CASE)
+		{
+			solidity::frontend::TypeProvider::setInstance(nullptr);
+			m_typeProvider.reset();
+		}
+	}
+	/// Observers of priority zero are notified before the initialisation observer of the framework
+	/// is reset, which would turn its uninitialised state into a setup error.
+	int priority() override { return 1; }
+
+private:
+	std::unique_ptr<solidity::frontend::TypeProvider> m_typeProvider;
+};
+
 void initializeOptions()
 {
 	auto const& suite = boost::unit_test::framework::master_test_suite();
@@ -141,6 +174,9 @@ test_suite* init_unit_test_suite( int /*argc*/, char* /*argv*/[] )
 
 	initializeOptions();
 
+	static TypeProviderObserver typeProviderObserver;
+	framework::register_observer(typeProviderObserver);
+
 	bool disableSemantics = !solidity::test::EVMHost::getVM(solidity::test::CommonOptions::get().evmonePath.string());
 	if (disableSemantics)
 	{
@@ -410,6 +410,17 @@ SOLTMPDIR=$(mktemp -d)
     fi
 )
 
+printTask "Testing server mode..."
+(
+    input='{"language": "Solidity", "sources": {"a.sol": {"content": "contract C {}"}}, "settings": {"outputSelection": {"*": {"*": ["evm.bytecode.object"]}}}}'
+    output=$(printf '%s\n\n%s\n' "$input" "$input" | "$SOLC" --server)
+    if [[ $(echo "$output" | wc -l) != 2 || !("$output" =~ '"cache":{"hits":1,"misses":1}') ]]
+    then
+        printError "Incorrect output in server mode: $output"
+        exit 1
+    fi
+)
+
 printTask "Testing AST import..."
 SOLTMPDIR=$(mktemp -d)
 (
@@ -830,6 +830,42 @@ BOOST_AUTO_TEST_CASE(block_deduplicator_loops)
 	BOOST_CHECK_EQUAL(pushTags.size(), 1);
 }
 
+BOOST_AUTO_TEST_CASE(block_deduplicator_nested)
+{
+	// Blocks 1 and 2 only become equal once blocks 3 and 4 are unified.
+	AssemblyItems input{
+		AssemblyItem(PushTag, 1),
+		AssemblyItem(PushTag, 2),
+		Instruction::JUMPI,
+		Instruction::STOP,
+		AssemblyItem(Tag, 3),
+		u256(5),
+		u256(6),
+		Instruction::SSTORE,
+		Instruction::STOP,
+		AssemblyItem(Tag, 4),
+		u256(5),
+		u256(6),
+		Instruction::SSTORE,
+		Instruction::STOP,
+		AssemblyItem(Tag, 1),
+		AssemblyItem(PushTag, 3),
+		Instruction::JUMP,
+		AssemblyItem(Tag, 2),
+		AssemblyItem(PushTag, 4),
+		Instruction::JUMP
+	};
+	BlockDeduplicator dedup(input);
+	BOOST_CHECK(dedup.deduplicate());
+
+	set<u256> pushTags;
+	for (AssemblyItem const& item: input)
+		if (item.type() == PushTag)
+			pushTags.insert(item.data());
+	BOOST_CHECK((pushTags == set<u256>{1, 3}));
+	BOOST_CHECK((dedup.replacedTags() == map<u256, u256>{{2, 1}, {4, 3}}));
+}
+
 BOOST_AUTO_TEST_CASE(clear_unreachable_code)
 {
 	AssemblyItems items{
@@ -890,6 +926,44 @@ BOOST_AUTO_TEST_CASE(peephole_double_push)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(peephole_repeated)
+{
+	// Each run enables the next rewrite, the surrounding items are not touched.
+	AssemblyItems items{
+		u256(7),
+		Instruction::SLOAD,
+		u256(8),
+		Instruction::SSTORE,
+		Instruction::CALLER,
+		u256(1),
+		u256(2),
+		Instruction::ADD,
+		Instruction::POP,
+		Instruction::POP,
+		Instruction::POP,
+		u256(9),
+		Instruction::SLOAD
+	};
+	AssemblyItems expectation{
+		u256(7),
+		Instruction::SLOAD,
+		u256(8),
+		Instruction::SSTORE,
+		Instruction::POP,
+		u256(9),
+		Instruction::SLOAD
+	};
+	PeepholeOptimiser peepOpt(items);
+	size_t runs = 0;
+	while (peepOpt.optimise())
+		runs++;
+	BOOST_CHECK_EQUAL(runs, 4);
+	BOOST_CHECK_EQUAL_COLLECTIONS(
+		items.begin(), items.end(),
+		expectation.begin(), expectation.end()
+	);
+}
+
 BOOST_AUTO_TEST_CASE(peephole_pop_calldatasize)
 {
 	AssemblyItems items{
@@ -1154,6 +1228,66 @@ BOOST_AUTO_TEST_CASE(jumpdest_removal_subassemblies)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(parallel_subassemblies)
+{
+	// Optimising sub-assemblies concurrently has to give the same result as optimising
+	// them sequentially, also if an assembly is shared between multiple subs.
+	auto createMain = []()
+	{
+		auto createSub = [](u256 _value)
+		{
+			AssemblyPointer sub = make_shared<Assembly>();
+			auto t1 = sub->newTag();
+			sub->append(t1);
+			sub->append(_value);
+			sub->append(u256(2));
+			sub->append(Instruction::ADD);
+			sub->append(Instruction::POP);
+			auto t2 = sub->newTag();
+			sub->append(t2); // Identical to t1, will be unified
+			sub->append(_value);
+			sub->append(u256(2));
+			sub->append(Instruction::ADD);
+			sub->append(Instruction::POP);
+			sub->append(t2.pushTag());
+			sub->append(Instruction::JUMP);
+			return make_pair(sub, t2);
+		};
+
+		auto main = make_shared<Assembly>();
+		auto [shared, sharedTag] = createSub(100);
+		for (unsigned i = 0; i < 6; ++i)
+		{
+			auto [sub, tag] = createSub(i);
+			if (i % 2 == 0)
+				sub->appendSubroutine(shared);
+			size_t subId = size_t(main->appendSubroutine(sub).data());
+			main->append(tag.toSubAssemblyTag(subId));
+		}
+		size_t sharedId = size_t(main->appendSubroutine(shared).data());
+		main->append(sharedTag.toSubAssemblyTag(sharedId));
+		return main;
+	};
+
+	Assembly::OptimiserSettings settings;
+	settings.isCreation = true;
+	settings.runJumpdestRemover = true;
+	settings.runPeephole = true;
+	settings.runDeduplicate = true;
+	settings.runCSE = true;
+	settings.runConstantOptimiser = true;
+	settings.evmVersion = solidity::test::CommonOptions::get().evmVersion();
+
+	auto sequential = createMain();
+	sequential->optimise(settings);
+	settings.parallelism = 4;
+	auto parallel = createMain();
+	parallel->optimise(settings);
+
+	BOOST_CHECK_EQUAL(sequential->assemblyString(), parallel->assemblyString());
+	BOOST_CHECK(sequential->assemble().bytecode == parallel->assemble().bytecode);
+}
+
 BOOST_AUTO_TEST_CASE(cse_sub_zero)
 {
 	checkCSE({
@@ -47,6 +47,22 @@ BOOST_AUTO_TEST_CASE(test_fail)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(shared_buffer)
+{
+	std::string const text = "lorem ipsum";
+	auto owner = std::make_shared<int>(0);
+	SourceBuffer buffer(std::string_view(text.data(), 5), owner);
+	CharStream source(buffer, "source");
+
+	BOOST_CHECK(source.source().data() == text.data());
+	BOOST_CHECK(source.buffer().data() == text.data());
+	BOOST_CHECK_EQUAL(owner.use_count(), 3);
+	BOOST_CHECK('m' == source.setPosition(4));
+	BOOST_CHECK(0 == source.advanceAndGet());
+	BOOST_CHECK(0 == source.get(1));
+	BOOST_CHECK(source.isPastEndOfInput());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -45,6 +45,65 @@ BOOST_AUTO_TEST_CASE(test_fail)
 	BOOST_CHECK((SourceLocation{3, 7, sourceA} < SourceLocation{4, 6, sourceB}));
 }
 
+BOOST_AUTO_TEST_CASE(source_lifetime)
+{
+	SourceLocation location;
+	{
+		auto const source = std::make_shared<CharStream>("lorem ipsum", "source");
+		location = SourceLocation{0, 5, source};
+		BOOST_CHECK_EQUAL(location.text(), "lorem");
+		BOOST_CHECK(SourceLocation(0, 5, source) == location);
+	}
+	// The name and the length are still known, but the contents are gone.
+	BOOST_CHECK(location.hasSource());
+	BOOST_CHECK_EQUAL(location.sourceName(), "source");
+	BOOST_CHECK(location.hasText());
+	BOOST_CHECK(!location.source());
+
+	// Sources with the same name and contents share their index.
+	auto const other = std::make_shared<CharStream>("lorem ipsum", "source");
+	BOOST_CHECK(SourceLocation(0, 5, other) == location);
+	BOOST_CHECK(location.source() == other);
+	auto const changed = std::make_shared<CharStream>("lorem ipsun", "source");
+	BOOST_CHECK(SourceLocation(0, 5, changed) != location);
+}
+
+BOOST_AUTO_TEST_CASE(same_contents)
+{
+	auto first = std::make_shared<CharStream>("lorem ipsum", "same_contents");
+	auto const second = std::make_shared<CharStream>("lorem ipsum", "same_contents");
+	uint32_t const index = SourceRegistry::add(first);
+	BOOST_CHECK_EQUAL(SourceRegistry::add(second), index);
+	BOOST_CHECK(SourceRegistry::charStream(index) == first);
+	BOOST_CHECK(SourceRegistry::add(std::make_shared<CharStream>("lorem ipsum", "other")) != index);
+	BOOST_CHECK(SourceRegistry::add(std::make_shared<CharStream>("lorem", "same_contents")) != index);
+	BOOST_CHECK(SourceRegistry::addName("same_contents") != index);
+
+	// The contents stay available while any of the streams exists.
+	SourceLocation const location{0, 5, first};
+	BOOST_CHECK_EQUAL(location.text(), "lorem");
+	first.reset();
+	BOOST_CHECK(SourceRegistry::charStream(index) == second);
+	BOOST_CHECK_EQUAL(location.text(), "lorem");
+
+	// Registering many streams with the same contents does not add entries.
+	uint32_t const before = SourceRegistry::add(std::make_shared<CharStream>("lorem ipsum dolor", "same_contents"));
+	for (size_t i = 0; i < 1000; ++i)
+		BOOST_CHECK_EQUAL(SourceRegistry::add(std::make_shared<CharStream>("lorem ipsum", "same_contents")), index);
+	uint32_t const after = SourceRegistry::add(std::make_shared<CharStream>("lorem ipsum dolor sit", "same_contents"));
+	BOOST_CHECK_EQUAL(after, before + 1);
+}
+
+BOOST_AUTO_TEST_CASE(name_only)
+{
+	SourceLocation const a = parseSourceLocation("1:2:0", "source.sol");
+	SourceLocation const b = parseSourceLocation("1:2:0", "source.sol");
+	BOOST_CHECK(a == b);
+	BOOST_CHECK_EQUAL(a.sourceName(), "source.sol");
+	BOOST_CHECK(!a.source());
+	BOOST_CHECK(!a.hasText());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
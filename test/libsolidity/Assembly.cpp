@@ -105,7 +105,7 @@ void printAssemblyLocations(AssemblyItems const& _items)
 			", " <<
 			_loc.end <<
 			", make_shared<string>(\"" <<
-			_loc.source->name() <<
+			_loc.sourceName() <<
 			"\"))) +" << endl;
 	};
 
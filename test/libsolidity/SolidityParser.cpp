@@ -671,19 +671,22 @@ BOOST_AUTO_TEST_CASE(inline_asm_end_location)
 	class CheckInlineAsmLocation: public ASTConstVisitor
 	{
 	public:
+		explicit CheckInlineAsmLocation(std::string const& _source): m_source(_source) {}
 		bool visited = false;
 		virtual bool visit(InlineAssembly const& _inlineAsm)
 		{
 			auto loc = _inlineAsm.location();
-			auto asmStr = loc.source->source().substr(loc.start, loc.end - loc.start);
+			auto asmStr = m_source.substr(loc.start, loc.end - loc.start);
 			BOOST_CHECK_EQUAL(asmStr, "assembly { a := 0x12345678 }");
 			visited = true;
 
 			return false;
 		}
+	private:
+		std::string const& m_source;
 	};
 
-	CheckInlineAsmLocation visitor;
+	CheckInlineAsmLocation visitor(sourceCode);
 	contract->accept(visitor);
 
 	BOOST_CHECK_MESSAGE(visitor.visited, "No inline asm block found?!");
@@ -217,6 +217,37 @@ BOOST_AUTO_TEST_CASE(type_identifiers)
 	BOOST_CHECK_EQUAL(InaccessibleDynamicType().identifier(), "t_inaccessible");
 }
 
+BOOST_AUTO_TEST_CASE(interning)
+{
+	TypePointer uint8 = TypeProvider::fromElementaryTypeName("uint8");
+	BOOST_CHECK(TypeProvider::mapping(uint8, uint8) == TypeProvider::mapping(uint8, uint8));
+	BOOST_CHECK(TypeProvider::mapping(uint8, uint8) != TypeProvider::mapping(uint8, TypeProvider::boolean()));
+	BOOST_CHECK(TypeProvider::array(DataLocation::Memory, uint8) == TypeProvider::array(DataLocation::Memory, uint8));
+	BOOST_CHECK(TypeProvider::array(DataLocation::Memory, uint8, 2) == TypeProvider::array(DataLocation::Memory, uint8, 2));
+	BOOST_CHECK(TypeProvider::array(DataLocation::Memory, uint8, 2) != TypeProvider::array(DataLocation::Memory, uint8, 3));
+	BOOST_CHECK(TypeProvider::array(DataLocation::Memory, uint8) != TypeProvider::array(DataLocation::Storage, uint8));
+	BOOST_CHECK(TypeProvider::array(DataLocation::Memory, true) != TypeProvider::array(DataLocation::Memory, false));
+	BOOST_CHECK(TypeProvider::tuple({uint8, TypeProvider::boolean()}) == TypeProvider::tuple({uint8, TypeProvider::boolean()}));
+	BOOST_CHECK(TypeProvider::rationalNumber(rational(7)) == TypeProvider::rationalNumber(rational(7)));
+	BOOST_CHECK(
+		TypeProvider::function(strings{"uint8"}, strings{}, FunctionType::Kind::Internal) ==
+		TypeProvider::function(strings{"uint8"}, strings{}, FunctionType::Kind::Internal)
+	);
+	BOOST_CHECK(
+		TypeProvider::function(strings{"uint8"}, strings{}, FunctionType::Kind::Internal) !=
+		TypeProvider::function(strings{"uint8"}, strings{}, FunctionType::Kind::External)
+	);
+
+	ReferenceType const* array = TypeProvider::array(DataLocation::Storage, uint8);
+	BOOST_CHECK(TypeProvider::withLocation(array, DataLocation::Memory, true) == TypeProvider::withLocation(array, DataLocation::Memory, true));
+
+	size_t count = TypeProvider::typeCount();
+	TypeProvider::mapping(uint8, uint8);
+	BOOST_CHECK_EQUAL(TypeProvider::typeCount(), count);
+	TypeProvider::reset();
+	BOOST_CHECK_EQUAL(TypeProvider::typeCount(), 0);
+}
+
 BOOST_AUTO_TEST_CASE(encoded_sizes)
 {
 	BOOST_CHECK_EQUAL(IntegerType(16).calldataEncodedSize(true), 32);
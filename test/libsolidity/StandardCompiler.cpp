@@ -20,6 +20,7 @@
  */
 
 #include <string>
+#include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
 #include <libsolidity/interface/StandardCompiler.h>
 #include <libsolidity/interface/Version.h>
@@ -1363,6 +1364,496 @@ BOOST_AUTO_TEST_CASE(standard_output_selection_wildcard_multiple_sources)
 	BOOST_REQUIRE(result["sources"]["B"].isObject());
 }
 
+BOOST_AUTO_TEST_CASE(parallelism_invalid)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"parallelism": 0
+		},
+		"sources": {
+			"fileA": {
+				"content": "contract A { }"
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsError(result, "JSONError", "\"settings.parallelism\" must be a positive integer."));
+}
+
+BOOST_AUTO_TEST_CASE(parallelism_output_matches_sequential)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"optimizer": { "enabled": true },
+			"outputSelection": {
+				"*": { "*": [ "evm.bytecode", "evm.deployedBytecode", "evm.legacyAssembly", "metadata" ] }
+			}
+		},
+		"sources": {
+			"fileA": {
+				"content": "contract A { uint x; function f(uint a) public { x = a * 7; } }
+					contract B { function g() public returns (address) { return address(new A()); } }
+					abstract contract Base { function h() public returns (address) { return address(new A()); } }"
+			},
+			"fileB": {
+				"content": "import \"fileA\";
+					contract C is Base { function i() public returns (address) { return address(new B()); } }
+					contract D { function j() public pure returns (bytes memory) { return type(B).creationCode; } }
+					contract E { function k(uint a) public pure returns (uint) { return a + 1; } }
+					library L { function l(uint a) public pure returns (uint) { return a * 2; } }"
+			}
+		}
+	}
+	)";
+
+	Json::Value parsedInput;
+	BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+	solidity::frontend::StandardCompiler compiler;
+	Json::Value sequentialResult = compiler.compile(parsedInput);
+	BOOST_REQUIRE(containsAtMostWarnings(sequentialResult));
+	BOOST_REQUIRE(sequentialResult["contracts"]["fileB"]["C"].isObject());
+
+	for (unsigned jobs: {2u, 3u, 8u})
+	{
+		parsedInput["settings"]["parallelism"] = jobs;
+		Json::Value parallelResult = compiler.compile(parsedInput);
+		BOOST_CHECK(util::jsonCompactPrint(parallelResult) == util::jsonCompactPrint(sequentialResult));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(parallelism_smtchecker)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"fileA": {
+				"content": "pragma experimental SMTChecker;
+					contract A {
+						uint x;
+						function f(uint a, uint b) public returns (uint) {
+							x = a + b;
+							assert(x > a);
+							require(b > 0);
+							return a / b - x;
+						}
+						function g(bool c) public pure returns (uint8 y) {
+							y = 255;
+							if (c)
+								y += 1;
+							assert(y == 255);
+						}
+					}"
+			}
+		}
+	}
+	)";
+
+	Json::Value parsedInput;
+	BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+	solidity::frontend::StandardCompiler compiler;
+	Json::Value const sequentialResult = compiler.compile(parsedInput);
+	BOOST_REQUIRE(containsAtMostWarnings(sequentialResult));
+
+	// Counterexamples may differ from sequential checking, but they do not depend on the number of threads.
+	parsedInput["settings"]["parallelism"] = 2;
+	Json::Value const parallelResult = compiler.compile(parsedInput);
+	BOOST_REQUIRE(parallelResult["errors"].size() == sequentialResult["errors"].size());
+	for (Json::ArrayIndex i = 0; i < parallelResult["errors"].size(); ++i)
+	{
+		Json::Value const& parallelError = parallelResult["errors"][i];
+		Json::Value const& sequentialError = sequentialResult["errors"][i];
+		BOOST_CHECK(parallelError["message"] == sequentialError["message"]);
+		BOOST_CHECK(parallelError["sourceLocation"] == sequentialError["sourceLocation"]);
+	}
+	BOOST_CHECK(
+		parallelResult["auxiliaryInputRequested"]["smtlib2queries"].size() ==
+		sequentialResult["auxiliaryInputRequested"]["smtlib2queries"].size()
+	);
+
+	for (unsigned jobs: {3u, 4u, 8u})
+	{
+		parsedInput["settings"]["parallelism"] = jobs;
+		BOOST_CHECK(compiler.compile(parsedInput)["errors"] == parallelResult["errors"]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(yul_function_parallel)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"optimizer": {
+				"enabled": true,
+				"details": { "yulDetails": { "functionParallel": true } }
+			},
+			"outputSelection": {
+				"*": { "*": [ "evm.bytecode", "irOptimized", "metadata" ] }
+			}
+		},
+		"sources": {
+			"fileA": {
+				"content": "contract A {
+						uint x;
+						mapping(uint => uint) m;
+						function f(uint a, uint b) public returns (uint) { x = a * b + x; m[a] = b; return m[b] + a / b; }
+						function g(uint n) public view returns (uint s) { for (uint i = 0; i < n; i++) s += m[i] * 3; }
+						function h(bool c, uint a) public pure returns (uint) { if (c) return a * 4; return a - 1; }
+					}"
+			}
+		}
+	}
+	)";
+
+	Json::Value parsedInput;
+	BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+	solidity::frontend::StandardCompiler compiler;
+	Json::Value const sequentialResult = compiler.compile(parsedInput);
+	BOOST_REQUIRE(containsAtMostWarnings(sequentialResult));
+	Json::Value const& contract = sequentialResult["contracts"]["fileA"]["A"];
+	BOOST_REQUIRE(contract.isObject());
+	BOOST_CHECK(!contract["irOptimized"].asString().empty());
+	BOOST_CHECK(!contract["evm"]["bytecode"]["object"].asString().empty());
+
+	Json::Value metadata;
+	BOOST_REQUIRE(util::jsonParseStrict(contract["metadata"].asString(), metadata));
+	BOOST_CHECK(metadata["settings"]["optimizer"]["details"]["yulDetails"]["functionParallel"].asBool());
+
+	for (unsigned jobs: {2u, 4u})
+	{
+		parsedInput["settings"]["parallelism"] = jobs;
+		Json::Value parallelResult = compiler.compile(parsedInput);
+		BOOST_CHECK(util::jsonCompactPrint(parallelResult) == util::jsonCompactPrint(sequentialResult));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(yul_optimizer_steps)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"optimizer": {
+				"enabled": true,
+				"details": { "yulDetails": { "optimizerSteps": "dhfoDg [xarrscLM] jmul", "maxRounds": 3 } }
+			},
+			"outputSelection": {
+				"*": { "*": [ "evm.bytecode", "metadata" ] }
+			}
+		},
+		"sources": {
+			"fileA": {
+				"content": "pragma experimental ABIEncoderV2; contract A { function f(uint[][] memory a) public pure returns (uint[][] memory) { return a; } }"
+			}
+		}
+	}
+	)";
+
+	Json::Value parsedInput;
+	BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+	solidity::frontend::StandardCompiler compiler;
+	Json::Value result = compiler.compile(parsedInput);
+	BOOST_REQUIRE(containsAtMostWarnings(result));
+	Json::Value const& contract = result["contracts"]["fileA"]["A"];
+	BOOST_CHECK(!contract["evm"]["bytecode"]["object"].asString().empty());
+
+	Json::Value metadata;
+	BOOST_REQUIRE(util::jsonParseStrict(contract["metadata"].asString(), metadata));
+	Json::Value const& yulDetails = metadata["settings"]["optimizer"]["details"]["yulDetails"];
+	BOOST_CHECK_EQUAL(yulDetails["optimizerSteps"].asString(), "dhfoDg [xarrscLM] jmul");
+	BOOST_CHECK_EQUAL(yulDetails["maxRounds"].asUInt(), 3);
+	BOOST_CHECK(!yulDetails.isMember("timeBudget"));
+
+	parsedInput["settings"]["optimizer"]["details"]["yulDetails"]["optimizerSteps"] = "dh[x";
+	result = compiler.compile(parsedInput);
+	BOOST_CHECK(containsError(
+		result,
+		"JSONError",
+		"Invalid optimizer step sequence in \"settings.optimizer.details.yulDetails.optimizerSteps\": "
+		"Unbalanced brackets in the optimisation sequence."
+	));
+
+	parsedInput["settings"]["optimizer"]["details"]["yulDetails"]["optimizerSteps"] = 7;
+	result = compiler.compile(parsedInput);
+	BOOST_CHECK(containsError(result, "JSONError", "\"settings.optimizer.details.yulDetails.optimizerSteps\" must be a string."));
+}
+
+BOOST_AUTO_TEST_CASE(optimizer_profile)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"optimizer": { "enabled": true },
+			"outputSelection": {
+				"fileA": { "A": [ "evm.bytecode.object", "optimizerProfile" ] },
+				"*": { "*": [ "*" ] }
+			}
+		},
+		"sources": {
+			"fileA": {
+				"content": "pragma experimental ABIEncoderV2; contract A { function f(uint[][] memory a) public pure returns (uint[][] memory) { return a; } } contract B {}"
+			}
+		}
+	}
+	)";
+
+	Json::Value parsedInput;
+	BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+	solidity::frontend::StandardCompiler compiler;
+	Json::Value result = compiler.compile(parsedInput);
+	BOOST_REQUIRE(containsAtMostWarnings(result));
+
+	Json::Value const& profile = result["contracts"]["fileA"]["A"]["optimizerProfile"];
+	BOOST_REQUIRE(profile.isArray());
+	set<string> optimisers;
+	set<string> steps;
+	for (Json::Value const& run: profile)
+	{
+		optimisers.insert(run["optimizer"].asString());
+		steps.insert(run["step"].asString());
+		for (string key: {"time", "nodesBefore", "nodesAfter", "sizeBefore", "sizeAfter"})
+			BOOST_CHECK(run[key].isIntegral());
+	}
+	BOOST_CHECK((optimisers == set<string>{"yul", "evmasm"}));
+	BOOST_CHECK(steps.count("CommonSubexpressionEliminator"));
+	BOOST_CHECK(steps.count("FullInliner"));
+	BOOST_CHECK(steps.count("PeepholeOptimiser"));
+
+	// The wildcard does not request the profile.
+	BOOST_CHECK(!result["contracts"]["fileA"]["B"].isMember("optimizerProfile"));
+}
+
+BOOST_AUTO_TEST_CASE(smt_portfolio_invalid)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"smtPortfolio": "fastest"
+		},
+		"sources": {
+			"fileA": {
+				"content": "contract A { }"
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsError(
+		result,
+		"JSONError",
+		"\"settings.smtPortfolio\" must be \"sequential\", \"race\" or \"strictRace\"."
+	));
+}
+
+BOOST_AUTO_TEST_CASE(smt_portfolio_race)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"fileA": {
+				"content": "pragma experimental SMTChecker;
+					contract A {
+						function f(uint a, uint b) public pure returns (uint) {
+							assert(a + b >= a);
+							return a / b;
+						}
+					}"
+			}
+		}
+	}
+	)";
+
+	Json::Value parsedInput;
+	BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+	solidity::frontend::StandardCompiler compiler;
+	Json::Value const sequentialResult = compiler.compile(parsedInput);
+	BOOST_REQUIRE(containsAtMostWarnings(sequentialResult));
+
+	// Counterexamples depend on which solver answers first, the kind and location of the warnings do not.
+	for (string strategy: {"race", "strictRace"})
+	{
+		parsedInput["settings"]["smtPortfolio"] = strategy;
+		Json::Value const result = compiler.compile(parsedInput);
+		BOOST_REQUIRE(result["errors"].size() == sequentialResult["errors"].size());
+		for (Json::ArrayIndex i = 0; i < result["errors"].size(); ++i)
+			BOOST_CHECK(result["errors"][i]["sourceLocation"] == sequentialResult["errors"][i]["sourceLocation"]);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(cache)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"outputSelection": {
+				"*": { "*": [ "evm.bytecode.object" ] }
+			}
+		},
+		"sources": {
+			"fileA": {
+				"content": "import \"lib.sol\"; contract A is L { }"
+			}
+		}
+	}
+	)";
+	Json::Value parsedInput;
+	BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+	map<string, string> files{{"lib.sol", "contract L { }"}};
+	ReadCallback::Callback readFile = [&](string const& _kind, string const& _path) -> ReadCallback::Result
+	{
+		if (_kind == ReadCallback::kindString(ReadCallback::Kind::ReadFile) && files.count(_path))
+			return {true, files[_path]};
+		return {false, "File not found."};
+	};
+	boost::filesystem::path directory =
+		boost::filesystem::temp_directory_path() /
+		boost::filesystem::unique_path("solidity-cache-test-%%%%-%%%%-%%%%");
+
+	solidity::frontend::StandardCompiler compiler(readFile);
+	compiler.setCacheDirectory(directory);
+	Json::Value result = compiler.compile(parsedInput);
+	BOOST_REQUIRE(containsAtMostWarnings(result));
+	BOOST_CHECK_EQUAL(result["cache"]["hits"].asUInt(), 0);
+	BOOST_CHECK_EQUAL(result["cache"]["misses"].asUInt(), 1);
+	Json::Value contracts = result["contracts"];
+	BOOST_REQUIRE(contracts["fileA"]["A"]["evm"]["bytecode"]["object"].isString());
+
+	result = compiler.compile(parsedInput);
+	BOOST_CHECK_EQUAL(result["cache"]["hits"].asUInt(), 1);
+	BOOST_CHECK_EQUAL(result["cache"]["misses"].asUInt(), 1);
+	BOOST_CHECK(result["contracts"] == contracts);
+
+	// Entries are shared by all compilers using the same directory.
+	solidity::frontend::StandardCompiler otherCompiler(readFile);
+	otherCompiler.setCacheDirectory(directory);
+	result = otherCompiler.compile(parsedInput);
+	BOOST_CHECK_EQUAL(result["cache"]["hits"].asUInt(), 1);
+	BOOST_CHECK_EQUAL(result["cache"]["misses"].asUInt(), 0);
+	BOOST_CHECK(result["contracts"] == contracts);
+
+	// Changing an imported file invalidates the entry.
+	files["lib.sol"] = "contract L { function f() public { } }";
+	result = compiler.compile(parsedInput);
+	BOOST_CHECK_EQUAL(result["cache"]["hits"].asUInt(), 1);
+	BOOST_CHECK_EQUAL(result["cache"]["misses"].asUInt(), 2);
+	BOOST_CHECK(result["contracts"] != contracts);
+
+	// Failed compilations are not cached.
+	files.erase("lib.sol");
+	result = compiler.compile(parsedInput);
+	BOOST_CHECK(!containsAtMostWarnings(result));
+	result = compiler.compile(parsedInput);
+	BOOST_CHECK_EQUAL(result["cache"]["hits"].asUInt(), 1);
+	BOOST_CHECK_EQUAL(result["cache"]["misses"].asUInt(), 4);
+
+	boost::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_CASE(smt_query_cache)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"fileA": {
+				"content": "pragma experimental SMTChecker;
+					contract A {
+						function f(uint8 a) public pure {
+							uint8 b = a / 2;
+							assert(b <= a);
+						}
+					}"
+			}
+		}
+	}
+	)";
+	Json::Value parsedInput;
+	BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+	// Answers all SMT queries, unless disabled.
+	bool answerQueries = true;
+	size_t queries = 0;
+	ReadCallback::Callback smtCallback = [&](string const& _kind, string const&) -> ReadCallback::Result
+	{
+		if (_kind != ReadCallback::kindString(ReadCallback::Kind::SMTQuery) || !answerQueries)
+			return {false, "Not answered."};
+		++queries;
+		return {true, "unsat\n"};
+	};
+	boost::filesystem::path directory =
+		boost::filesystem::temp_directory_path() /
+		boost::filesystem::unique_path("solidity-smt-cache-test-%%%%-%%%%-%%%%");
+
+	solidity::frontend::StandardCompiler compiler(smtCallback);
+	compiler.setSMTQueryCacheDirectory(directory);
+	Json::Value result = compiler.compile(parsedInput);
+	BOOST_REQUIRE(containsAtMostWarnings(result));
+	BOOST_CHECK_EQUAL(result["smtQueryCache"]["hits"].asUInt(), 0);
+	BOOST_CHECK(queries > 0);
+	BOOST_CHECK_EQUAL(result["smtQueryCache"]["misses"].asUInt(), queries);
+	Json::Value errors = result["errors"];
+
+	// A new compiler answers the same queries from the cache directory.
+	answerQueries = false;
+	solidity::frontend::StandardCompiler otherCompiler(smtCallback);
+	otherCompiler.setSMTQueryCacheDirectory(directory);
+	result = otherCompiler.compile(parsedInput);
+	BOOST_CHECK(result["smtQueryCache"]["hits"].asUInt() > 0);
+	BOOST_CHECK(result["errors"] == errors);
+	BOOST_CHECK(!result.isMember("auxiliaryInputRequested"));
+
+	boost::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_CASE(cache_in_memory)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"fileA": {
+				"content": "contract A { }"
+			}
+		}
+	}
+	)";
+	Json::Value parsedInput;
+	BOOST_REQUIRE(util::jsonParseStrict(input, parsedInput));
+
+	solidity::frontend::StandardCompiler compiler;
+	compiler.enableCache();
+	Json::Value result = compiler.compile(parsedInput);
+	BOOST_REQUIRE(containsAtMostWarnings(result));
+	BOOST_CHECK_EQUAL(result["cache"]["misses"].asUInt(), 1);
+	Json::Value sources = result["sources"];
+
+	result = compiler.compile(parsedInput);
+	BOOST_CHECK_EQUAL(result["cache"]["hits"].asUInt(), 1);
+	BOOST_CHECK(result["sources"] == sources);
+
+	parsedInput["sources"]["fileA"]["content"] = "contract B { }";
+	result = compiler.compile(parsedInput);
+	BOOST_CHECK_EQUAL(result["cache"]["hits"].asUInt(), 1);
+	BOOST_CHECK_EQUAL(result["cache"]["misses"].asUInt(), 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -101,8 +101,8 @@ void SyntaxTest::filterObtainedErrors()
 				locationStart = location->start - versionPragma.size();
 			if (location->end >= static_cast<int>(versionPragma.size()))
 				locationEnd = location->end - versionPragma.size();
-			if (location->source)
-				sourceName = location->source->name();
+			if (location->hasSource())
+				sourceName = location->sourceName();
 		}
 		m_errorList.emplace_back(SyntaxTestError{
 			currentError->typeName(),
@@ -0,0 +1,134 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the checkpoints of InvertibleMap.
+ */
+
+#include <libsolutil/InvertibleMap.h>
+
+#include <test/Common.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+
+namespace solidity::util::test
+{
+
+namespace
+{
+
+/// Joins the way InvertibleMap did before checkpoints were introduced.
+void joinWithCopy(InvertibleMap<int, int>& _this, InvertibleMap<int, int> const& _older)
+{
+	set<int> keysToErase;
+	for (auto const& item: _this.values)
+	{
+		auto it = _older.values.find(item.first);
+		if (it == _older.values.end() || it->second != item.second)
+			keysToErase.insert(item.first);
+	}
+	for (auto const& key: keysToErase)
+		_this.eraseKey(key);
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(InvertibleMapTest)
+
+BOOST_AUTO_TEST_CASE(join_without_changes)
+{
+	InvertibleMap<int, int> m;
+	m.set(1, 10);
+	m.set(2, 20);
+	size_t checkpoint = m.checkpoint();
+	m.joinWithCheckpoint(checkpoint);
+	BOOST_CHECK((m.values == map<int, int>{{1, 10}, {2, 20}}));
+	BOOST_CHECK((m.references.at(10) == set<int>{1}));
+}
+
+BOOST_AUTO_TEST_CASE(join_removes_changed_and_new_keys)
+{
+	InvertibleMap<int, int> m;
+	m.set(1, 10);
+	m.set(2, 20);
+	m.set(3, 30);
+	size_t checkpoint = m.checkpoint();
+	m.set(1, 11);
+	m.set(4, 40);
+	m.eraseKey(3);
+	// Changed back to the value at the checkpoint.
+	m.set(2, 21);
+	m.set(2, 20);
+	m.joinWithCheckpoint(checkpoint);
+	BOOST_CHECK((m.values == map<int, int>{{2, 20}}));
+	BOOST_CHECK(m.references[11].empty());
+	BOOST_CHECK(m.references[40].empty());
+}
+
+BOOST_AUTO_TEST_CASE(nested_checkpoints)
+{
+	InvertibleMap<int, int> m;
+	m.set(1, 10);
+	m.set(2, 20);
+	m.set(3, 30);
+	size_t outer = m.checkpoint();
+	m.set(5, 50);
+	size_t inner = m.checkpoint();
+	m.set(1, 11);
+	m.eraseValue(30);
+	m.joinWithCheckpoint(inner);
+	BOOST_CHECK((m.values == map<int, int>{{2, 20}, {5, 50}}));
+	m.joinWithCheckpoint(outer);
+	BOOST_CHECK((m.values == map<int, int>{{2, 20}}));
+}
+
+BOOST_AUTO_TEST_CASE(same_as_join_with_copy)
+{
+	InvertibleMap<int, int> m;
+	for (int i = 0; i < 20; ++i)
+		m.set(i, i % 7);
+	for (int round = 0; round < 10; ++round)
+	{
+		InvertibleMap<int, int> copy = m;
+		InvertibleMap<int, int> older = m;
+		size_t checkpoint = m.checkpoint();
+		for (int i = 0; i < 30; ++i)
+		{
+			int key = (i * 7 + round * 3) % 25;
+			InvertibleMap<int, int>* maps[] = {&m, &copy};
+			for (InvertibleMap<int, int>* map: maps)
+				switch ((i + round) % 5)
+				{
+				case 0: map->set(key, (key + round) % 7); break;
+				case 1: map->eraseKey(key); break;
+				case 2: map->eraseValue(key % 7); break;
+				case 3: if (i == 17) map->clear(); break;
+				default: map->set(key, key % 7); break;
+				}
+		}
+		m.joinWithCheckpoint(checkpoint);
+		joinWithCopy(copy, older);
+		BOOST_CHECK(m.values == copy.values);
+		for (auto const& [key, value]: m.values)
+			BOOST_CHECK(m.references[value].count(key));
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
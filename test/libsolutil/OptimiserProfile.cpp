@@ -0,0 +1,113 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the optimiser profile.
+ */
+
+#include <libsolutil/OptimiserProfile.h>
+
+#include <test/Common.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <stdexcept>
+#include <thread>
+
+using namespace std;
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(OptimiserProfileTest)
+
+BOOST_AUTO_TEST_CASE(no_profile)
+{
+	BOOST_CHECK(!OptimiserProfile::current());
+	size_t measurements = 0;
+	{
+		OptimiserProfile::Recorder recorder("yul", "Step", [&]() { return OptimiserProfile::CodeSize{++measurements, 0}; });
+	}
+	BOOST_CHECK_EQUAL(measurements, 0);
+}
+
+BOOST_AUTO_TEST_CASE(record_step_runs)
+{
+	OptimiserProfile profile;
+	size_t nodes = 10;
+	{
+		OptimiserProfile::Scope scope(&profile);
+		BOOST_CHECK_EQUAL(OptimiserProfile::current(), &profile);
+		{
+			OptimiserProfile::Recorder recorder("yul", "First", [&]() { return OptimiserProfile::CodeSize{nodes, 2 * nodes}; });
+			nodes = 7;
+		}
+		{
+			OptimiserProfile::Scope innerScope(nullptr);
+			OptimiserProfile::Recorder recorder("yul", "Unrecorded", [&]() { return OptimiserProfile::CodeSize{nodes, nodes}; });
+		}
+		OptimiserProfile::Recorder recorder("evmasm", "Second", [&]() { return OptimiserProfile::CodeSize{nodes, nodes}; });
+	}
+	BOOST_CHECK(!OptimiserProfile::current());
+
+	vector<OptimiserProfile::StepRun> runs = profile.stepRuns();
+	BOOST_REQUIRE_EQUAL(runs.size(), 2);
+	BOOST_CHECK_EQUAL(runs[0].optimiser, "yul");
+	BOOST_CHECK_EQUAL(runs[0].step, "First");
+	BOOST_CHECK_EQUAL(runs[0].before.nodes, 10);
+	BOOST_CHECK_EQUAL(runs[0].before.size, 20);
+	BOOST_CHECK_EQUAL(runs[0].after.nodes, 7);
+	BOOST_CHECK_EQUAL(runs[0].after.size, 14);
+	BOOST_CHECK_EQUAL(runs[1].optimiser, "evmasm");
+	BOOST_CHECK_EQUAL(runs[1].step, "Second");
+
+	Json::Value json = profile.toJson();
+	BOOST_REQUIRE(json.isArray());
+	BOOST_REQUIRE_EQUAL(json.size(), 2);
+	BOOST_CHECK_EQUAL(json[0]["step"].asString(), "First");
+	BOOST_CHECK_EQUAL(json[0]["nodesBefore"].asUInt(), 10);
+	BOOST_CHECK_EQUAL(json[0]["sizeAfter"].asUInt(), 14);
+	BOOST_CHECK(json[1]["time"].isIntegral());
+}
+
+BOOST_AUTO_TEST_CASE(failed_step)
+{
+	OptimiserProfile profile;
+	OptimiserProfile::Scope scope(&profile);
+	BOOST_CHECK_THROW(
+		{
+			OptimiserProfile::Recorder recorder("yul", "Failing", []() { return OptimiserProfile::CodeSize{}; });
+			throw runtime_error("Step failed.");
+		},
+		runtime_error
+	);
+	BOOST_CHECK(profile.stepRuns().empty());
+}
+
+BOOST_AUTO_TEST_CASE(scope_is_per_thread)
+{
+	OptimiserProfile profile;
+	OptimiserProfile::Scope scope(&profile);
+	OptimiserProfile const* workerProfile = &profile;
+	thread worker([&]() { workerProfile = OptimiserProfile::current(); });
+	worker.join();
+	BOOST_CHECK(!workerProfile);
+	BOOST_CHECK_EQUAL(OptimiserProfile::current(), &profile);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -194,6 +194,64 @@ BOOST_AUTO_TEST_CASE(invalid_param_rendered)
 	BOOST_CHECK_EQUAL(m.render(), templ);
 }
 
+BOOST_AUTO_TEST_CASE(first_closing_tag)
+{
+	string templ = "<#b>[<x>]</b>-</b>";
+	vector<map<string, string>> list(2);
+	list[0]["x"] = "1";
+	list[1]["x"] = "2";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("b", list).render(), "[1][2]-</b>");
+	BOOST_CHECK_EQUAL(Whiskers("<?c>a<!c>b<!c>c</c>")("c", false).render(), "b<!c>c");
+}
+
+BOOST_AUTO_TEST_CASE(unclosed_tags)
+{
+	BOOST_CHECK_EQUAL(Whiskers("a <#l><x> <!c></c>")("x", "X").render(), "a <#l>X <!c></c>");
+	BOOST_CHECK_EQUAL(Whiskers("<?c>a<#l>b")("l", vector<Whiskers::StringMap>{}).render(), "<?c>a<#l>b");
+	BOOST_CHECK_EQUAL(Whiskers("<<a>>< a><#>")("a", "A").render(), "<A>< a><#>");
+}
+
+BOOST_AUTO_TEST_CASE(condition_in_list)
+{
+	string templ = "<#l><?c><x><!c>-</c></l>";
+	vector<map<string, string>> list(2);
+	list[0]["x"] = "1";
+	list[1]["x"] = "2";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("c", true)("l", list).render(), "12");
+	BOOST_CHECK_EQUAL(Whiskers(templ)("c", false)("l", list).render(), "--");
+}
+
+BOOST_AUTO_TEST_CASE(nested_list)
+{
+	string templ = "<#a><#b></b></a>";
+	Whiskers m(templ);
+	m("a", vector<Whiskers::StringMap>(1));
+	m("b", vector<Whiskers::StringMap>(1));
+	BOOST_CHECK_THROW(m.render(), WhiskersError);
+}
+
+BOOST_AUTO_TEST_CASE(missing_value_in_list)
+{
+	string templ = "<#l><x><y></l>";
+	vector<map<string, string>> list(1);
+	list[0]["x"] = "1";
+	Whiskers m(templ);
+	m("l", list);
+	BOOST_CHECK_THROW(m.render(), WhiskersError);
+}
+
+BOOST_AUTO_TEST_CASE(repeated_render)
+{
+	string templ = "<a><?c>+<!c>-</c>";
+	for (size_t i = 0; i < 3; ++i)
+	{
+		BOOST_CHECK_EQUAL(Whiskers(templ)("a", to_string(i))("c", i % 2 == 0).render(), to_string(i) + (i % 2 == 0 ? "+" : "-"));
+		Whiskers m(templ);
+		m("a", "A");
+		BOOST_CHECK_THROW(m.render(), WhiskersError);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
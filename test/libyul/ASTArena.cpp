@@ -0,0 +1,153 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the arena of Yul AST nodes.
+ */
+
+#include <test/libyul/Common.h>
+
+#include <libyul/ASTArena.h>
+#include <libyul/AsmData.h>
+#include <libyul/AsmPrinter.h>
+#include <libyul/optimiser/ASTCopier.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+string const source = R"({
+	function f(a, b) -> c {
+		for { let i := 0 } lt(i, a) { i := add(i, 1) } { c := add(c, mload(i)) }
+		switch b case 0 { c := 1 } default { revert(0, 0) }
+	}
+	sstore(0, f(calldataload(0), calldataload(32)))
+})";
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulASTArena)
+
+BOOST_AUTO_TEST_CASE(heap_without_scope)
+{
+	ASTArena arena;
+	ASTNodePtr<Expression> node = makeASTNode<Expression>(Identifier{{}, "x"_yulstring});
+	ASTVector<Expression> list = makeASTVector<Expression>(Identifier{{}, "y"_yulstring});
+	BOOST_CHECK_EQUAL(arena.chunkCount(), 0);
+	BOOST_CHECK(std::get<Identifier>(*node).name == "x"_yulstring);
+	BOOST_CHECK(std::get<Identifier>(list.front()).name == "y"_yulstring);
+}
+
+BOOST_AUTO_TEST_CASE(scopes)
+{
+	ASTArena outer;
+	ASTArena inner;
+	{
+		ASTArena::Scope outerScope(outer);
+		auto first = makeASTNode<Expression>(Identifier{{}, "x"_yulstring});
+		BOOST_CHECK_EQUAL(outer.chunkCount(), 1);
+		{
+			ASTArena::Scope innerScope(inner);
+			auto second = makeASTNode<Expression>(Identifier{{}, "y"_yulstring});
+			BOOST_CHECK_EQUAL(inner.chunkCount(), 1);
+		}
+		auto third = makeASTNode<Expression>(Identifier{{}, "z"_yulstring});
+		BOOST_CHECK_EQUAL(outer.chunkCount(), 1);
+	}
+	auto fourth = makeASTNode<Expression>(Identifier{{}, "w"_yulstring});
+	BOOST_CHECK_EQUAL(outer.chunkCount(), 1);
+	BOOST_CHECK_EQUAL(inner.chunkCount(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(reuse_freed_memory)
+{
+	ASTArena arena;
+	ASTArena::Scope scope(arena);
+	auto node = makeASTNode<Expression>(Identifier{{}, "x"_yulstring});
+	Expression const* address = node.get();
+	node.reset();
+	node = makeASTNode<Expression>(Identifier{{}, "y"_yulstring});
+	BOOST_CHECK(node.get() == address);
+	BOOST_CHECK(std::get<Identifier>(*node).name == "y"_yulstring);
+}
+
+BOOST_AUTO_TEST_CASE(large_lists_and_many_nodes)
+{
+	ASTArena arena;
+	ASTArena::Scope scope(arena);
+	ASTVector<Expression> list;
+	for (size_t i = 0; i < 10000; ++i)
+		list.emplace_back(Literal{{}, LiteralKind::Number, YulString{to_string(i)}, {}});
+	vector<ASTNodePtr<Expression>> nodes;
+	for (size_t i = 0; i < 10000; ++i)
+		nodes.emplace_back(makeASTNode<Expression>(Identifier{{}, "x"_yulstring}));
+	BOOST_CHECK(arena.chunkCount() > 1);
+	BOOST_CHECK(std::get<Literal>(list.back()).value == "9999"_yulstring);
+	BOOST_CHECK(std::get<Identifier>(*nodes.back()).name == "x"_yulstring);
+}
+
+BOOST_AUTO_TEST_CASE(clone_outlives_arena)
+{
+	shared_ptr<Block> ast = parse(source, false).first;
+	BOOST_REQUIRE(ast);
+	string const expectation = AsmPrinter{}(*ast);
+
+	Block copy;
+	{
+		ASTArena arena;
+		copy = ASTCopier::clone(*ast, arena);
+		BOOST_CHECK(arena.chunkCount() > 0);
+	}
+	ast.reset();
+	BOOST_CHECK_EQUAL(AsmPrinter{}(copy), expectation);
+
+	// Nodes from different arenas can be mixed.
+	ASTArena other;
+	Block second = ASTCopier::clone(copy, other);
+	second.statements.emplace_back(std::move(copy.statements.front()));
+	copy.statements.clear();
+	BOOST_CHECK_EQUAL(second.statements.size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(free_in_other_thread)
+{
+	shared_ptr<Block> ast = parse(source, false).first;
+	BOOST_REQUIRE(ast);
+	ASTArena arena;
+	auto copy = make_unique<Block>(ASTCopier::clone(*ast, arena));
+	string const expectation = AsmPrinter{}(*copy);
+	string printed;
+	thread([&]() {
+		printed = AsmPrinter{}(*copy);
+		copy.reset();
+	}).join();
+	BOOST_CHECK_EQUAL(printed, expectation);
+	BOOST_CHECK(!copy);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
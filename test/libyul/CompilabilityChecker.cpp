@@ -34,17 +34,66 @@ namespace solidity::yul::test
 
 namespace
 {
+string format(map<YulString, int> const& _functions)
+{
+	string out;
+	for (auto const& function: _functions)
+		out += function.first.str() + ": " + to_string(function.second) + " ";
+	return out;
+}
+
 string check(string const& _input)
 {
 	Object obj;
 	std::tie(obj.code, obj.analysisInfo) = yul::test::parse(_input, false);
 	BOOST_REQUIRE(obj.code);
-	map<YulString, int> functions = CompilabilityChecker::run(EVMDialect::strictAssemblyForEVM(solidity::test::CommonOptions::get().evmVersion()), obj, true);
-	string out;
-	for (auto const& function: functions)
-		out += function.first.str() + ": " + to_string(function.second) + " ";
+	return format(CompilabilityChecker::run(EVMDialect::strictAssemblyForEVM(solidity::test::CommonOptions::get().evmVersion()), obj, true));
+}
+
+/// Checks the code (which has to be grouped) incrementally after checking @a _previous
+/// with the same checker and compares the result with the one of the CompilabilityChecker.
+string checkIncremental(string const& _input, string const& _previous = "{ {} }")
+{
+	Dialect const& dialect = EVMDialect::strictAssemblyForEVM(solidity::test::CommonOptions::get().evmVersion());
+	IncrementalCompilabilityChecker checker(dialect, true);
+	Object previous;
+	std::tie(previous.code, previous.analysisInfo) = yul::test::parse(_previous, false);
+	BOOST_REQUIRE(previous.code);
+	BOOST_CHECK_EQUAL(format(checker.run(previous)), format(CompilabilityChecker::run(dialect, previous, true)));
+
+	Object obj;
+	std::tie(obj.code, obj.analysisInfo) = yul::test::parse(_input, false);
+	BOOST_REQUIRE(obj.code);
+	string out = format(checker.run(obj));
+	BOOST_CHECK_EQUAL(out, format(CompilabilityChecker::run(dialect, obj, true)));
+	for (auto const& function: CompilabilityChecker::run(dialect, obj, true))
+		BOOST_CHECK_EQUAL(checker.stackSurplus(function.first), function.second);
+	// Running it again only uses cached results.
+	BOOST_CHECK_EQUAL(format(checker.run(obj)), out);
 	return out;
 }
+
+string const manyVariables = R"(
+	let r1 := 0
+	let r2 := 0
+	let r3 := 0
+	let r4 := 0
+	let r5 := 0
+	let r6 := 0
+	let r7 := 0
+	let r8 := 0
+	let r9 := 0
+	let r10 := 0
+	let r11 := 0
+	let r12 := 0
+	let r13 := 0
+	let r14 := 0
+	let r15 := 0
+	let r16 := 0
+	let r17 := 0
+	let r18 := 0
+	x := add(add(add(add(add(add(add(add(add(add(add(add(x, r12), r11), r10), r9), r8), r7), r6), r5), r4), r3), r2), r1)
+)";
 }
 
 BOOST_AUTO_TEST_SUITE(CompilabilityChecker)
@@ -219,6 +268,59 @@ BOOST_AUTO_TEST_CASE(also_in_outer_block)
 	BOOST_CHECK_EQUAL(out, ": 9 ");
 }
 
+BOOST_AUTO_TEST_CASE(incremental_multiple_functions)
+{
+	string out = checkIncremental(R"({
+		{ }
+		function f(a, b) -> r1, r2, r3, r4, r5, r6, r7, r8, r9, r10, r11, r12, r13, r14, r15, r16, r17, r18, r19 {
+		}
+		function g(r1, r2, r3, r4, r5, r6, r7, r8, r9, r10, r11, r12, r13, r14, r15, r16, r17, r18, r19) -> x, y {
+		}
+		function h(x) {)" + manyVariables + R"(
+		}
+		function i(x) -> y { y := x }
+	})");
+	BOOST_CHECK_EQUAL(out, "h: 9 g: 5 f: 5 ");
+}
+
+BOOST_AUTO_TEST_CASE(incremental_main_block)
+{
+	// A stack error in the main block prevents the functions from being checked.
+	string out = checkIncremental(R"({
+		{
+			let x := 0)" + manyVariables + R"(
+		}
+		function g(s1, s2, s3, s4, s5, s6, s7, s8, s9, s10, s11, s12, s13, s14, s15, s16, s17, s18, s19) -> w, v {
+		}
+	})");
+	BOOST_CHECK_EQUAL(out, ": 9 ");
+}
+
+BOOST_AUTO_TEST_CASE(incremental_changed_functions)
+{
+	string previous = R"({
+		{ let a := f(1) }
+		function f(x) -> y {)" + manyVariables + R"(
+			y := x
+		}
+		function g(x) -> y {)" + manyVariables + R"(
+			y := h(x)
+		}
+		function h(x) -> y { y := x }
+	})";
+	BOOST_CHECK_EQUAL(checkIncremental(previous, previous), "g: 10 f: 10 ");
+	// f is fixed and the signature of h, which is called by g, changes.
+	string out = checkIncremental(R"({
+		{ let a := f(1) }
+		function f(x) -> y { y := x }
+		function g(x) -> y {)" + manyVariables + R"(
+			y := h(x, x)
+		}
+		function h(x, z) -> y { y := x }
+	})", previous);
+	BOOST_CHECK_EQUAL(out, "g: 10 ");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
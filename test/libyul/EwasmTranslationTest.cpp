@@ -17,6 +17,7 @@
 
 #include <test/libyul/EwasmTranslationTest.h>
 
+#include <test/tools/yulInterpreter/CompiledInterpreter.h>
 #include <test/tools/yulInterpreter/Interpreter.h>
 
 #include <test/Common.h>
@@ -81,6 +82,15 @@ TestCase::TestResult EwasmTranslationTest::run(ostream& _stream, string const& _
 		printIndented(_stream, m_obtainedResult, nextIndentLevel);
 		return TestResult::Failure;
 	}
+
+	string compiledResult = interpret(true);
+	if (compiledResult != m_obtainedResult)
+	{
+		string nextIndentLevel = _linePrefix + "  ";
+		AnsiColorized(_stream, _formatted, {formatting::BOLD, formatting::CYAN}) << _linePrefix << "Result of the compiled interpreter:" << endl;
+		printIndented(_stream, compiledResult, nextIndentLevel);
+		return TestResult::Failure;
+	}
 	return TestResult::Success;
 }
 
@@ -122,16 +132,18 @@ bool EwasmTranslationTest::parse(ostream& _stream, string const& _linePrefix, bo
 	}
 }
 
-string EwasmTranslationTest::interpret()
+string EwasmTranslationTest::interpret(bool _compiled)
 {
 	InterpreterState state;
 	state.maxTraceSize = 10000;
 	state.maxSteps = 100000;
 	WasmDialect dialect;
-	Interpreter interpreter(state, dialect);
 	try
 	{
-		interpreter(*m_object->code);
+		if (_compiled)
+			CompiledInterpreter(dialect, *m_object->code).run(state);
+		else
+			Interpreter(state, dialect)(*m_object->code);
 	}
 	catch (InterpreterTerminatedGeneric const&)
 	{
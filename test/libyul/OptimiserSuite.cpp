@@ -0,0 +1,185 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the optimiser suite.
+ */
+
+#include <test/Common.h>
+
+#include <test/libyul/Common.h>
+
+#include <libyul/optimiser/Suite.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/backends/evm/EVMMetrics.h>
+#include <libyul/AsmPrinter.h>
+#include <libyul/Exceptions.h>
+#include <libyul/Object.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+
+using namespace std;
+using namespace solidity::langutil;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+string const source = R"({
+	function f(a) -> r {
+		let x := mload(a)
+		for {} lt(x, 10) { x := add(x, 1) } { sstore(x, mload(add(x, a))) }
+		r := add(x, f(sub(a, 1)))
+	}
+	function g(a) -> r {
+		let x := mload(a)
+		for {} lt(x, 20) { x := add(x, 2) } { sstore(mload(x), mload(add(x, a))) }
+		r := add(x, g(sub(a, 2)))
+	}
+	function h(a, b) -> r {
+		switch a
+		case 0 { r := calldataload(b) }
+		default { r := add(mul(b, 3), a) }
+	}
+	sstore(f(calldataload(0)), g(h(calldataload(1), 7)))
+})";
+
+pair<string, OptimiserSuite::Statistics> optimise(
+	bool _functionParallel,
+	unsigned _threads,
+	string const& _sequence = {},
+	size_t _maxRounds = OptimiserSuite::DefaultMaxRounds,
+	chrono::milliseconds _timeBudget = chrono::milliseconds::zero(),
+	string const& _source = source
+)
+{
+	EVMDialect const& dialect = EVMDialect::strictAssemblyForEVM(solidity::test::CommonOptions::get().evmVersion());
+	Object object;
+	tie(object.code, object.analysisInfo) = parse(_source, false);
+	BOOST_REQUIRE(object.code && object.analysisInfo);
+	GasMeter meter(dialect, false, 200);
+	OptimiserSuite::Statistics statistics = OptimiserSuite::run(
+		dialect,
+		&meter,
+		object,
+		true,
+		{},
+		_functionParallel,
+		_threads,
+		_sequence,
+		_maxRounds,
+		_timeBudget
+	);
+	return {AsmPrinter{dialect}(*object.code), statistics};
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulOptimiserSuite)
+
+BOOST_AUTO_TEST_CASE(unchanged_code_is_skipped)
+{
+	auto [code, statistics] = optimise(false, 1);
+	BOOST_CHECK(!code.empty());
+	BOOST_CHECK(statistics.rounds > 0);
+	BOOST_CHECK(statistics.skippedStepRuns > 0);
+	BOOST_CHECK(statistics.skippedStepRuns < statistics.stepRuns);
+}
+
+BOOST_AUTO_TEST_CASE(function_parallel)
+{
+	auto [sequentialCode, sequentialStatistics] = optimise(true, 1);
+	BOOST_CHECK(sequentialStatistics.skippedStepRuns > 0);
+	BOOST_CHECK(sequentialStatistics.skippedStepRuns < sequentialStatistics.stepRuns);
+	for (unsigned threads: {2u, 4u})
+	{
+		auto [parallelCode, parallelStatistics] = optimise(true, threads);
+		BOOST_CHECK_EQUAL(parallelCode, sequentialCode);
+		BOOST_CHECK_EQUAL(parallelStatistics.stepRuns, sequentialStatistics.stepRuns);
+		BOOST_CHECK_EQUAL(parallelStatistics.skippedStepRuns, sequentialStatistics.skippedStepRuns);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(custom_sequence)
+{
+	auto [defaultCode, defaultStatistics] = optimise(false, 1);
+	auto [code, statistics] = optimise(false, 1, "dhfoDg [xarrscLM] jmul", 2);
+	BOOST_CHECK(!code.empty());
+	BOOST_CHECK(code != defaultCode);
+	BOOST_CHECK(statistics.rounds > 0);
+	BOOST_CHECK(statistics.rounds <= 2);
+	BOOST_CHECK(statistics.stepRuns < defaultStatistics.stepRuns);
+	BOOST_CHECK(!statistics.outOfTime);
+}
+
+BOOST_AUTO_TEST_CASE(max_rounds)
+{
+	auto [code, statistics] = optimise(false, 1, {}, 0);
+	BOOST_CHECK(!code.empty());
+	BOOST_CHECK_EQUAL(statistics.rounds, 0);
+	BOOST_CHECK_EQUAL(optimise(false, 1, {}, 1).second.rounds, 1);
+}
+
+BOOST_AUTO_TEST_CASE(time_budget)
+{
+	auto [defaultCode, defaultStatistics] = optimise(false, 1);
+	auto [code, statistics] = optimise(false, 1, {}, OptimiserSuite::DefaultMaxRounds, chrono::milliseconds(1));
+	// The result is valid code in any case, but how much is optimised depends on the machine.
+	BOOST_CHECK(!code.empty());
+	if (statistics.outOfTime)
+		BOOST_CHECK(statistics.stepRuns < defaultStatistics.stepRuns);
+	else
+		BOOST_CHECK_EQUAL(code, defaultCode);
+}
+
+BOOST_AUTO_TEST_CASE(time_budget_exhausted_before_prerequisites)
+{
+	// Large enough that the budget is used up before the steps that establish
+	// the properties needed by the code generation steps would be run.
+	string largeSource = "{\n";
+	for (size_t i = 0; i < 3000; ++i)
+	{
+		string const name = "f" + to_string(i);
+		largeSource +=
+			"function " + name + "(a) -> r {\n"
+			"for { let k := 0 } lt(k, a) { k := add(k, 1) } { sstore(k, " + name + "(k)) }\n"
+			"}\n";
+	}
+	largeSource += "sstore(0, f0(calldataload(0)))\n}";
+
+	for (string sequence: {"", "dhfoDg [xarrscLM] jmul"})
+	{
+		auto [code, statistics] = optimise(false, 1, sequence, OptimiserSuite::DefaultMaxRounds, chrono::milliseconds(1), largeSource);
+		BOOST_CHECK(!code.empty());
+		BOOST_CHECK(statistics.outOfTime);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(sequence_validation)
+{
+	for (string sequence: vector<string>{"", "x a", "dhfoDg\n[xarrscLM]\njmul", OptimiserSuite::DefaultOptimiserSteps})
+		BOOST_CHECK_NO_THROW(OptimiserSuite::validateSequence(sequence));
+	for (string sequence: {"xZ", "[x", "x]", "[[x]]", "[x][a]", "x,a"})
+		BOOST_CHECK_THROW(OptimiserSuite::validateSequence(sequence), OptimizerException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
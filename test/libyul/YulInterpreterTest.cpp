@@ -17,6 +17,7 @@
 
 #include <test/libyul/YulInterpreterTest.h>
 
+#include <test/tools/yulInterpreter/CompiledInterpreter.h>
 #include <test/tools/yulInterpreter/Interpreter.h>
 
 #include <test/Common.h>
@@ -69,6 +70,15 @@ TestCase::TestResult YulInterpreterTest::run(ostream& _stream, string const& _li
 		printIndented(_stream, m_obtainedResult, nextIndentLevel);
 		return TestResult::Failure;
 	}
+
+	string compiledResult = interpret(true);
+	if (compiledResult != m_obtainedResult)
+	{
+		string nextIndentLevel = _linePrefix + "  ";
+		AnsiColorized(_stream, _formatted, {formatting::BOLD, formatting::CYAN}) << _linePrefix << "Result of the compiled interpreter:" << endl;
+		printIndented(_stream, compiledResult, nextIndentLevel);
+		return TestResult::Failure;
+	}
 	return TestResult::Success;
 }
 
@@ -111,15 +121,18 @@ bool YulInterpreterTest::parse(ostream& _stream, string const& _linePrefix, bool
 	}
 }
 
-string YulInterpreterTest::interpret()
+string YulInterpreterTest::interpret(bool _compiled)
 {
 	InterpreterState state;
 	state.maxTraceSize = 10000;
 	state.maxSteps = 10000;
-	Interpreter interpreter(state, EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion{}));
+	Dialect const& dialect = EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion{});
 	try
 	{
-		interpreter(*m_ast);
+		if (_compiled)
+			CompiledInterpreter(dialect, *m_ast).run(state);
+		else
+			Interpreter(state, dialect)(*m_ast);
 	}
 	catch (InterpreterTerminatedGeneric const&)
 	{
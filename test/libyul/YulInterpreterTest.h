@@ -53,7 +53,8 @@ public:
 private:
 	void printIndented(std::ostream& _stream, std::string const& _output, std::string const& _linePrefix = "") const;
 	bool parse(std::ostream& _stream, std::string const& _linePrefix, bool const _formatted);
-	std::string interpret();
+	/// Runs the code using the Interpreter or, if @a _compiled is true, the CompiledInterpreter.
+	std::string interpret(bool _compiled = false);
 
 	static void printErrors(std::ostream& _stream, langutil::ErrorList const& _errors);
 
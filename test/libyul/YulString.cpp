@@ -0,0 +1,124 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for YulStrings and their repositories.
+ */
+
+#include <libyul/YulString.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace solidity::yul::test
+{
+
+BOOST_AUTO_TEST_SUITE(YulStrings)
+
+BOOST_AUTO_TEST_CASE(equality)
+{
+	YulStringRepository repository;
+	YulStringRepository::Scope scope(repository);
+	BOOST_CHECK(YulString("abc") == "abc"_yulstring);
+	BOOST_CHECK(YulString("abc") != "abd"_yulstring);
+	BOOST_CHECK_EQUAL(YulString("abc").str(), "abc");
+	BOOST_CHECK_EQUAL(YulString("abc").hash(), YulStringRepository::hash("abc"));
+	BOOST_CHECK(YulString("").empty());
+	BOOST_CHECK(YulString() == YulString(""));
+	BOOST_CHECK(!YulString("abc").empty());
+}
+
+BOOST_AUTO_TEST_CASE(scopes)
+{
+	YulString outer{"x"};
+	YulStringRepository first;
+	YulStringRepository second;
+	YulString inFirst;
+	YulString inSecond;
+	{
+		YulStringRepository::Scope firstScope(first);
+		BOOST_CHECK(&YulStringRepository::instance() == &first);
+		inFirst = YulString("x");
+		{
+			YulStringRepository::Scope secondScope(second);
+			BOOST_CHECK(&YulStringRepository::instance() == &second);
+			inSecond = YulString("x");
+		}
+		BOOST_CHECK(&YulStringRepository::instance() == &first);
+		BOOST_CHECK(inFirst == YulString("x"));
+	}
+	// Strings of different repositories are distinct, even if their contents are equal.
+	BOOST_CHECK(inFirst != inSecond);
+	BOOST_CHECK(outer != inFirst);
+	BOOST_CHECK(outer == YulString("x"));
+	BOOST_CHECK_EQUAL(inFirst.str(), inSecond.str());
+	// The empty string is shared by all repositories.
+	YulStringRepository::Scope firstScope(first);
+	BOOST_CHECK(YulString("") == YulString());
+}
+
+BOOST_AUTO_TEST_CASE(reset_callback)
+{
+	static vector<YulStringRepository const*> resetRepositories;
+	static YulStringRepository::ResetCallback callback{[](YulStringRepository const& _repository)
+	{
+		resetRepositories.push_back(&_repository);
+	}};
+	resetRepositories.clear();
+
+	auto repository = make_unique<YulStringRepository>();
+	YulStringRepository const* repositoryAddress = repository.get();
+	repository->clear();
+	BOOST_CHECK(resetRepositories == vector<YulStringRepository const*>{repositoryAddress});
+	repository.reset();
+	BOOST_CHECK(resetRepositories == (vector<YulStringRepository const*>{repositoryAddress, repositoryAddress}));
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_insertion)
+{
+	YulStringRepository repository;
+	size_t const threadCount = 4;
+	size_t const stringCount = 1000;
+	vector<vector<YulString>> strings(threadCount);
+	vector<thread> threads;
+	for (size_t i = 0; i < threadCount; ++i)
+		threads.emplace_back([&, i]()
+		{
+			YulStringRepository::Scope scope(repository);
+			for (size_t j = 0; j < stringCount; ++j)
+				strings[i].emplace_back("s" + to_string(j));
+		});
+	for (thread& t: threads)
+		t.join();
+
+	for (size_t i = 1; i < threadCount; ++i)
+		BOOST_CHECK(strings[i] == strings[0]);
+	YulStringRepository::Scope scope(repository);
+	for (size_t j = 0; j < stringCount; ++j)
+	{
+		BOOST_CHECK(strings[0][j] == YulString("s" + to_string(j)));
+		BOOST_CHECK_EQUAL(strings[0][j].str(), "s" + to_string(j));
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
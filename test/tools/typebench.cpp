@@ -0,0 +1,169 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Benchmark for the type checker: Type checks sets of Solidity sources
+ * and reports the number of types created and the peak memory usage.
+ */
+
+#include <libsolidity/ast/TypeProvider.h>
+#include <libsolidity/interface/CompilerStack.h>
+
+#include <liblangutil/SourceReferenceFormatter.h>
+
+#include <libsolutil/CommonIO.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::langutil;
+using namespace solidity::frontend;
+
+namespace po = boost::program_options;
+namespace fs = boost::filesystem;
+
+namespace
+{
+
+/// @returns the contents of all Solidity files in _path, which can be a file or a directory.
+/// The files in a directory are named relative to it, so that they can import each other.
+map<string, string> loadSources(fs::path const& _path)
+{
+	map<string, string> sources;
+	if (fs::is_directory(_path))
+	{
+		for (fs::directory_entry const& entry: fs::recursive_directory_iterator(_path))
+			if (fs::is_regular_file(entry.path()) && entry.path().extension() == ".sol")
+				sources[fs::relative(entry.path(), _path).generic_string()] = readFileAsString(entry.path().string());
+	}
+	else
+		sources[_path.generic_string()] = readFileAsString(_path.string());
+	return sources;
+}
+
+/// @returns the peak resident set size of this process in KiB or zero if it is not available.
+size_t peakMemoryUsage()
+{
+#if defined(_WIN32)
+	return 0;
+#else
+	rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return 0;
+#if defined(__APPLE__)
+	return size_t(usage.ru_maxrss) / 1024;
+#else
+	return size_t(usage.ru_maxrss);
+#endif
+#endif
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	po::options_description options(
+		R"(typebench, type checker benchmark.
+Usage: typebench [Options] <path>...
+Parses and type checks the Solidity files in each <path> (a file or a
+directory, e.g. one of test/compilationTests/*) as one compilation and reports
+the number of types created as well as the peak memory usage.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		(
+			"input-path",
+			po::value<vector<string>>(),
+			"input file or directory"
+		)
+		("help", "Show this help screen.");
+
+	po::positional_options_description filesPositions;
+	filesPositions.add("input-path", -1);
+
+	po::variables_map arguments;
+	try
+	{
+		po::command_line_parser cmdLineParser(argc, argv);
+		cmdLineParser.options(options).positional(filesPositions);
+		po::store(cmdLineParser.run(), arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	if (arguments.count("help") || !arguments.count("input-path"))
+	{
+		cout << options;
+		return 0;
+	}
+
+	bool success = true;
+	size_t totalTypes = 0;
+	chrono::steady_clock::duration totalTime{};
+	for (string const& path: arguments["input-path"].as<vector<string>>())
+	{
+		map<string, string> sources = loadSources(path);
+
+		CompilerStack compiler;
+		compiler.setSources(sources);
+		auto start = chrono::steady_clock::now();
+		bool analysisSuccessful = compiler.parseAndAnalyze();
+		auto time = chrono::steady_clock::now() - start;
+		size_t types = TypeProvider::typeCount();
+
+		if (!analysisSuccessful)
+		{
+			success = false;
+			SourceReferenceFormatter formatter(cerr);
+			for (auto const& error: compiler.errors())
+				formatter.printErrorInformation(*error);
+		}
+
+		cout <<
+			path << ": " <<
+			sources.size() << " sources, " <<
+			types << " types, " <<
+			chrono::duration_cast<chrono::milliseconds>(time).count() << " ms" <<
+			(analysisSuccessful ? "" : " (failed)") <<
+			endl;
+		totalTypes += types;
+		totalTime += time;
+	}
+
+	cout << "Total: " << totalTypes << " types, " << chrono::duration_cast<chrono::milliseconds>(totalTime).count() << " ms" << endl;
+	if (size_t memory = peakMemoryUsage())
+		cout << "Peak memory usage: " << memory << " KiB" << endl;
+
+	return success ? 0 : 1;
+}
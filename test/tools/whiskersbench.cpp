@@ -0,0 +1,151 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Benchmark for Whiskers: Renders templates shaped like the ones used by the
+ * IR generator and reports the render throughput.
+ */
+
+#include <libsolutil/Whiskers.h>
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+/// Renders a function with parameters, a condition and a list, similar to YulUtilFunctions.
+size_t renderFunction(size_t _listLength)
+{
+	vector<Whiskers::StringMap> members(_listLength);
+	for (size_t i = 0; i < _listLength; ++i)
+	{
+		members[i]["memberName"] = "member_" + to_string(i);
+		members[i]["offset"] = to_string(i * 0x20);
+	}
+	string code = Whiskers(R"(
+		function <functionName>(headStart, dataEnd) -> <retVars> {
+			<?dynamic>
+				if slt(sub(dataEnd, headStart), <minimumSize>) { revert(0, 0) }
+			<!dynamic>
+				if lt(dataEnd, add(headStart, <minimumSize>)) { invalid() }
+			</dynamic>
+			<#members>
+			{
+				let offset := <offset>
+				<memberName> := <readFunction>(add(headStart, offset), dataEnd)
+			}
+			</members>
+		}
+	)")
+	("functionName", "abi_decode_tuple_t_uint256_t_address")
+	("retVars", "value0, value1")
+	("dynamic", _listLength % 2 == 0)
+	("minimumSize", "64")
+	("readFunction", "abi_decode_t_uint256")
+	("members", members)
+	.render();
+	return code.size();
+}
+
+/// Renders a short template with only value parameters.
+size_t renderValues()
+{
+	return Whiskers("function <functionName>(value) -> cleaned { cleaned := and(value, <mask>) }")
+		("functionName", "cleanup_t_uint160")
+		("mask", "0xffffffffffffffffffffffffffffffffffffffff")
+		.render()
+		.size();
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	po::options_description options(
+		R"(whiskersbench, Whiskers template benchmark.
+Usage: whiskersbench [Options]
+Renders templates shaped like the ones used by the IR generator and reports
+the number of renders per second.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		(
+			"iterations",
+			po::value<size_t>()->default_value(100000),
+			"number of times each template is rendered"
+		)
+		(
+			"list-length",
+			po::value<size_t>()->default_value(4),
+			"number of elements of the list parameter"
+		)
+		("help", "Show this help screen.");
+
+	po::variables_map arguments;
+	try
+	{
+		po::store(po::parse_command_line(argc, argv, options), arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	if (arguments.count("help"))
+	{
+		cout << options;
+		return 0;
+	}
+
+	size_t iterations = arguments["iterations"].as<size_t>();
+	size_t listLength = arguments["list-length"].as<size_t>();
+
+	auto measure = [&](string const& _name, auto _render)
+	{
+		size_t bytes = 0;
+		auto start = chrono::steady_clock::now();
+		for (size_t i = 0; i < iterations; ++i)
+			bytes += _render();
+		auto time = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+		double seconds = max<double>(double(time.count()) / 1e6, 1e-6);
+		cout <<
+			_name << ": " <<
+			iterations << " renders, " <<
+			time.count() / 1000 << " ms, " <<
+			size_t(double(iterations) / seconds) << " renders/s, " <<
+			size_t(double(bytes) / seconds / 1024 / 1024) << " MiB/s" <<
+			endl;
+	};
+	measure("values", renderValues);
+	measure("function", [&]() { return renderFunction(listLength); });
+
+	return 0;
+}
@@ -0,0 +1,468 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Yul interpreter that executes a pre-resolved translation of the code.
+ */
+
+#include <test/tools/yulInterpreter/CompiledInterpreter.h>
+
+#include <test/tools/yulInterpreter/EVMInstructionInterpreter.h>
+#include <test/tools/yulInterpreter/EwasmBuiltinInterpreter.h>
+
+#include <libyul/AsmData.h>
+#include <libyul/Dialect.h>
+#include <libyul/Exceptions.h>
+#include <libyul/Utilities.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/backends/wasm/WasmDialect.h>
+
+#include <boost/range/adaptor/reversed.hpp>
+
+#include <map>
+#include <variant>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+using namespace solidity::yul::test;
+
+/**
+ * Translates the code into the functions of a CompiledInterpreter.
+ */
+class CompiledInterpreter::Compiler
+{
+public:
+	Compiler(CompiledInterpreter& _interpreter, Dialect const& _dialect):
+		m_interpreter(_interpreter),
+		m_dialect(_dialect)
+	{}
+
+	void compileMain(Block const& _ast)
+	{
+		m_interpreter.m_functions.emplace_back();
+		(*this)(_ast);
+		emit(Opcode::Return);
+		m_interpreter.m_functions.front() = move(m_function);
+	}
+
+	void operator()(ExpressionStatement const& _statement)
+	{
+		size_t values = compile(_statement.expression);
+		for (size_t i = 0; i < values; ++i)
+			emit(Opcode::Pop);
+	}
+
+	void operator()(Assignment const& _assignment)
+	{
+		yulAssert(_assignment.value, "");
+		yulAssert(compile(*_assignment.value) == _assignment.variableNames.size(), "");
+		for (auto const& variable: _assignment.variableNames | boost::adaptors::reversed)
+			emit(Opcode::Store, variableSlot(variable.name));
+	}
+
+	void operator()(VariableDeclaration const& _declaration)
+	{
+		if (_declaration.value)
+			yulAssert(compile(*_declaration.value) == _declaration.variables.size(), "");
+		vector<size_t> slots;
+		for (auto const& variable: _declaration.variables)
+			slots.emplace_back(declareVariable(variable.name));
+		if (_declaration.value)
+			for (size_t slot: slots | boost::adaptors::reversed)
+				emit(Opcode::Store, slot);
+		else
+			for (size_t slot: slots)
+			{
+				emit(Opcode::Constant, constant(0));
+				emit(Opcode::Store, slot);
+			}
+	}
+
+	void operator()(If const& _if)
+	{
+		yulAssert(_if.condition, "");
+		yulAssert(compile(*_if.condition) == 1, "");
+		size_t skip = emit(Opcode::JumpIfZero);
+		(*this)(_if.body);
+		setTarget(skip);
+	}
+
+	void operator()(Switch const& _switch)
+	{
+		yulAssert(_switch.expression, "");
+		yulAssert(!_switch.cases.empty(), "");
+		yulAssert(compile(*_switch.expression) == 1, "");
+		vector<pair<size_t, Block const*>> cases;
+		Block const* defaultBody = nullptr;
+		for (auto const& c: _switch.cases)
+			if (c.value)
+				cases.emplace_back(emit(Opcode::JumpIfCase, constant(valueOfLiteral(*c.value))), &c.body);
+			else
+				// Default case has to be last.
+				defaultBody = &c.body;
+		emit(Opcode::Pop);
+		if (defaultBody)
+			(*this)(*defaultBody);
+		vector<size_t> exits{emit(Opcode::Jump)};
+		for (auto const& [jump, body]: cases)
+		{
+			setTarget(jump);
+			(*this)(*body);
+			exits.emplace_back(emit(Opcode::Jump));
+		}
+		for (size_t exit: exits)
+			setTarget(exit);
+	}
+
+	void operator()(FunctionDefinition const&)
+	{
+		// Compiled when registered in the enclosing block.
+	}
+
+	void operator()(ForLoop const& _forLoop)
+	{
+		yulAssert(_forLoop.condition, "");
+		// The pre block is not counted as a step.
+		m_scopes.emplace_back();
+		for (auto const& statement: _forLoop.pre.statements)
+			visit(*this, statement);
+
+		size_t condition = m_function.code.size();
+		yulAssert(compile(*_forLoop.condition) == 1, "");
+		m_loops.emplace_back();
+		m_loops.back().breaks.emplace_back(emit(Opcode::JumpIfZero));
+		(*this)(_forLoop.body);
+		Loop loop = move(m_loops.back());
+		m_loops.pop_back();
+
+		for (size_t jump: loop.continues)
+			setTarget(jump);
+		(*this)(_forLoop.post);
+		emit(Opcode::Jump, 0, condition);
+		for (size_t jump: loop.breaks)
+			setTarget(jump);
+		m_scopes.pop_back();
+	}
+
+	void operator()(Break const&)
+	{
+		yulAssert(!m_loops.empty(), "");
+		m_loops.back().breaks.emplace_back(emit(Opcode::Jump));
+	}
+
+	void operator()(Continue const&)
+	{
+		yulAssert(!m_loops.empty(), "");
+		m_loops.back().continues.emplace_back(emit(Opcode::Jump));
+	}
+
+	void operator()(Leave const&)
+	{
+		emit(Opcode::Return);
+	}
+
+	void operator()(Block const& _block)
+	{
+		emit(Opcode::Step);
+		m_scopes.emplace_back();
+		vector<pair<FunctionDefinition const*, size_t>> functions;
+		for (auto const& statement: _block.statements)
+			if (auto const* function = get_if<FunctionDefinition>(&statement))
+			{
+				size_t index = m_interpreter.m_functions.size();
+				m_interpreter.m_functions.emplace_back();
+				yulAssert(!m_scopes.back().count(function->name), "");
+				m_scopes.back()[function->name] = Declaration{index, 0, function};
+				functions.emplace_back(function, index);
+			}
+		for (auto const& [function, index]: functions)
+			compileFunction(*function, index);
+
+		for (auto const& statement: _block.statements)
+			visit(*this, statement);
+		m_scopes.pop_back();
+	}
+
+private:
+	/// Variable or function visible in a scope.
+	struct Declaration
+	{
+		/// Slot of a variable or index of a function.
+		size_t index = 0;
+		/// The function the slot of a variable belongs to.
+		size_t frame = 0;
+		/// The definition of a function, nullptr for variables.
+		FunctionDefinition const* function = nullptr;
+	};
+
+	struct Loop
+	{
+		std::vector<size_t> breaks;
+		std::vector<size_t> continues;
+	};
+
+	void compileFunction(FunctionDefinition const& _function, size_t _index)
+	{
+		Function outerFunction = move(m_function);
+		vector<Loop> outerLoops = move(m_loops);
+		size_t outerFrame = m_frame;
+		m_function = Function{};
+		m_loops.clear();
+		m_frame = _index;
+
+		m_scopes.emplace_back();
+		for (auto const& parameter: _function.parameters)
+			declareVariable(parameter.name);
+		for (auto const& returnVariable: _function.returnVariables)
+			declareVariable(returnVariable.name);
+		m_function.parameters = _function.parameters.size();
+		m_function.returnVariables = _function.returnVariables.size();
+		(*this)(_function.body);
+		emit(Opcode::Return);
+		m_scopes.pop_back();
+
+		m_interpreter.m_functions[_index] = move(m_function);
+		m_function = move(outerFunction);
+		m_loops = move(outerLoops);
+		m_frame = outerFrame;
+	}
+
+	/// Emits the code evaluating @a _expression.
+	/// @returns the number of values it pushes.
+	size_t compile(Expression const& _expression)
+	{
+		if (auto const* literal = get_if<Literal>(&_expression))
+		{
+			emit(Opcode::Constant, constant(valueOfLiteral(*literal)));
+			return 1;
+		}
+		else if (auto const* identifier = get_if<Identifier>(&_expression))
+		{
+			emit(Opcode::Load, variableSlot(identifier->name));
+			return 1;
+		}
+
+		FunctionCall const& call = std::get<FunctionCall>(_expression);
+		/// Function arguments are evaluated in reverse.
+		for (auto const& argument: call.arguments | boost::adaptors::reversed)
+			yulAssert(compile(argument) == 1, "");
+
+		if (optional<size_t> builtin = builtinIndex(call.functionName.name, call.arguments.size()))
+		{
+			emit(Opcode::Builtin, *builtin);
+			return 1;
+		}
+		Declaration const& function = lookup(call.functionName.name);
+		yulAssert(function.function, "Function not found.");
+		yulAssert(function.function->parameters.size() == call.arguments.size(), "");
+		emit(Opcode::Call, function.index);
+		return function.function->returnVariables.size();
+	}
+
+	/// @returns the index of the builtin called @a _name, nullopt if there is no such builtin.
+	optional<size_t> builtinIndex(YulString _name, size_t _arguments)
+	{
+		Builtin builtin{nullptr, _name, _arguments};
+		if (EVMDialect const* dialect = dynamic_cast<EVMDialect const*>(&m_dialect))
+		{
+			builtin.evmBuiltin = dialect->builtin(_name);
+			if (!builtin.evmBuiltin)
+				return nullopt;
+		}
+		else if (WasmDialect const* dialect = dynamic_cast<WasmDialect const*>(&m_dialect))
+		{
+			if (!dialect->builtin(_name))
+				return nullopt;
+		}
+		else
+			return nullopt;
+
+		auto [it, inserted] = m_builtinIndices.emplace(_name, m_interpreter.m_builtins.size());
+		if (inserted)
+			m_interpreter.m_builtins.emplace_back(builtin);
+		return it->second;
+	}
+
+	size_t constant(u256 const& _value)
+	{
+		auto [it, inserted] = m_constantIndices.emplace(_value, m_interpreter.m_constants.size());
+		if (inserted)
+			m_interpreter.m_constants.emplace_back(_value);
+		return it->second;
+	}
+
+	size_t declareVariable(YulString _name)
+	{
+		yulAssert(!m_scopes.back().count(_name), "");
+		m_scopes.back()[_name] = Declaration{m_function.slots, m_frame, nullptr};
+		return m_function.slots++;
+	}
+
+	size_t variableSlot(YulString _name) const
+	{
+		Declaration const& variable = lookup(_name);
+		yulAssert(!variable.function && variable.frame == m_frame, "Variable not found.");
+		return variable.index;
+	}
+
+	Declaration const& lookup(YulString _name) const
+	{
+		Declaration const* declaration = nullptr;
+		for (auto const& scope: m_scopes | boost::adaptors::reversed)
+			if (scope.count(_name))
+			{
+				declaration = &scope.at(_name);
+				break;
+			}
+		yulAssert(declaration, "Identifier not found: " + _name.str());
+		return *declaration;
+	}
+
+	/// Appends an instruction to the current function. @returns its index.
+	size_t emit(Opcode _opcode, size_t _argument = 0, size_t _target = 0)
+	{
+		m_function.code.emplace_back(Instruction{_opcode, _argument, _target});
+		return m_function.code.size() - 1;
+	}
+
+	/// Makes the jump at @a _jump continue at the next instruction emitted.
+	void setTarget(size_t _jump)
+	{
+		m_function.code[_jump].target = m_function.code.size();
+	}
+
+	CompiledInterpreter& m_interpreter;
+	Dialect const& m_dialect;
+	/// The function currently being compiled.
+	Function m_function;
+	/// Index of the function currently being compiled.
+	size_t m_frame = 0;
+	std::vector<std::map<YulString, Declaration>> m_scopes;
+	/// The loops enclosing the current statement in the current function.
+	std::vector<Loop> m_loops;
+	std::map<YulString, size_t> m_builtinIndices;
+	std::map<u256, size_t> m_constantIndices;
+};
+
+CompiledInterpreter::CompiledInterpreter(Dialect const& _dialect, Block const& _ast)
+{
+	Compiler(*this, _dialect).compileMain(_ast);
+}
+
+void CompiledInterpreter::run(InterpreterState& _state) const
+{
+	EVMInstructionInterpreter evmInterpreter(_state);
+	EwasmBuiltinInterpreter ewasmInterpreter(_state);
+
+	struct Frame
+	{
+		Function const* function = nullptr;
+		size_t returnAddress = 0;
+		size_t base = 0;
+	};
+	vector<Frame> callers;
+	vector<u256> stack;
+	vector<u256> arguments;
+	vector<u256> slots(m_functions.front().slots);
+	Function const* function = &m_functions.front();
+	size_t base = 0;
+	size_t pc = 0;
+	while (true)
+	{
+		Instruction const& instruction = function->code[pc++];
+		switch (instruction.opcode)
+		{
+		case Opcode::Step:
+			_state.numSteps++;
+			if (_state.maxSteps > 0 && _state.numSteps >= _state.maxSteps)
+			{
+				_state.trace.emplace_back("Interpreter execution step limit reached.");
+				throw StepLimitReached();
+			}
+			break;
+		case Opcode::Constant:
+			stack.emplace_back(m_constants[instruction.argument]);
+			break;
+		case Opcode::Load:
+			stack.emplace_back(slots[base + instruction.argument]);
+			break;
+		case Opcode::Store:
+			slots[base + instruction.argument] = move(stack.back());
+			stack.pop_back();
+			break;
+		case Opcode::Pop:
+			stack.pop_back();
+			break;
+		case Opcode::Jump:
+			pc = instruction.target;
+			break;
+		case Opcode::JumpIfZero:
+			if (stack.back() == 0)
+				pc = instruction.target;
+			stack.pop_back();
+			break;
+		case Opcode::JumpIfCase:
+			if (stack.back() == m_constants[instruction.argument])
+			{
+				stack.pop_back();
+				pc = instruction.target;
+			}
+			break;
+		case Opcode::Builtin:
+		{
+			Builtin const& builtin = m_builtins[instruction.argument];
+			arguments.assign(stack.rbegin(), stack.rbegin() + ptrdiff_t(builtin.arguments));
+			stack.resize(stack.size() - builtin.arguments);
+			stack.emplace_back(
+				builtin.evmBuiltin ?
+				evmInterpreter.evalBuiltin(*builtin.evmBuiltin, arguments) :
+				ewasmInterpreter.evalBuiltin(builtin.name, arguments)
+			);
+			break;
+		}
+		case Opcode::Call:
+		{
+			Function const& callee = m_functions[instruction.argument];
+			callers.emplace_back(Frame{function, pc, base});
+			base = slots.size();
+			slots.resize(base + callee.slots);
+			for (size_t i = 0; i < callee.parameters; ++i)
+			{
+				slots[base + i] = move(stack.back());
+				stack.pop_back();
+			}
+			function = &callee;
+			pc = 0;
+			break;
+		}
+		case Opcode::Return:
+		{
+			if (callers.empty())
+				return;
+			for (size_t i = 0; i < function->returnVariables; ++i)
+				stack.emplace_back(slots[base + function->parameters + i]);
+			slots.resize(base);
+			Frame const& caller = callers.back();
+			function = caller.function;
+			pc = caller.returnAddress;
+			base = caller.base;
+			callers.pop_back();
+			break;
+		}
+		}
+	}
+}
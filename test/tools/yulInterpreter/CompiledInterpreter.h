@@ -0,0 +1,121 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Yul interpreter that executes a pre-resolved translation of the code.
+ */
+
+#pragma once
+
+#include <test/tools/yulInterpreter/Interpreter.h>
+
+#include <libyul/AsmDataForward.h>
+#include <libyul/YulString.h>
+
+#include <libsolutil/Common.h>
+
+#include <vector>
+
+namespace solidity::yul
+{
+struct Dialect;
+struct BuiltinFunctionForEVM;
+}
+
+namespace solidity::yul::test
+{
+
+/**
+ * Yul interpreter that translates a block into flat sequences of instructions once
+ * and then executes those, possibly multiple times.
+ *
+ * During the translation, variables are resolved to slots in the frame of their function
+ * and function calls to the called function. The execution results in the same trace,
+ * state, number of steps and exceptions as running the Interpreter on the block.
+ *
+ * The block has to be analyzed.
+ */
+class CompiledInterpreter
+{
+public:
+	CompiledInterpreter(Dialect const& _dialect, Block const& _ast);
+
+	/// Runs the code on @a _state.
+	void run(InterpreterState& _state) const;
+
+private:
+	class Compiler;
+
+	enum class Opcode
+	{
+		/// Counts a step, i.e. the execution of a block, and checks the step limit.
+		Step,
+		/// Pushes the constant with index argument.
+		Constant,
+		/// Pushes the value of the variable in slot argument of the current frame.
+		Load,
+		/// Pops a value and stores it in slot argument of the current frame.
+		Store,
+		Pop,
+		/// Continues at instruction target.
+		Jump,
+		/// Pops a value and continues at instruction target if it is zero.
+		JumpIfZero,
+		/// Pops the top value and continues at instruction target if it equals
+		/// the constant with index argument. Otherwise, keeps the value.
+		JumpIfCase,
+		/// Calls the builtin with index argument. The first argument is on top of the stack.
+		/// Pushes a single value.
+		Builtin,
+		/// Calls the function with index argument. The first argument is on top of the stack.
+		/// Pushes the return values, the last one on top.
+		Call,
+		/// Returns from the current function.
+		Return
+	};
+
+	struct Instruction
+	{
+		Opcode opcode;
+		size_t argument = 0;
+		size_t target = 0;
+	};
+
+	struct Builtin
+	{
+		/// The builtin of an EVM dialect, nullptr for other dialects.
+		BuiltinFunctionForEVM const* evmBuiltin = nullptr;
+		YulString name;
+		size_t arguments = 0;
+	};
+
+	struct Function
+	{
+		std::vector<Instruction> code;
+		size_t parameters = 0;
+		size_t returnVariables = 0;
+		/// Number of slots in a frame: the parameters, followed by the return
+		/// variables, followed by the local variables.
+		size_t slots = 0;
+	};
+
+	std::vector<u256> m_constants;
+	std::vector<Builtin> m_builtins;
+	/// The code outside of functions is the first function.
+	std::vector<Function> m_functions;
+};
+
+}
@@ -63,18 +63,6 @@ u256 readZeroExtended(bytes const& _data, u256 const& _offset)
 	}
 }
 
-/// Copy @a _size bytes of @a _source at offset @a _sourceOffset to
-/// @a _target at offset @a _targetOffset. Behaves as if @a _source would
-/// continue with an infinite sequence of zero bytes beyond its end.
-void copyZeroExtended(
-	map<u256, uint8_t>& _target, bytes const& _source,
-	size_t _targetOffset, size_t _sourceOffset, size_t _size
-)
-{
-	for (size_t i = 0; i < _size; ++i)
-		_target[_targetOffset + i] = _sourceOffset + i < _source.size() ? _source[_sourceOffset + i] : 0;
-}
-
 }
 
 using u512 = boost::multiprecision::number<boost::multiprecision::cpp_int_backend<512, 256, boost::multiprecision::unsigned_magnitude, boost::multiprecision::unchecked, void>>;
@@ -197,18 +185,18 @@ u256 EVMInstructionInterpreter::eval(
 		return m_state.calldata.size();
 	case Instruction::CALLDATACOPY:
 		if (accessMemory(arg[0], arg[2]))
-			copyZeroExtended(
-				m_state.memory, m_state.calldata,
-				size_t(arg[0]), size_t(arg[1]), size_t(arg[2])
+			m_state.memory.copyZeroExtended(
+				size_t(arg[0]), m_state.calldata,
+				size_t(arg[1]), size_t(arg[2])
 			);
 		return 0;
 	case Instruction::CODESIZE:
 		return m_state.code.size();
 	case Instruction::CODECOPY:
 		if (accessMemory(arg[0], arg[2]))
-			copyZeroExtended(
-				m_state.memory, m_state.code,
-				size_t(arg[0]), size_t(arg[1]), size_t(arg[2])
+			m_state.memory.copyZeroExtended(
+				size_t(arg[0]), m_state.code,
+				size_t(arg[1]), size_t(arg[2])
 			);
 		return 0;
 	case Instruction::GASPRICE:
@@ -223,9 +211,9 @@ u256 EVMInstructionInterpreter::eval(
 		logTrace(_instruction, arg);
 		if (accessMemory(arg[1], arg[3]))
 			// TODO this way extcodecopy and codecopy do the same thing.
-			copyZeroExtended(
-				m_state.memory, m_state.code,
-				size_t(arg[1]), size_t(arg[2]), size_t(arg[3])
+			m_state.memory.copyZeroExtended(
+				size_t(arg[1]), m_state.code,
+				size_t(arg[2]), size_t(arg[3])
 			);
 		return 0;
 	case Instruction::RETURNDATASIZE:
@@ -233,9 +221,9 @@ u256 EVMInstructionInterpreter::eval(
 	case Instruction::RETURNDATACOPY:
 		logTrace(_instruction, arg);
 		if (accessMemory(arg[0], arg[2]))
-			copyZeroExtended(
-				m_state.memory, m_state.returndata,
-				size_t(arg[0]), size_t(arg[1]), size_t(arg[2])
+			m_state.memory.copyZeroExtended(
+				size_t(arg[0]), m_state.returndata,
+				size_t(arg[1]), size_t(arg[2])
 			);
 		return 0;
 	case Instruction::BLOCKHASH:
@@ -263,7 +251,7 @@ u256 EVMInstructionInterpreter::eval(
 		return 0;
 	case Instruction::MSTORE8:
 		accessMemory(arg[0], 1);
-		m_state.memory[arg[0]] = uint8_t(arg[1] & 0xff);
+		m_state.memory.writeByte(arg[0], uint8_t(arg[1] & 0xff));
 		return 0;
 	case Instruction::SLOAD:
 		return m_state.storage[h256(arg[0])];
@@ -438,10 +426,9 @@ u256 EVMInstructionInterpreter::evalBuiltin(BuiltinFunctionForEVM const& _fun, c
 	{
 		// This is identical to codecopy.
 		if (accessMemory(_arguments.at(0), _arguments.at(2)))
-			copyZeroExtended(
-				m_state.memory,
-				m_state.code,
+			m_state.memory.copyZeroExtended(
 				size_t(_arguments.at(0)),
+				m_state.code,
 				size_t(_arguments.at(1) & size_t(-1)),
 				size_t(_arguments.at(2))
 			);
@@ -469,10 +456,7 @@ bool EVMInstructionInterpreter::accessMemory(u256 const& _offset, u256 const& _s
 bytes EVMInstructionInterpreter::readMemory(u256 const& _offset, u256 const& _size)
 {
 	yulAssert(_size <= 0xffff, "Too large read.");
-	bytes data(size_t(_size), uint8_t(0));
-	for (size_t i = 0; i < data.size(); ++i)
-		data[i] = m_state.memory[_offset + i];
-	return data;
+	return m_state.memory.read(_offset, size_t(_size));
 }
 
 u256 EVMInstructionInterpreter::readMemoryWord(u256 const& _offset)
@@ -482,8 +466,8 @@ u256 EVMInstructionInterpreter::readMemoryWord(u256 const& _offset)
 
 void EVMInstructionInterpreter::writeMemoryWord(u256 const& _offset, u256 const& _value)
 {
-	for (size_t i = 0; i < 32; i++)
-		m_state.memory[_offset + i] = uint8_t((_value >> (8 * (31 - i))) & 0xff);
+	h256 word(_value);
+	m_state.memory.write(_offset, word.data(), h256::size);
 }
 
 
@@ -39,18 +39,6 @@ using solidity::util::h256;
 namespace
 {
 
-/// Copy @a _size bytes of @a _source at offset @a _sourceOffset to
-/// @a _target at offset @a _targetOffset. Behaves as if @a _source would
-/// continue with an infinite sequence of zero bytes beyond its end.
-void copyZeroExtended(
-	map<u256, uint8_t>& _target, bytes const& _source,
-	size_t _targetOffset, size_t _sourceOffset, size_t _size
-)
-{
-	for (size_t i = 0; i < _size; ++i)
-		_target[_targetOffset + i] = _sourceOffset + i < _source.size() ? _source[_sourceOffset + i] : 0;
-}
-
 /// Count leading zeros for uint64
 uint64_t clz(uint64_t _v)
 {
@@ -84,10 +72,9 @@ u256 EwasmBuiltinInterpreter::evalBuiltin(YulString _fun, vector<u256> const& _a
 	{
 		// This is identical to codecopy.
 		if (accessMemory(_arguments.at(0), _arguments.at(2)))
-			copyZeroExtended(
-				m_state.memory,
-				m_state.code,
+			m_state.memory.copyZeroExtended(
 				size_t(_arguments.at(0)),
+				m_state.code,
 				size_t(_arguments.at(1) & size_t(-1)),
 				size_t(_arguments.at(2))
 			);
@@ -257,9 +244,9 @@ u256 EwasmBuiltinInterpreter::evalEthBuiltin(string const& _fun, vector<uint64_t
 		if (arg[1] + arg[2] < arg[1] || arg[1] + arg[2] > m_state.calldata.size())
 			throw ExplicitlyTerminated();
 		if (accessMemory(arg[0], arg[2]))
-			copyZeroExtended(
-				m_state.memory, m_state.calldata,
-				size_t(arg[0]), size_t(arg[1]), size_t(arg[2])
+			m_state.memory.copyZeroExtended(
+				size_t(arg[0]), m_state.calldata,
+				size_t(arg[1]), size_t(arg[2])
 			);
 		return {};
 	}
@@ -310,9 +297,9 @@ u256 EwasmBuiltinInterpreter::evalEthBuiltin(string const& _fun, vector<uint64_t
 	else if (_fun == "codeCopy")
 	{
 		if (accessMemory(arg[0], arg[2]))
-			copyZeroExtended(
-				m_state.memory, m_state.code,
-				size_t(arg[0]), size_t(arg[1]), size_t(arg[2])
+			m_state.memory.copyZeroExtended(
+				size_t(arg[0]), m_state.code,
+				size_t(arg[1]), size_t(arg[2])
 			);
 		return 0;
 	}
@@ -340,9 +327,9 @@ u256 EwasmBuiltinInterpreter::evalEthBuiltin(string const& _fun, vector<uint64_t
 		// TODO use readAddress to read address.
 		if (accessMemory(arg[1], arg[3]))
 			// TODO this way extcodecopy and codecopy do the same thing.
-			copyZeroExtended(
-				m_state.memory, m_state.code,
-				size_t(arg[1]), size_t(arg[2]), size_t(arg[3])
+			m_state.memory.copyZeroExtended(
+				size_t(arg[1]), m_state.code,
+				size_t(arg[2]), size_t(arg[3])
 			);
 		return 0;
 	}
@@ -396,9 +383,9 @@ u256 EwasmBuiltinInterpreter::evalEthBuiltin(string const& _fun, vector<uint64_t
 		if (arg[1] + arg[2] < arg[1] || arg[1] + arg[2] > m_state.returndata.size())
 			throw ExplicitlyTerminated();
 		if (accessMemory(arg[0], arg[2]))
-			copyZeroExtended(
-				m_state.memory, m_state.calldata,
-				size_t(arg[0]), size_t(arg[1]), size_t(arg[2])
+			m_state.memory.copyZeroExtended(
+				size_t(arg[0]), m_state.calldata,
+				size_t(arg[1]), size_t(arg[2])
 			);
 		return {};
 	}
@@ -433,61 +420,66 @@ bool EwasmBuiltinInterpreter::accessMemory(u256 const& _offset, u256 const& _siz
 bytes EwasmBuiltinInterpreter::readMemory(uint64_t _offset, uint64_t _size)
 {
 	yulAssert(_size <= 0xffff, "Too large read.");
-	bytes data(size_t(_size), uint8_t(0));
-	for (size_t i = 0; i < data.size(); ++i)
-		data[i] = m_state.memory[_offset + i];
-	return data;
+	return m_state.memory.read64(_offset, size_t(_size));
 }
 
 uint64_t EwasmBuiltinInterpreter::readMemoryWord(uint64_t _offset)
 {
+	bytes data = m_state.memory.read64(_offset, 8);
 	uint64_t r = 0;
 	for (size_t i = 0; i < 8; i++)
-		r |= uint64_t(m_state.memory[_offset + i]) << (i * 8);
+		r |= uint64_t(data[i]) << (i * 8);
 	return r;
 }
 
 uint32_t EwasmBuiltinInterpreter::readMemoryHalfWord(uint64_t _offset)
 {
+	bytes data = m_state.memory.read64(_offset, 4);
 	uint32_t r = 0;
 	for (size_t i = 0; i < 4; i++)
-		r |= uint64_t(m_state.memory[_offset + i]) << (i * 8);
+		r |= uint32_t(data[i]) << (i * 8);
 	return r;
 }
 
 void EwasmBuiltinInterpreter::writeMemoryWord(uint64_t _offset, uint64_t _value)
 {
+	bytes data(8);
 	for (size_t i = 0; i < 8; i++)
-		m_state.memory[_offset + i] = uint8_t((_value >> (i * 8)) & 0xff);
+		data[i] = uint8_t((_value >> (i * 8)) & 0xff);
+	m_state.memory.write64(_offset, data);
 }
 
 void EwasmBuiltinInterpreter::writeMemoryHalfWord(uint64_t _offset, uint32_t _value)
 {
+	bytes data(4);
 	for (size_t i = 0; i < 4; i++)
-		m_state.memory[_offset + i] = uint8_t((_value >> (i * 8)) & 0xff);
+		data[i] = uint8_t((_value >> (i * 8)) & 0xff);
+	m_state.memory.write64(_offset, data);
 }
 
 void EwasmBuiltinInterpreter::writeMemoryByte(uint64_t _offset, uint8_t _value)
 {
-	m_state.memory[_offset] = _value;
+	m_state.memory.writeByte(_offset, _value);
 }
 
 void EwasmBuiltinInterpreter::writeU256(uint64_t _offset, u256 _value, size_t _croppedTo)
 {
 	accessMemory(_offset, _croppedTo);
+	bytes data(_croppedTo);
 	for (size_t i = 0; i < _croppedTo; i++)
 	{
-		m_state.memory[_offset + _croppedTo - 1 - i] = uint8_t(_value & 0xff);
+		data[_croppedTo - 1 - i] = uint8_t(_value & 0xff);
 		_value >>= 8;
 	}
+	m_state.memory.write64(_offset, data);
 }
 
 u256 EwasmBuiltinInterpreter::readU256(uint64_t _offset, size_t _croppedTo)
 {
 	accessMemory(_offset, _croppedTo);
 	u256 value;
-	for (size_t i = 0; i < _croppedTo; i++)
-		value = (value << 8) | m_state.memory[_offset + i];
+	for (uint8_t byte: m_state.memory.read64(_offset, _croppedTo))
+		value = (value << 8) | byte;
 
 	return value;
 }
@@ -52,14 +52,10 @@ void InterpreterState::dumpTraceAndState(ostream& _out) const
 	for (auto const& line: trace)
 		_out << "  " << line << endl;
 	_out << "Memory dump:\n";
-	map<u256, u256> words;
-	for (auto const& [offset, value]: memory)
-		words[(offset / 0x20) * 0x20] |= u256(uint32_t(value)) << (256 - 8 - 8 * size_t(offset % 0x20));
-	for (auto const& [offset, value]: words)
-		if (value != 0)
-			_out << "  " << std::uppercase << std::hex << std::setw(4) << offset << ": " << h256(value).hex() << endl;
+	for (auto const& [offset, value]: memory.nonZeroWords())
+		_out << "  " << std::uppercase << std::hex << std::setw(4) << offset << ": " << h256(value).hex() << endl;
 	_out << "Storage dump:" << endl;
-	for (auto const& slot: storage)
+	for (auto const& slot: map<h256, h256>(storage.begin(), storage.end()))
 		if (slot.second != h256{})
 			_out << "  " << slot.first.hex() << ": " << slot.second.hex() << endl;
 }
@@ -220,9 +216,6 @@ void Interpreter::closeScope()
 
 void ExpressionEvaluator::operator()(Literal const& _literal)
 {
-	static YulString const trueString("true");
-	static YulString const falseString("false");
-
 	setValue(valueOfLiteral(_literal));
 }
 
@@ -285,7 +278,7 @@ void ExpressionEvaluator::setValue(u256 _value)
 	m_values.emplace_back(std::move(_value));
 }
 
-void ExpressionEvaluator::evaluateArgs(vector<Expression> const& _expr)
+void ExpressionEvaluator::evaluateArgs(ASTVector<Expression> const& _expr)
 {
 	vector<u256> values;
 	/// Function arguments are evaluated in reverse.
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <test/tools/yulInterpreter/Memory.h>
+
 #include <libyul/AsmDataForward.h>
 #include <libyul/optimiser/ASTWalker.h>
 
@@ -66,10 +68,10 @@ struct InterpreterState
 {
 	bytes calldata;
 	bytes returndata;
-	std::map<u256, uint8_t> memory;
-	/// This is different than memory.size() because we ignore gas.
+	Memory memory;
+	/// This is the highest accessed offset rounded up to a word because we ignore gas.
 	u256 msize;
-	std::map<util::h256, util::h256> storage;
+	Storage storage;
 	u160 address = 0x11111111;
 	u256 balance = 0x22222222;
 	u256 selfbalance = 0x22223333;
@@ -182,7 +184,7 @@ private:
 
 	/// Evaluates the given expression from right to left and
 	/// stores it in m_value.
-	void evaluateArgs(std::vector<Expression> const& _expr);
+	void evaluateArgs(ASTVector<Expression> const& _expr);
 
 	/// Finds the function called @a _functionName in the current scope stack and returns
 	/// the function's scope stack (with variables removed) and definition.
@@ -0,0 +1,163 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Memory and storage of the Yul interpreter.
+ */
+
+#include <test/tools/yulInterpreter/Memory.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul::test;
+
+using solidity::util::h256;
+
+uint8_t Memory::readByte(u256 const& _offset) const
+{
+	Page const* p = findPage(_offset / PageSize);
+	return p ? (*p)[size_t(_offset % PageSize)] : 0;
+}
+
+void Memory::writeByte(u256 const& _offset, uint8_t _value)
+{
+	page(_offset / PageSize)[size_t(_offset % PageSize)] = _value;
+}
+
+bytes Memory::read(u256 const& _offset, size_t _size) const
+{
+	bytes data(_size, 0);
+	forEachPage(_offset, _size, [&](u256 const& _index, size_t _pageOffset, size_t _dataOffset, size_t _partSize) {
+		if (Page const* p = findPage(_index))
+			memcpy(data.data() + _dataOffset, p->data() + _pageOffset, _partSize);
+	});
+	return data;
+}
+
+void Memory::write(u256 const& _offset, uint8_t const* _data, size_t _size)
+{
+	forEachPage(_offset, _size, [&](u256 const& _index, size_t _pageOffset, size_t _dataOffset, size_t _partSize) {
+		memcpy(page(_index).data() + _pageOffset, _data + _dataOffset, _partSize);
+	});
+}
+
+void Memory::copyZeroExtended(size_t _targetOffset, bytes const& _source, size_t _sourceOffset, size_t _size)
+{
+	if (_size == 0)
+		return;
+	bytes data(_size, 0);
+	if (_sourceOffset + _size >= _sourceOffset)
+	{
+		if (_sourceOffset < _source.size())
+			copy_n(
+				_source.begin() + ptrdiff_t(_sourceOffset),
+				min(_size, _source.size() - _sourceOffset),
+				data.begin()
+			);
+	}
+	else
+		for (size_t i = 0; i < _size; ++i)
+			data[i] = _sourceOffset + i < _source.size() ? _source[_sourceOffset + i] : 0;
+	write64(_targetOffset, data);
+}
+
+bytes Memory::read64(uint64_t _offset, size_t _size) const
+{
+	size_t firstPart = sizeBelow64BitWrap(_offset, _size);
+	bytes data = read(_offset, firstPart);
+	if (firstPart < _size)
+		data += read(0, _size - firstPart);
+	return data;
+}
+
+void Memory::write64(uint64_t _offset, bytes const& _data)
+{
+	size_t firstPart = sizeBelow64BitWrap(_offset, _data.size());
+	write(_offset, _data.data(), firstPart);
+	write(0, _data.data() + firstPart, _data.size() - firstPart);
+}
+
+map<u256, u256> Memory::nonZeroWords() const
+{
+	map<u256, u256> words;
+	auto addPage = [&](u256 const& _index, Page const& _page)
+	{
+		for (size_t wordOffset = 0; wordOffset < PageSize; wordOffset += 32)
+		{
+			uint8_t const* word = _page.data() + wordOffset;
+			if (any_of(word, word + 32, [](uint8_t _byte) { return _byte != 0; }))
+				words[_index * PageSize + wordOffset] = u256(h256(bytesConstRef(word, 32)));
+		}
+	};
+	for (size_t index = 0; index < m_lowPages.size(); ++index)
+		if (m_lowPages[index])
+			addPage(index, *m_lowPages[index]);
+	for (auto const& [index, highPage]: m_highPages)
+		addPage(index, *highPage);
+	return words;
+}
+
+Memory::Page const* Memory::findPage(u256 const& _index) const
+{
+	if (_index < LowMemoryLimit / PageSize)
+	{
+		size_t index = size_t(_index);
+		return index < m_lowPages.size() ? m_lowPages[index].get() : nullptr;
+	}
+	auto it = m_highPages.find(_index);
+	return it == m_highPages.end() ? nullptr : it->second.get();
+}
+
+Memory::Page& Memory::page(u256 const& _index)
+{
+	unique_ptr<Page>* p = nullptr;
+	if (_index < LowMemoryLimit / PageSize)
+	{
+		size_t index = size_t(_index);
+		if (index >= m_lowPages.size())
+			m_lowPages.resize(index + 1);
+		p = &m_lowPages[index];
+	}
+	else
+		p = &m_highPages[_index];
+	if (!*p)
+		*p = make_unique<Page>();
+	return **p;
+}
+
+size_t Memory::sizeBelow64BitWrap(uint64_t _offset, size_t _size)
+{
+	uint64_t untilWrap = numeric_limits<uint64_t>::max() - _offset;
+	return _size == 0 || _size - 1 <= untilWrap ? _size : size_t(untilWrap) + 1;
+}
+
+template <typename Fun>
+void Memory::forEachPage(u256 const& _offset, size_t _size, Fun&& _fun)
+{
+	u256 position = _offset;
+	for (size_t done = 0; done < _size;)
+	{
+		size_t pageOffset = size_t(position % PageSize);
+		size_t partSize = min(_size - done, PageSize - pageOffset);
+		_fun(position / PageSize, pageOffset, done, partSize);
+		done += partSize;
+		position += partSize;
+	}
+}
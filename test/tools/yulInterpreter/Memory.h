@@ -0,0 +1,106 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Memory and storage of the Yul interpreter.
+ */
+
+#pragma once
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/FixedHash.h>
+
+#include <boost/functional/hash.hpp>
+
+#include <array>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace solidity::yul::test
+{
+
+/**
+ * Byte-addressable memory of the Yul interpreter covering the full range of 2**256 addresses,
+ * all of which are initially zero.
+ *
+ * The memory is split into pages that are allocated on the first write to them.
+ * The pages below LowMemoryLimit are found by index, the ones above in a map,
+ * so that accesses at very high addresses do not need a large page table.
+ * Accesses wrap around at 2**256.
+ */
+class Memory
+{
+public:
+	static size_t constexpr PageSize = 0x1000;
+	static size_t constexpr LowMemoryLimit = size_t(1) << 32;
+
+	uint8_t readByte(u256 const& _offset) const;
+	void writeByte(u256 const& _offset, uint8_t _value);
+
+	/// Reads @a _size bytes starting at @a _offset.
+	bytes read(u256 const& _offset, size_t _size) const;
+	/// Writes @a _size bytes of @a _data to @a _offset.
+	void write(u256 const& _offset, uint8_t const* _data, size_t _size);
+	void write(u256 const& _offset, bytes const& _data) { write(_offset, _data.data(), _data.size()); }
+
+	/// Like read, but with 64 bit addresses, i.e. the range wraps around at 2**64.
+	bytes read64(uint64_t _offset, size_t _size) const;
+	/// Like write, but with 64 bit addresses, i.e. the range wraps around at 2**64.
+	void write64(uint64_t _offset, bytes const& _data);
+
+	/// Copies @a _size bytes of @a _source at offset @a _sourceOffset to @a _targetOffset.
+	/// Behaves as if @a _source would continue with an infinite sequence of zero bytes beyond its end.
+	/// The target range wraps around at 2**64.
+	void copyZeroExtended(size_t _targetOffset, bytes const& _source, size_t _sourceOffset, size_t _size);
+
+	/// @returns the values of the 32 byte aligned words that are not zero, keyed by their offset.
+	std::map<u256, u256> nonZeroWords() const;
+
+private:
+	using Page = std::array<uint8_t, PageSize>;
+
+	/// @returns the page with the given index or nullptr if it was not written to.
+	Page const* findPage(u256 const& _index) const;
+	/// @returns the page with the given index, allocates it if necessary.
+	Page& page(u256 const& _index);
+
+	/// @returns the number of bytes of the range of @a _size bytes starting at @a _offset
+	/// that lie below 2**64.
+	static size_t sizeBelow64BitWrap(uint64_t _offset, size_t _size);
+
+	/// Calls @a _fun(page index, offset in page, offset in range, size) for the consecutive
+	/// parts of the range of @a _size bytes starting at @a _offset that lie in a single page.
+	template <typename Fun>
+	static void forEachPage(u256 const& _offset, size_t _size, Fun&& _fun);
+
+	std::vector<std::unique_ptr<Page>> m_lowPages;
+	std::map<u256, std::unique_ptr<Page>> m_highPages;
+};
+
+struct StorageSlotHash
+{
+	size_t operator()(util::h256 const& _slot) const
+	{
+		return boost::hash_range(_slot.data(), _slot.data() + util::h256::size);
+	}
+};
+
+/// Storage of the Yul interpreter. Slots that were never written to are zero.
+using Storage = std::unordered_map<util::h256, util::h256, StorageSlotHash>;
+
+}
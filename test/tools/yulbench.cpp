@@ -0,0 +1,244 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Benchmark for the Yul AST and optimiser: Copies and optimises sets of Yul sources
+ * and reports the time taken and the peak memory usage.
+ */
+
+#include <libyul/AsmData.h>
+#include <libyul/AssemblyStack.h>
+#include <libyul/Object.h>
+#include <libyul/optimiser/ASTCopier.h>
+#include <libyul/optimiser/Metrics.h>
+
+#include <libsolutil/CommonIO.h>
+
+#include <boost/exception/diagnostic_information.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::yul;
+
+namespace po = boost::program_options;
+namespace fs = boost::filesystem;
+
+namespace
+{
+
+/// @returns the sources of all Yul files in _path, which can be a file or a directory.
+/// The expectations of test files, starting at the "// ----" line, are removed.
+map<string, string> loadSources(fs::path const& _path)
+{
+	map<string, string> sources;
+	auto load = [&](fs::path const& _file)
+	{
+		string source = readFileAsString(_file.string());
+		size_t expectations = source.find("\n// ----");
+		if (expectations != string::npos)
+			source.resize(expectations + 1);
+		sources[_file.generic_string()] = move(source);
+	};
+	if (fs::is_directory(_path))
+	{
+		for (fs::directory_entry const& entry: fs::recursive_directory_iterator(_path))
+			if (fs::is_regular_file(entry.path()) && entry.path().extension() == ".yul")
+				load(entry.path());
+	}
+	else
+		load(_path);
+	return sources;
+}
+
+/// Appends the code of _object and of its sub-objects to _blocks.
+void collectCode(Object const& _object, vector<Block const*>& _blocks)
+{
+	if (_object.code)
+		_blocks.emplace_back(_object.code.get());
+	for (auto const& subNode: _object.subObjects)
+		if (auto const* subObject = dynamic_cast<Object const*>(subNode.get()))
+			collectCode(*subObject, _blocks);
+}
+
+/// @returns the peak resident set size of this process in KiB or zero if it is not available.
+size_t peakMemoryUsage()
+{
+#if defined(_WIN32)
+	return 0;
+#else
+	rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return 0;
+#if defined(__APPLE__)
+	return size_t(usage.ru_maxrss) / 1024;
+#else
+	return size_t(usage.ru_maxrss);
+#endif
+#endif
+}
+
+size_t milliseconds(chrono::steady_clock::duration _time)
+{
+	return size_t(chrono::duration_cast<chrono::milliseconds>(_time).count());
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	po::options_description options(
+		R"(yulbench, Yul AST and optimiser benchmark.
+Usage: yulbench [Options] <path>...
+Parses the Yul files in each <path> (a file or a directory, e.g.
+test/libyul/yulOptimizerTests) as strict assembly, copies their code into new
+arenas and runs the full optimiser suite on them. Reports the time taken by
+both as well as the peak memory usage. Files that cannot be parsed as strict
+assembly, e.g. tests for other dialects, are skipped.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		(
+			"input-path",
+			po::value<vector<string>>(),
+			"input file or directory"
+		)
+		(
+			"copies",
+			po::value<size_t>()->default_value(100),
+			"number of times the code of each file is copied"
+		)
+		(
+			"optimizations",
+			po::value<size_t>()->default_value(1),
+			"number of times each file is optimised"
+		)
+		("help", "Show this help screen.");
+
+	po::positional_options_description filesPositions;
+	filesPositions.add("input-path", -1);
+
+	po::variables_map arguments;
+	try
+	{
+		po::command_line_parser cmdLineParser(argc, argv);
+		cmdLineParser.options(options).positional(filesPositions);
+		po::store(cmdLineParser.run(), arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	if (arguments.count("help") || !arguments.count("input-path"))
+	{
+		cout << options;
+		return 0;
+	}
+
+	size_t const copies = arguments["copies"].as<size_t>();
+	size_t const optimizations = arguments["optimizations"].as<size_t>();
+
+	map<string, string> sources;
+	for (string const& path: arguments["input-path"].as<vector<string>>())
+		sources.merge(loadSources(path));
+
+	size_t skipped = 0;
+	size_t failed = 0;
+	size_t nodes = 0;
+	chrono::steady_clock::duration copyTime{};
+	chrono::steady_clock::duration optimizationTime{};
+	for (auto const& [name, source]: sources)
+	{
+		AssemblyStack parsed(
+			langutil::EVMVersion{},
+			AssemblyStack::Language::StrictAssembly,
+			frontend::OptimiserSettings::none()
+		);
+		if (!parsed.parseAndAnalyze(name, source))
+		{
+			++skipped;
+			continue;
+		}
+
+		vector<Block const*> blocks;
+		collectCode(*parsed.parserResult(), blocks);
+		for (Block const* block: blocks)
+		{
+			nodes += NodeCounter::countNodes(*block);
+			auto start = chrono::steady_clock::now();
+			for (size_t i = 0; i < copies; ++i)
+			{
+				ASTArena arena;
+				Block copy = ASTCopier::clone(*block, arena);
+			}
+			copyTime += chrono::steady_clock::now() - start;
+		}
+
+		for (size_t i = 0; i < optimizations; ++i)
+		{
+			AssemblyStack stack(
+				langutil::EVMVersion{},
+				AssemblyStack::Language::StrictAssembly,
+				frontend::OptimiserSettings::full()
+			);
+			stack.parseAndAnalyze(name, source);
+			try
+			{
+				auto start = chrono::steady_clock::now();
+				stack.optimize();
+				optimizationTime += chrono::steady_clock::now() - start;
+			}
+			catch (...)
+			{
+				cerr << name << ": optimization failed: " << boost::current_exception_diagnostic_information() << endl;
+				++failed;
+				break;
+			}
+		}
+	}
+
+	cout <<
+		sources.size() - skipped << " sources (" << skipped << " skipped), " <<
+		nodes << " nodes" << endl;
+	cout <<
+		"Copying " << copies << " times: " <<
+		milliseconds(copyTime) << " ms" << endl;
+	cout <<
+		"Optimizing " << optimizations << " times: " <<
+		milliseconds(optimizationTime) << " ms" <<
+		(failed ? " (" + to_string(failed) + " failed)" : "") << endl;
+	if (size_t memory = peakMemoryUsage())
+		cout << "Peak memory usage: " << memory << " KiB" << endl;
+
+	return failed ? 1 : 0;
+}
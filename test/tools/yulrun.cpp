@@ -18,6 +18,7 @@
  * Yul interpreter.
  */
 
+#include <test/tools/yulInterpreter/CompiledInterpreter.h>
 #include <test/tools/yulInterpreter/Interpreter.h>
 
 #include <libyul/AsmAnalysisInfo.h>
@@ -78,7 +79,7 @@ pair<shared_ptr<Block>, shared_ptr<AsmAnalysisInfo>> parse(string const& _source
 	}
 }
 
-void interpret(string const& _source)
+void interpret(string const& _source, bool _compiled)
 {
 	shared_ptr<Block> ast;
 	shared_ptr<AsmAnalysisInfo> analysisInfo;
@@ -89,10 +90,12 @@ void interpret(string const& _source)
 	InterpreterState state;
 	state.maxTraceSize = 10000;
 	Dialect const& dialect(EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion{}));
-	Interpreter interpreter(state, dialect);
 	try
 	{
-		interpreter(*ast);
+		if (_compiled)
+			CompiledInterpreter(dialect, *ast).run(state);
+		else
+			Interpreter(state, dialect)(*ast);
 	}
 	catch (InterpreterTerminatedGeneric const&)
 	{
@@ -115,6 +118,7 @@ Allowed options)",
 		po::options_description::m_default_line_length - 23);
 	options.add_options()
 		("help", "Show this help screen.")
+		("compiled", "Translate the code into flat instructions once before running it instead of walking the AST.")
 		("input-file", po::value<vector<string>>(), "input file");
 	po::positional_options_description filesPositions;
 	filesPositions.add("input-file", -1);
@@ -144,7 +148,7 @@ Allowed options)",
 		else
 			input = readStandardInput();
 
-		interpret(input);
+		interpret(input, arguments.count("compiled"));
 	}
 
 	return 0;
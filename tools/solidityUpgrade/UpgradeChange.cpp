@@ -47,7 +47,7 @@ void UpgradeChange::log(bool const _shorten) const
 	formatter.printSourceLocation(SourceReferenceExtractor::extract(&m_location));
 	os << endl;
 
-	LineColumn lineEnd = m_location.source->translatePositionToLineColumn(m_location.end);
+	LineColumn lineEnd = m_location.source()->translatePositionToLineColumn(m_location.end);
 	int const leftpad = static_cast<int>(log10(max(lineEnd.line, 1))) + 2;
 
 	stringstream output;
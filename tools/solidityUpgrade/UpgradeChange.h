@@ -49,7 +49,7 @@ public:
 	)
 	:
 		m_location(_location),
-		m_source(_location.source->source()),
+		m_source(_location.source()->source()),
 		m_patch(_patch),
 		m_level(_level) {}
 
@@ -66,7 +66,8 @@ ostream& std::operator<<(ostream& _outputStream, ErrorList const& _errors)
 }
 
 Program::Program(Program const& program):
-	m_ast(make_unique<Block>(get<Block>(ASTCopier{}(*program.m_ast)))),
+	m_arena(make_shared<ASTArena>()),
+	m_ast(make_unique<Block>(ASTCopier::clone(*program.m_ast, *m_arena))),
 	m_dialect{program.m_dialect},
 	m_nameDispenser(program.m_nameDispenser)
 {
@@ -76,6 +77,8 @@ variant<Program, ErrorList> Program::load(CharStream& _sourceCode)
 {
 	// ASSUMPTION: parseSource() rewinds the stream on its own
 	Dialect const& dialect = EVMDialect::strictAssemblyForEVMObjects(EVMVersion{});
+	auto arena = make_shared<ASTArena>();
+	ASTArena::Scope arenaScope(*arena);
 
 	variant<unique_ptr<Block>, ErrorList> astOrErrors = parseSource(dialect, _sourceCode);
 	if (holds_alternative<ErrorList>(astOrErrors))
@@ -90,6 +93,7 @@ variant<Program, ErrorList> Program::load(CharStream& _sourceCode)
 
 	Program program(
 		dialect,
+		arena,
 		disambiguateAST(
 			dialect,
 			*get<unique_ptr<Block>>(astOrErrors),
@@ -107,6 +111,7 @@ variant<Program, ErrorList> Program::load(CharStream& _sourceCode)
 
 void Program::optimise(vector<string> const& _optimisationSteps)
 {
+	ASTArena::Scope arenaScope(*m_arena);
 	m_ast = applyOptimisationSteps(m_dialect, m_nameDispenser, move(m_ast), _optimisationSteps);
 }
 
@@ -68,6 +68,7 @@ class Program
 public:
 	Program(Program const& program);
 	Program(Program&& program):
+		m_arena(std::move(program.m_arena)),
 		m_ast(std::move(program.m_ast)),
 		m_dialect{program.m_dialect},
 		m_nameDispenser(std::move(program.m_nameDispenser))
@@ -87,8 +88,10 @@ public:
 private:
 	Program(
 		yul::Dialect const& _dialect,
+		std::shared_ptr<yul::ASTArena> _arena,
 		std::unique_ptr<yul::Block> _ast
 	):
+		m_arena(std::move(_arena)),
 		m_ast(std::move(_ast)),
 		m_dialect{_dialect},
 		m_nameDispenser(_dialect, *m_ast, {})
@@ -115,6 +118,7 @@ private:
 	);
 	static size_t computeCodeSize(yul::Block const& _ast);
 
+	std::shared_ptr<yul::ASTArena> m_arena;
 	std::unique_ptr<yul::Block> m_ast;
 	yul::Dialect const& m_dialect;
 	yul::NameDispenser m_nameDispenser;